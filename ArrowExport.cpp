@@ -0,0 +1,356 @@
+/* ArrowExport 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   ArrowExport.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Every exported ArrowArray and ArrowSchema (including children) owns a small heap allocated private_data
+ holding its buffer and child pointer lists. The buffers themselves are either the static tables or
+ the cached string columns, neither of which are ever freed, so release only has to delete the bookkeeping.
+
+ */
+
+
+#ifndef __ARROWEXPORT_H__
+#include "ArrowExport.h"
+#endif
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#include <string>
+#include <vector>
+#include <cassert>
+
+
+namespace
+{
+
+// an Arrow utf8 column built from a table of C strings; null pointers become nulls
+struct StringColumn
+{
+    std::vector<uint8_t> validity; // empty when there are no nulls
+    std::vector<int32_t> offsets;
+    std::string          data;
+    int64_t              nulls = 0;
+};
+
+template <typename F>
+StringColumn
+makeStrings( int N, F str )
+{
+    StringColumn col;
+    col.offsets.reserve(N + 1);
+    col.offsets.push_back(0);
+
+    for (int i = 0; i < N; ++i)
+    {
+        const char *s = str(i);
+        if (s)
+            col.data += s;
+        else ++col.nulls;
+        col.offsets.push_back(static_cast<int32_t>(col.data.size()));
+    }
+
+    if (col.nulls)
+    {
+        col.validity.assign((N + 7) / 8, 0);
+        for (int i = 0; i < N; ++i)
+        {
+            if (str(i))
+                col.validity[i / 8] |= uint8_t(1u << (i % 8));
+        }
+    }
+
+    return col;
+}
+
+// the status bits of a Locode::m_function word as a column of status codes, null for NOSTATUS
+const char*
+statusCode( unsigned short function )
+{
+    static const char * const codes[Locode::MAXSTATUS] = {
+        nullptr, "AM", "RL", "RQ", "XX", "AA", "AC", "AI", "AF", "AS", "AQ", "RN", "UR", "QQ"
+    };
+    const int s = function >> 11;
+    return (s < Locode::MAXSTATUS) ? codes[s] : nullptr;
+}
+
+// an Arrow boolean column (a bitmap, least significant bit first) from a predicate on the row number
+template <typename F>
+std::vector<uint8_t>
+makeBits( int N, F bit )
+{
+    std::vector<uint8_t> retVal((N + 7) / 8, 0);
+    for (int i = 0; i < N; ++i)
+    {
+        if (bit(i))
+            retVal[i / 8] |= uint8_t(1u << (i % 8));
+    }
+    return retVal;
+}
+
+struct ArrayData
+{
+    std::vector<const void*> buffers;
+    std::vector<ArrowArray*> children;
+};
+
+struct SchemaData
+{
+    std::string               format;
+    std::string               name;
+    std::vector<ArrowSchema*> children;
+};
+
+void
+releaseArray( ArrowArray *array )
+{
+    ArrayData *data = static_cast<ArrayData*>(array->private_data);
+
+    for (ArrowArray *child : data->children)
+    {
+        // children moved out by the consumer have already been marked released
+        if (child->release)
+            child->release(child);
+        delete child;
+    }
+
+    delete data;
+    array->release = nullptr;
+}
+
+void
+releaseSchema( ArrowSchema *schema )
+{
+    SchemaData *data = static_cast<SchemaData*>(schema->private_data);
+
+    for (ArrowSchema *child : data->children)
+    {
+        if (child->release)
+            child->release(child);
+        delete child;
+    }
+
+    delete data;
+    schema->release = nullptr;
+}
+
+void
+initArray( ArrowArray *array, int64_t length, int64_t nulls, std::vector<const void*> buffers, std::vector<ArrowArray*> children )
+{
+    ArrayData *data = new ArrayData{ std::move(buffers), std::move(children) };
+
+    array->length       = length;
+    array->null_count   = nulls;
+    array->offset       = 0;
+    array->n_buffers    = static_cast<int64_t>(data->buffers.size());
+    array->n_children   = static_cast<int64_t>(data->children.size());
+    array->buffers      = data->buffers.data();
+    array->children     = data->children.empty() ? nullptr : data->children.data();
+    array->dictionary   = nullptr;
+    array->release      = releaseArray;
+    array->private_data = data;
+}
+
+void
+initSchema( ArrowSchema *schema, const std::string &format, const std::string &name, int64_t flags, std::vector<ArrowSchema*> children )
+{
+    SchemaData *data = new SchemaData{ format, name, std::move(children) };
+
+    schema->format       = data->format.c_str();
+    schema->name         = data->name.c_str();
+    schema->metadata     = nullptr;
+    schema->flags        = flags;
+    schema->n_children   = static_cast<int64_t>(data->children.size());
+    schema->children     = data->children.empty() ? nullptr : data->children.data();
+    schema->dictionary   = nullptr;
+    schema->release      = releaseSchema;
+    schema->private_data = data;
+}
+
+ArrowArray*
+newArray( int64_t length, int64_t nulls, std::vector<const void*> buffers, std::vector<ArrowArray*> children = {} )
+{
+    ArrowArray *array = new ArrowArray;
+    initArray(array, length, nulls, std::move(buffers), std::move(children));
+    return array;
+}
+
+ArrowSchema*
+newSchema( const std::string &format, const std::string &name, int64_t flags, std::vector<ArrowSchema*> children = {} )
+{
+    ArrowSchema *schema = new ArrowSchema;
+    initSchema(schema, format, name, flags, std::move(children));
+    return schema;
+}
+
+} // namespace
+
+
+struct ArrowExport::Columns
+{
+    int64_t                   length = 0;
+    std::vector<ArrowSchema*> schemas;
+    std::vector<ArrowArray*>  arrays;
+
+    // a fixed width column pointing directly at a static table
+    void
+    add( const char *name, const char *format, const void *data )
+    {
+        schemas.push_back(newSchema(format, name, 0));
+        arrays.push_back(newArray(length, 0, { nullptr, data }));
+    }
+
+    void
+    add( const char *name, const StringColumn &col )
+    {
+        const void *validity = col.validity.empty() ? nullptr : col.validity.data();
+        schemas.push_back(newSchema("u", name, (col.nulls) ? ARROW_FLAG_NULLABLE : 0));
+        arrays.push_back(newArray(length, col.nulls, { validity, col.offsets.data(), col.data.data() }));
+    }
+
+    // (latitude, longitude) pairs as fixed_size_list<float32, 2>
+    void
+    add( const char *name, const float (*pos)[2] )
+    {
+        schemas.push_back(newSchema("+w:2", name, 0, { newSchema("f", "item", 0) }));
+        arrays.push_back(newArray(length, 0, { nullptr }, { newArray(2 * length, 0, { nullptr, pos }) }));
+    }
+};
+
+
+const char*
+ArrowExport::name( Table t )
+{
+    switch (t)
+    {
+        case COUNTRY:  return "country"; break;
+        case CURRENCY: return "currency"; break;
+        case MARKET:   return "market"; break;
+        case CITY:     return "city"; break;
+        case LOCODE:   return "locode"; break;
+        default:       return "none"; break;
+    }
+}
+
+void
+ArrowExport::table( Table t, ArrowSchema *schema, ArrowArray *array )
+{
+    assert(schema && array);
+
+    Columns cols;
+
+    switch (t)
+    {
+        case COUNTRY:  countryColumns(cols); break;
+        case CURRENCY: currencyColumns(cols); break;
+        case MARKET:   marketColumns(cols); break;
+        case CITY:     cityColumns(cols); break;
+        case LOCODE:   locodeColumns(cols); break;
+        default:       assert(false); break;
+    }
+
+    initSchema(schema, "+s", name(t), 0, std::move(cols.schemas));
+    initArray(array, cols.length, 0, { nullptr }, std::move(cols.arrays));
+}
+
+//
+// Tables - rows are in dense index() order
+//
+void
+ArrowExport::countryColumns( Columns &cols )
+{
+    static const StringColumn code2 = makeStrings(Country::NUMCOUNTRY, [](int i) { return Country::m_codes2Print[i]; });
+    static const StringColumn code3 = makeStrings(Country::NUMCOUNTRY, [](int i) { return Country::m_codes3[i]; });
+    static const StringColumn names = makeStrings(Country::NUMCOUNTRY, [](int i) { return Country::m_fullNames[i]; });
+
+    cols.length = Country::NUMCOUNTRY;
+    cols.add("iso", "s", Country::m_toISO3);
+    cols.add("code2", code2);
+    cols.add("code3", code3);
+    cols.add("name", names);
+    cols.add("currency", "s", Gazetteer::m_cid2ccy);
+    cols.add("capital", "s", Gazetteer::m_cid2cap);
+    cols.add("region", "C", Gazetteer::m_region);
+    cols.add("subregion", "C", Gazetteer::m_subregion);
+}
+
+void
+ArrowExport::currencyColumns( Columns &cols )
+{
+    static const StringColumn codes = makeStrings(Currency::NUMCURRENCY, [](int i) { return Currency::m_codes[i]; });
+    static const StringColumn names = makeStrings(Currency::NUMCURRENCY, [](int i) { return Currency::m_fullNames[i]; });
+
+    cols.length = Currency::NUMCURRENCY;
+    cols.add("iso", "s", Currency::m_toISO);
+    cols.add("code", codes);
+    cols.add("name", names);
+    cols.add("country", "s", Gazetteer::m_ccy2cid);
+}
+
+void
+ArrowExport::marketColumns( Columns &cols )
+{
+    static const StringColumn codes = makeStrings(MarketId::NUMMARKETID, [](int i) { return MarketId::m_codes[i]; });
+    static const StringColumn names = makeStrings(MarketId::NUMMARKETID, [](int i) { return MarketId::m_fullNames[i]; });
+
+    cols.length = MarketId::NUMMARKETID;
+    cols.add("id", "s", MarketId::m_toISO);
+    cols.add("mic", codes);
+    cols.add("name", names);
+    cols.add("city", "s", Gazetteer::m_mic2cty);
+}
+
+void
+ArrowExport::cityColumns( Columns &cols )
+{
+    static const StringColumn codes3  = makeStrings(City::NUMCITY, [](int i) { return City::m_codes3[i]; });
+    static const StringColumn locodes = makeStrings(City::NUMCITY, [](int i) { return City::m_codes5Print[i]; });
+    static const StringColumn names   = makeStrings(City::NUMCITY, [](int i) { return City::m_fullNames[i]; });
+    static const StringColumn subdivs = makeStrings(City::NUMCITY, [](int i) { return City::m_subdiv[i]; });
+    static const StringColumn zones   = makeStrings(City::NUMCITY, [](int i) { return City::m_timezoneNames[City::m_timezones[i]]; });
+
+    cols.length = City::NUMCITY;
+    cols.add("id", "s", City::m_toISO3);
+    cols.add("code3", codes3);
+    cols.add("locode", locodes);
+    cols.add("name", names);
+    cols.add("subdiv", subdivs);
+    cols.add("timezone", zones);
+    cols.add("capital", "C", City::m_capital);
+    cols.add("position", City::m_position);
+    cols.add("country", "s", Gazetteer::m_cty2cid);
+}
+
+void
+ArrowExport::locodeColumns( Columns &cols )
+// the row number is the Locode id
+{
+    static const StringColumn codes   = makeStrings(LOCODE::NUMLOCODE, [](int i) { return Locode::m_codes[i]; });
+    static const StringColumn names   = makeStrings(LOCODE::NUMLOCODE, [](int i) { return Locode::m_fullNames[i]; });
+    static const StringColumn subdivs = makeStrings(LOCODE::NUMLOCODE, [](int i) { return Locode::m_subdiv[i]; });
+    static const StringColumn status  = makeStrings(LOCODE::NUMLOCODE, [](int i) { return statusCode(Locode::m_function[i]); });
+    static const std::vector<uint8_t> validPos = makeBits(LOCODE::NUMLOCODE, [](int i) { return Locode::index(i).valid_pos(); });
+
+    cols.length = LOCODE::NUMLOCODE;
+    cols.add("locode", codes);
+    cols.add("name", names);
+    cols.add("subdiv", subdivs);
+    cols.add("function", "S", Locode::m_function);
+    cols.add("status", status);
+    cols.add("valid_pos", "b", validPos.data());
+    cols.add("position", Locode::m_position);
+}
+
+//
+//
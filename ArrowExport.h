@@ -0,0 +1,167 @@
+/* ArrowExport 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   ArrowExport.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Export of the reference tables as Apache Arrow record batches using the Arrow C Data Interface.
+
+ The two structs ArrowSchema and ArrowArray below are the stable C ABI defined by the Arrow project,
+ so no Arrow library is required here; any Arrow implementation (C++, Python, Rust, DuckDB, Polars, etc)
+ can import the exported batches directly. Each table is exported as a struct array with one row per entry
+ in the dense index() order of the class i.e. row i of the country table is Country::index(i).
+
+ Numeric columns (ISO codes, relations, positions, functions) point straight at the static tables and are not copied.
+ Arrow strings need a contiguous character buffer and an offset buffer, so string columns are
+ built once, on first use, and cached for the lifetime of the program. Subsequent exports are zero-copy.
+
+ Positions are exported as fixed_size_list<float32, 2> (latitude, longitude) as this matches the layout of the tables.
+
+ see https://arrow.apache.org/docs/format/CDataInterface.html
+
+
+ Tables and columns
+
+ country  : iso int16, code2 utf8, code3 utf8, name utf8, currency int16, capital int16, region uint8, subregion uint8
+ currency : iso int16, code utf8, name utf8, country int16
+ market   : id int16, mic utf8, name utf8, city int16
+ city     : id int16, code3 utf8, locode utf8, name utf8, subdiv utf8, timezone utf8, capital uint8, position [float32, 2], country int16
+ locode   : locode utf8, name utf8, subdiv utf8, function uint16, status utf8, valid_pos bool, position [float32, 2]
+            - the row number is the Locode id
+
+ The relation columns (currency, capital, city, country, region and subregion) are the one-to-one Gazetteer relations.
+
+ The locode function column is the Locode::m_function word as stored: bits 0-9 are the Locode::Function flags, bit 10 is
+ set if the position is valid and bits 11-15 are the Locode::Status. So that consumers need not decode it, the status is
+ also exported as its code (e.g. "AI", null for none) and the position flag as valid_pos; mask with 0x3FF for the functions.
+
+
+ Example
+
+ ArrowSchema schema;
+ ArrowArray  array;
+
+ ArrowExport::market( &schema, &array );
+
+ // hand over to e.g. pyarrow.RecordBatch._import_from_c(array_ptr, schema_ptr)
+ // or arrow::ImportRecordBatch(&array, &schema); the consumer calls the release callbacks
+
+ */
+
+
+#ifndef __ARROWEXPORT_H__
+#define __ARROWEXPORT_H__
+
+#include <cstdint>
+
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C"
+{
+
+struct ArrowSchema
+{
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray
+{
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+} // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+
+
+class ArrowExport
+{
+public:
+
+    enum Table : short { COUNTRY = 0, CURRENCY, MARKET, CITY, LOCODE, MAXTABLE };
+
+    // fill the caller provided structs with a record batch for the table
+    // ownership passes to the caller who must call schema->release and array->release
+    static void
+    table( Table t, ArrowSchema *schema, ArrowArray *array );
+
+    static void
+    country( ArrowSchema *schema, ArrowArray *array ) { table(COUNTRY, schema, array); }
+
+    static void
+    currency( ArrowSchema *schema, ArrowArray *array ) { table(CURRENCY, schema, array); }
+
+    static void
+    market( ArrowSchema *schema, ArrowArray *array ) { table(MARKET, schema, array); }
+
+    static void
+    city( ArrowSchema *schema, ArrowArray *array ) { table(CITY, schema, array); }
+
+    static void
+    locode( ArrowSchema *schema, ArrowArray *array ) { table(LOCODE, schema, array); }
+
+    static const char*
+    name( Table t );
+
+private:
+
+    ArrowExport( void )=delete;
+
+    struct Columns;
+
+    static void
+    countryColumns( Columns &cols );
+
+    static void
+    currencyColumns( Columns &cols );
+
+    static void
+    marketColumns( Columns &cols );
+
+    static void
+    cityColumns( Columns &cols );
+
+    static void
+    locodeColumns( Columns &cols );
+};
+
+
+#endif
+
+
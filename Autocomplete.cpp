@@ -0,0 +1,278 @@
+/* Autocomplete 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Autocomplete.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __AUTOCOMPLETE_H__
+#include "Autocomplete.h"
+#endif
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __NAME_H__
+#include "Name.h"
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <cassert>
+
+
+namespace
+{
+
+std::uint64_t
+node( int depth, int first )
+{
+    return (std::uint64_t(depth) << 32) | std::uint32_t(first);
+}
+
+float
+score( const Gazetteer &g, const City &c )
+{
+    const int markets = int(g.markets(c).size());
+    return 100.0f + ((g.capital(g.country(c)) == c) ? 400.0f : 0.0f) + std::min(20 * markets, 200);
+}
+
+float
+score( const Locode &l )
+{
+    float retVal = 1.0f;
+    if (l.has(Locode::SEAPORT))
+        retVal += 8.0f;
+    if (l.has(Locode::AIRPORT))
+        retVal += 8.0f;
+    if (l.has(Locode::RAIL))
+        retVal += 4.0f;
+    if (l.has(Locode::ROAD))
+        retVal += 2.0f;
+
+    switch (l.status())
+    {
+        case Locode::AA: case Locode::AC: case Locode::AF: case Locode::AI: case Locode::AS:
+            retVal += 10.0f;
+            break;
+        default:
+            break;
+    }
+    return retVal;
+}
+
+} // namespace
+
+
+Autocomplete::Autocomplete( void )
+{
+    Gazetteer g;
+
+    std::vector<std::pair<std::string, Entry>> names;
+    auto add = [&names]( Kind kind, int id, const std::string &name, float score ) {
+        std::string k = Name::trim(fold(name));
+        if (!k.empty() && k.size() < 65536)
+            names.emplace_back(std::move(k), Entry{ 0, 0, kind, id, score });
+    };
+
+    for (int i = 1; i < Country::NUMCOUNTRY; ++i)
+        add(COUNTRY, i, Country::index(i).name(), 1000.0f);
+
+    for (int i = 1; i < City::NUMCITY; ++i)
+        add(CITY, i, City::index(i).name(), score(g, City::index(i)));
+
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+        add(MARKETID, i, MarketId::index(i).name(), 50.0f);
+
+    for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+    {
+        if (i != LOCODE::XXXXX)
+            add(LOCODE, i, Locode::index(i).name(), score(Locode::index(i)));
+    }
+
+    std::stable_sort(names.begin(), names.end(), []( const auto &a, const auto &b ) { return a.first < b.first; });
+
+    m_entries.reserve(names.size());
+    for (auto &n : names)
+    {
+        n.second.key    = std::uint32_t(m_keys.size());
+        n.second.length = std::uint16_t(n.first.size());
+        m_keys += n.first;
+        m_entries.push_back(n.second);
+    }
+
+    // the best of every range too large to rank per keystroke, level by level down the implied trie
+    for (int depth = 0; ; ++depth)
+    {
+        bool large = false;
+        for (int i = 0; i < size(); )
+        {
+            if (int(key(i).size()) < depth)
+            {
+                ++i;
+                continue;
+            }
+
+            const std::string_view prefix = key(i).substr(0, depth);
+            int j = i + 1;
+            while (j < size() && key(j).substr(0, depth) == prefix)
+                ++j;
+
+            if (j - i > SCAN)
+            {
+                large = true;
+                const std::vector<int> best = rank(i, j, TOPK);
+                m_nodes.emplace(node(depth, i), std::pair<int,int>(int(m_top.size()), int(m_top.size() + best.size())));
+                m_top.insert(m_top.end(), best.begin(), best.end());
+            }
+            i = j;
+        }
+
+        if (!large)
+            break;
+    }
+}
+
+std::string
+Autocomplete::fold( std::string_view s )
+{
+    const std::string u = Name::toupper(Name::deaccent(std::string(s)));
+
+    std::string retVal;
+    for (char c : u)
+    {
+        const bool space = (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+        if (!space)
+            retVal += c;
+        else if (retVal.empty() || retVal.back() != ' ')
+            retVal += ' ';
+    }
+    return retVal;
+}
+
+Autocomplete::Cursor
+Autocomplete::extend( Cursor c, std::string_view text ) const
+{
+    const std::string f = fold(text);
+    for (char ch : f)
+    {
+        // a run of spaces is one space in the keys
+        if (ch == ' ' && c.depth > 0 && c.first < c.last && key(c.first).size() > std::size_t(c.depth - 1) &&
+            key(c.first)[c.depth - 1] == ' ')
+            continue;
+
+        // the keys of the range agree on their first depth characters and are sorted on the next one, where a key
+        // that ends first sorts before any character
+        const unsigned char x = (unsigned char) ch;
+        auto next = [this, &c]( int i ) {
+            const std::string_view k = key(i);
+            return (k.size() > std::size_t(c.depth)) ? int((unsigned char) k[c.depth]) : -1;
+        };
+
+        int lo = c.first, hi = c.last;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi) >> 1;
+            if (next(mid) < x)
+                lo = mid + 1;
+            else hi = mid;
+        }
+
+        int end = lo;
+        hi = c.last;
+        while (end < hi)
+        {
+            const int mid = (end + hi) >> 1;
+            if (next(mid) <= x)
+                end = mid + 1;
+            else hi = mid;
+        }
+
+        c = Cursor{ lo, end, c.depth + 1 };
+        if (c.empty())
+            break;
+    }
+    return c;
+}
+
+std::vector<int>
+Autocomplete::rank( int first, int last, int k ) const
+{
+    std::vector<int> retVal(last - first);
+    std::iota(retVal.begin(), retVal.end(), first);
+
+    // ties go to the name that sorts first
+    const std::size_t n = std::min<std::size_t>(retVal.size(), std::max(k, 0));
+    std::partial_sort(retVal.begin(), retVal.begin() + n, retVal.end(), [this]( int a, int b ) {
+        return (m_entries[a].score != m_entries[b].score) ? m_entries[a].score > m_entries[b].score : a < b;
+    });
+    retVal.resize(n);
+    return retVal;
+}
+
+std::vector<Autocomplete::Match>
+Autocomplete::top( const Cursor &c, int k ) const
+{
+    // an empty range keeps its insertion point as first, which may be the first of a precomputed prefix
+    if (c.empty())
+        return std::vector<Match>();
+
+    std::vector<int> best;
+
+    auto iter = m_nodes.find(node(c.depth, c.first));
+    if (k <= TOPK && iter != m_nodes.end())
+        best.assign(m_top.begin() + iter->second.first, m_top.begin() + std::min(iter->second.second, iter->second.first + k));
+    else
+        best = rank(c.first, c.last, k);
+
+    std::vector<Match> retVal;
+    retVal.reserve(best.size());
+    for (int i : best)
+    {
+        const Entry &e = m_entries[i];
+        std::string name;
+        switch (e.kind)
+        {
+            case COUNTRY:  name = Country::index(e.id).name(); break;
+            case CITY:     name = City::index(e.id).name(); break;
+            case MARKETID: name = MarketId::index(e.id).name(); break;
+            case LOCODE:   name = Locode::index(e.id).name(); break;
+            default:       break;
+        }
+        retVal.push_back(Match{ e.kind, e.id, e.score, std::move(name) });
+    }
+    return retVal;
+}
+
+std::vector<Autocomplete::Match>
+Autocomplete::complete( std::string_view prefix, int k ) const
+{
+    while (!prefix.empty() && (prefix.front() == ' ' || prefix.front() == '\t'))
+        prefix.remove_prefix(1);
+    return top(extend(root(), prefix), k);
+}
+
+std::string
+Autocomplete::toString( Kind k )
+{
+    switch (k)
+    {
+        case COUNTRY:  return "COUNTRY"; break;
+        case CITY:     return "CITY"; break;
+        case MARKETID: return "MARKETID"; break;
+        case LOCODE:   return "LOCODE"; break;
+        default:       return "MAXKIND"; break;
+    }
+}
+
+//
+//
+//
+
@@ -0,0 +1,147 @@
+/* Autocomplete 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Autocomplete.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Type-ahead over the names of every Country, City, MarketId and Locode.
+
+ The names are folded as GazetteerCache::canonicalName() folds them (deaccented, upper cased, runs of spaces collapsed)
+ and kept sorted in one character block, so the names with a given prefix are a contiguous range of the array and a
+ Cursor, the range and the prefix length, is a node of the implied trie. extend() narrows a cursor by the next characters
+ with two binary searches inside the current range, so each keystroke starts from the previous keystroke's cursor and
+ the range only shrinks.
+
+ Each name has a static score:
+
+ Country  - 1000
+ City     - 100, plus 400 for a capital and 20 a market (at most 200)
+ MarketId - 50
+ Locode   - 1 plus 8 for a seaport or airport, 4 for rail, 2 for road and 10 if an approved status (AA, AC, AF, AI, AS)
+
+ top() returns the best k of a range, highest score first. The ranges of short prefixes hold thousands of names, so the
+ best TOPK of every prefix matching more than SCAN names are computed when the index is built, and the range of any
+ other prefix is small enough to rank on demand.
+
+ An Autocomplete is read only once built and may be shared by any number of threads.
+
+ Example
+
+ Autocomplete a;
+
+ Autocomplete::Cursor c = a.root();
+ for (char ch : std::string("ROTT"))
+ {
+     c = a.extend(c, std::string(1, ch));                    // one keystroke
+     for (const Autocomplete::Match &m : a.top(c, 5))
+         std::cout << Autocomplete::toString(m.kind) << " " << m.name << " " << m.score << std::endl;
+ }
+
+ std::vector<Autocomplete::Match> r = a.complete("são pa", 10); // a whole prefix, folded as the names are
+
+ */
+
+
+#ifndef __AUTOCOMPLETE_H__
+#define __AUTOCOMPLETE_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+
+
+class Autocomplete
+{
+public:
+
+    // the best TOPK names of every prefix matching more than SCAN names are precomputed
+    static constexpr int SCAN = 256;
+    static constexpr int TOPK = 16;
+
+    enum Kind : unsigned char { COUNTRY, CITY, MARKETID, LOCODE, MAXKIND };
+
+    struct Match
+    {
+        Kind        kind;
+        int         id;    // the dense index, Country::index(), City::index(), MarketId::index() or the Locode id
+        float       score;
+        std::string name;  // as in the table e.g. "São Paulo"
+    };
+
+    // the names with a prefix, keys[first] to keys[last] all begin with the depth characters of the prefix
+    struct Cursor
+    {
+        int first = 0;
+        int last  = 0;
+        int depth = 0;
+
+        bool
+        empty( void ) const { return first == last; }
+    };
+
+    Autocomplete( void );
+    ~Autocomplete( void )=default;
+
+    // every name
+    Cursor
+    root( void ) const { return Cursor{ 0, int(m_entries.size()), 0 }; }
+
+    // the names that continue c with the folded text
+    Cursor
+    extend( Cursor c, std::string_view text ) const;
+
+    // the best k names of c, highest score first
+    std::vector<Match>
+    top( const Cursor &c, int k ) const;
+
+    // top(extend(root(), prefix), k) with leading spaces ignored
+    std::vector<Match>
+    complete( std::string_view prefix, int k ) const;
+
+    int
+    size( void ) const { return int(m_entries.size()); }
+
+    static std::string
+    toString( Kind k );
+
+private:
+
+    struct Entry
+    {
+        std::uint32_t key;    // offset of the folded name in m_keys
+        std::uint16_t length;
+        Kind          kind;
+        int           id;
+        float         score;
+    };
+
+    // folded as the keys, but without trimming so a trailing space is kept while typing
+    static std::string
+    fold( std::string_view s );
+
+    std::string_view
+    key( int i ) const { return std::string_view(m_keys.data() + m_entries[i].key, m_entries[i].length); }
+
+    // the entries of [first, last) by descending score
+    std::vector<int>
+    rank( int first, int last, int k ) const;
+
+    std::string                     m_keys;
+    std::vector<Entry>              m_entries; // by key
+
+    // the precomputed best of a large range: node (depth, first) to a range of m_top
+    std::unordered_map<std::uint64_t, std::pair<int,int>> m_nodes;
+    std::vector<int>                                       m_top;
+};
+
+
+#endif
+
+
@@ -0,0 +1,214 @@
+/* Consistency Checks 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   CHECK_main.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Checks the fast paths of the library against slow but obvious versions of the same thing, over the compiled tables.
+
+ Usage:  check
+
+ Each check prints what it compared and how many cases disagreed. The program exits with EXIT_FAILURE if any did.
+
+ Autocomplete - for every two letter prefix, and each followed by a vowel or S, the best 5 names are the first 5 of a
+                full ranking of every name with the prefix, whether the prefix was ranked when the index was built or is
+                ranked on demand
+
+ MarketSearch - the markets matching queries with hyphenated alternatives, e.g. "new-york|nasdaq" is (NEW and YORK)
+                or NASDAQ, against a scan of the tokens of every market name
+
+ IdColumn     - a column of market ids opened with a rebuilt IdMap is translated to the new ids, and the same column with
+                a value missing from its dictionary is refused rather than read out of bounds
+
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+
+#ifndef __AUTOCOMPLETE_H__
+#include "Autocomplete.h"
+#endif
+
+#ifndef __MARKETSEARCH_H__
+#include "MarketSearch.h"
+#endif
+
+#ifndef __IDCOLUMN_H__
+#include "IdColumn.h"
+#endif
+
+
+static bool
+checkAutocomplete( void )
+{
+    Autocomplete a;
+
+    // every two letter prefix, and those followed by a vowel or S
+    int prefixes = 0;
+    int disagree = 0;
+    for (char x = 'A'; x <= 'Z'; ++x)
+    {
+        for (char y = 'A'; y <= 'Z'; ++y)
+        {
+            for (const char *z = " AEIOUS"; *z; ++z)
+            {
+                std::string prefix{ x, y };
+                if (*z != ' ')
+                    prefix += *z;
+
+                const std::vector<Autocomplete::Match> best = a.complete(prefix, 5);
+                const std::vector<Autocomplete::Match> all  = a.complete(prefix, a.size());
+
+                bool same = (best.size() == std::min<std::size_t>(5, all.size()));
+                for (std::size_t i = 0; i < best.size() && same; ++i)
+                    same = (best[i].kind == all[i].kind && best[i].id == all[i].id);
+                if (!same)
+                    ++disagree;
+                ++prefixes;
+            }
+        }
+    }
+
+    std::cout << "Autocomplete: " << prefixes << " prefixes, top 5 differs from a full ranking for " << disagree << std::endl;
+    return disagree == 0;
+}
+
+// does a name with these tokens match the query; every word must match, and a word matches if all the tokens of one
+// of its '|' alternatives are in the name
+static bool
+nameMatches( const std::vector<std::string> &tokens, const std::string &query )
+{
+    auto has = [&tokens]( const std::string &t ) { return std::find(tokens.begin(), tokens.end(), t) != tokens.end(); };
+
+    std::size_t word = 0;
+    while (word < query.size())
+    {
+        std::size_t end = query.find(' ', word);
+        if (end == std::string::npos)
+            end = query.size();
+
+        bool any = false;
+        std::size_t alt = word;
+        while (alt < end && !any)
+        {
+            std::size_t bar = query.find('|', alt);
+            if (bar == std::string::npos || bar > end)
+                bar = end;
+
+            const std::vector<std::string> group = MarketSearch::tokenise(query.substr(alt, bar - alt));
+            any = !group.empty() && std::all_of(group.begin(), group.end(), has);
+            alt = bar + 1;
+        }
+        if (!any)
+            return false;
+
+        word = end + 1;
+    }
+    return true;
+}
+
+static bool
+checkMarketSearch( void )
+{
+    MarketSearch s;
+
+    const char * const queries[] = { "new-york|nasdaq", "stock new-york|nasdaq", "new york stock|mercantile",
+                                     "london stock exchange", "euronext|deutsche-boerse", "s.a. bolsa|mercado" };
+
+    int matched  = 0;
+    int disagree = 0;
+    for (const char *q : queries)
+    {
+        const MarketSet m = s.matches(q);
+        for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+        {
+            const MarketId mic = MarketId::index(i);
+            const bool want = nameMatches(MarketSearch::tokenise(mic.name()), q);
+            if (want != m.contains(mic))
+                ++disagree;
+            if (want)
+                ++matched;
+        }
+    }
+
+    std::cout << "MarketSearch: " << std::size(queries) << " queries matching " << matched << " markets, differs from a scan for "
+              << disagree << std::endl;
+    return disagree == 0;
+}
+
+static bool
+checkIdColumn( void )
+{
+    const IdMap m = IdMap::compiled(IdMap::MARKETID);
+
+    // a map rebuilt from the same codes in the reverse order, so every id has changed
+    std::vector<std::string> codes;
+    for (int i = m.size() - 1; i > 0; --i)
+        codes.push_back(m.code(i));
+    IdMap r(IdMap::MARKETID);
+    r.update(codes);
+
+    std::vector<std::uint16_t> ids;
+    for (int i = 0; i < 10000; ++i)
+        ids.push_back(std::uint16_t(1 + (i * 7919) % (m.size() - 1)));
+
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string good = (dir / "check_venue.ids").string();
+    const std::string bad  = (dir / "check_venue_bad.ids").string();
+
+    int disagree = 0;
+    IdColumn c;
+    if (!IdColumn::write(good, m, ids.data(), ids.size()) || !c.open(good, r) || c.zeroCopy() || c.size() != ids.size())
+        ++disagree;
+    for (std::size_t i = 0; i < c.size(); ++i)
+    {
+        if (r.code(c[i]) != m.code(ids[i]))
+            ++disagree;
+    }
+    c.close();
+
+    // the last value becomes an id that is in neither the dictionary nor the map
+    {
+        std::ifstream in(good, std::ios::binary);
+        std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        file[file.size() - 2] = char(0xFF);
+        file[file.size() - 1] = char(0x7F);
+        std::ofstream out(bad, std::ios::binary);
+        out.write(file.data(), std::streamsize(file.size()));
+    }
+    const bool refused = !c.open(bad, r);
+    if (!refused)
+        ++disagree;
+
+    std::filesystem::remove(good);
+    std::filesystem::remove(bad);
+
+    std::cout << "IdColumn: " << ids.size() << " ids translated to a rebuilt map, corrupt column " << (refused ? "refused" : "accepted")
+              << ", " << disagree << " failures" << std::endl;
+    return disagree == 0;
+}
+
+
+int
+main( void )
+{
+    bool ok = true;
+
+    ok = checkAutocomplete() && ok;
+    ok = checkMarketSearch() && ok;
+    ok = checkIdColumn() && ok;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
@@ -156,10 +156,17 @@
 #define __CITY_H__
 
 #include <string>
-#include <iostream>
+#include <vector>
+#include <iosfwd>
+
+#ifndef __STRINGPOOL_H__
+#include "StringPool.h"
+#endif
 
 #undef NAN // There is a CityCode 'NAN'
 
+class Subdivision;
+
 class City
 {
 public:
@@ -377,6 +384,10 @@ public:
     // the 3 letter subdivison code for this location e.g. LDN
     std::string
     subdiv( void ) const { return m_subdiv[m_city] ? m_subdiv[m_city] : "XXX"; }
+
+    // the ISO 3166-2 subdivision e.g. GB-LND, see Subdivision
+    Subdivision
+    subdivision( void ) const;
     
     //  IANA time zone for this city  i.e "Europe/London"
     std::string 
@@ -422,12 +433,19 @@ public:
     
     static int
     index( const City &c ) { return m_fromISO[c]; }
+
+    // the cities whose names have the Name::nysiis() key of name, in id order, e.g. "Muenchen" finds Munich's "München"
+    static std::vector<City>
+    soundsLike( const std::string &name );
     
     bool                
     valid( void ) const { return m_city != NOCITY; }
     
 private:
 
+    friend class ArrowExport;
+    template <typename> friend class Dense;
+
     short m_city; 
 
     
@@ -439,12 +457,12 @@ private:
     static const short         m_timezones[NUMCITY];
     static const float         m_position[NUMCITY][2];    
     static const unsigned char m_capital[NUMCITY];
-    static const char * const  m_codes3[NUMCITY];
-    static const char * const  m_codes5[NUMCITY];
-    static const char * const  m_codes5Print[NUMCITY];
-    static const char * const  m_fullNames[NUMCITY];
-    static const char * const  m_timezoneNames[599]; 
-    static const char * const  m_subdiv[NUMCITY];
+    static const StringPool    m_codes3;
+    static const StringPool    m_codes5;
+    static const StringPool    m_codes5Print;
+    static const StringPool    m_fullNames;
+    static const StringPool    m_timezoneNames;
+    static const StringPool    m_subdiv;
 };
 
 
@@ -454,6 +472,14 @@ operator<<( std::ostream &ostr, const City &c );
 std::istream&
 operator>>( std::istream &istr, City &c );
 
+// hashed by the numeric code
+template <>
+struct std::hash<City>
+{
+    std::size_t
+    operator()( const City &c ) const noexcept { return std::size_t(short(c)); }
+};
+
 
 #endif
 
@@ -39,6 +39,8 @@
 #include "Country.h"
 #endif
 
+#include <istream>
+#include <ostream>
 #include <cassert>
 
 
@@ -362,7 +364,9 @@ constexpr short Country::m_toISO3[NUMCOUNTRY] = {  NOCOUNTRY,
 
 
 // these are in country2code alpha order for binary chop search
-constexpr const char * const Country::m_codes2[NUMCOUNTRY] = { "NOCOUNTRY", 
+namespace
+{
+constexpr const char * const s_codes2[Country::NUMCOUNTRY] = { "NOCOUNTRY", 
     "AD", "AE", "AF", "AG", "AI", "AL", "AM", "AO", "AQ", "AR", 
     "AS", "AT", "AU", "AW", "AX", "AZ", "BA", "BB", "BD", "BE", 
     "BF", "BG", "BH", "BI", "BJ", "BL", "BM", "BN", "BO", "BQ", 
@@ -390,9 +394,14 @@ constexpr const char * const Country::m_codes2[NUMCOUNTRY] = { "NOCOUNTRY",
     "VI", "VN", "VU", "WF", "WS", "XA", "XC", "XO", "XP", "XX", 
     "YE", "YT", "ZA", "ZM", "ZW"
 };
+constexpr auto s_codes2Block = makeStringBlock<stringBlockSize(s_codes2)>(s_codes2);
+}
+constexpr StringPool Country::m_codes2(s_codes2Block);
 
 // Note country2codes here in country3code order for printing i.e TF/ATF or  GS/SGS
-constexpr const char * const Country::m_codes2Print[NUMCOUNTRY] = { "NOCOUNTRY", 
+namespace
+{
+constexpr const char * const s_codes2Print[Country::NUMCOUNTRY] = { "NOCOUNTRY", 
     "AW", "AF", "AO", "AI", "AX", "AL", "AD", "AE", "AR", "AM", 
     "AS", "AQ", "TF", "AG", "AU", "AT", "AZ", "BI", "BE", "BJ", 
     "BQ", "BF", "BD", "BG", "BH", "BS", "BA", "BL", "BY", "BZ", 
@@ -420,10 +429,15 @@ constexpr const char * const Country::m_codes2Print[NUMCOUNTRY] = { "NOCOUNTRY",
     "VG", "VI", "VN", "VU", "WF", "WS", "XA", "XC", "XO", "XP", 
     "XX", "YE", "ZA", "ZM", "ZW"
 };
+constexpr auto s_codes2PrintBlock = makeStringBlock<stringBlockSize(s_codes2Print)>(s_codes2Print);
+}
+constexpr StringPool Country::m_codes2Print(s_codes2PrintBlock);
 
 // if you add countries make sure you add the names in the correct alphabetic order position
 // or else the binary chop search in setCountry(std::string) won't work
-constexpr const char * const Country::m_codes3[NUMCOUNTRY] = { "NOCOUNTRY", 
+namespace
+{
+constexpr const char * const s_codes3[Country::NUMCOUNTRY] = { "NOCOUNTRY", 
     "ABW", "AFG", "AGO", "AIA", "ALA", "ALB", "AND", "ARE", "ARG", "ARM", 
     "ASM", "ATA", "ATF", "ATG", "AUS", "AUT", "AZE", "BDI", "BEL", "BEN", 
     "BES", "BFA", "BGD", "BGR", "BHR", "BHS", "BIH", "BLM", "BLR", "BLZ", 
@@ -451,10 +465,15 @@ constexpr const char * const Country::m_codes3[NUMCOUNTRY] = { "NOCOUNTRY",
     "VGB", "VIR", "VNM", "VUT", "WLF", "WSM", "XAF", "XCD", "XOF", "XPF", 
     "XXX", "YEM", "ZAF", "ZMB", "ZWE"
 };
+constexpr auto s_codes3Block = makeStringBlock<stringBlockSize(s_codes3)>(s_codes3);
+}
+constexpr StringPool Country::m_codes3(s_codes3Block);
 
 
 // country3code order
-constexpr const char * const Country::m_fullNames[NUMCOUNTRY] = { "No Country",
+namespace
+{
+constexpr const char * const s_fullNames[Country::NUMCOUNTRY] = { "No Country",
     "Aruba", "Afghanistan", "Angola", "Anguilla", "Aland Islands", "Albania", "Andorra", "United Arab Emirates", "Argentina", "Armenia", 
     "American Samoa", "Antarctica", "French Southern Territories", "Antigua and Barbuda", "Australia", "Austria", "Azerbaijan", "Burundi", "Belgium", "Benin", 
     "Bonaire, Saint Eustatius and Saba", "Burkina Faso", "Bangladesh", "Bulgaria", "Bahrain", "Bahamas", "Bosnia and Herzegovina", "Saint Barthelemy", "Belarus", "Belize", 
@@ -482,6 +501,9 @@ constexpr const char * const Country::m_fullNames[NUMCOUNTRY] = { "No Country",
     "British Virgin Islands", "United States Virgin Islands", "Viet Nam", "Vanuatu", "Wallis and Futuna", "Samoa", "Communaute Financiere Africaine (BEAC)", "East Caribbean", "Communaute Financiere Africaine (BCEAO)", "Comptoirs Francais du Pacifique", 
     "No Country", "Yemen", "South Africa", "Zambia", "Zimbabwe"
 };
+constexpr auto s_fullNamesBlock = makeStringBlock<stringBlockSize(s_fullNames)>(s_fullNames);
+}
+constexpr StringPool Country::m_fullNames(s_fullNamesBlock);
 
 //
 //
@@ -72,7 +72,11 @@
 #define __COUNTRY_H__
 
 #include <string>
-#include <iostream>
+#include <iosfwd>
+
+#ifndef __STRINGPOOL_H__
+#include "StringPool.h"
+#endif
 
 
 class Country
@@ -159,6 +163,9 @@ public:
     
 private:
     
+    friend class ArrowExport;
+    template <typename> friend class Dense;
+    
     short m_country; 
     
     static const short m_search2[28]; 
@@ -166,10 +173,10 @@ private:
     static const short m_fromISO[MAXCOUNTRY]; 
     static const short m_toISO2[NUMCOUNTRY];
     static const short m_toISO3[NUMCOUNTRY];
-    static const char * const m_codes2[NUMCOUNTRY];
-    static const char * const m_codes2Print[NUMCOUNTRY];
-    static const char * const m_codes3[NUMCOUNTRY];
-    static const char * const m_fullNames[NUMCOUNTRY];
+    static const StringPool   m_codes2;
+    static const StringPool   m_codes2Print;
+    static const StringPool   m_codes3;
+    static const StringPool   m_fullNames;
 
 };
 
@@ -180,6 +187,14 @@ operator<<( std::ostream &ostr, const Country &c );
 std::istream&
 operator>>( std::istream &istr, Country &c );
 
+// hashed by the ISO 3166 numeric code
+template <>
+struct std::hash<Country>
+{
+    std::size_t
+    operator()( const Country &c ) const noexcept { return std::size_t(short(c)); }
+};
+
 
 #endif
 
@@ -0,0 +1,94 @@
+/* Csv 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$
+ $   Csv.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#include <cstdlib>
+
+
+std::vector<std::string>
+Csv::split( const std::string &line )
+{
+    std::vector<std::string> retVal(1);
+
+    bool quoted = false;
+    for (std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+        if (c == '"' && quoted && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            retVal.back() += '"';
+            ++i;
+        }
+        else if (c == '"')
+            quoted = !quoted;
+        else if (c == ',' && !quoted)
+            retVal.emplace_back();
+        else if (c != '\r')
+            retVal.back() += c;
+    }
+
+    return retVal;
+}
+
+bool
+Csv::coordinates( const std::string &s, float &lat, float &lon )
+{
+    if (s.size() != 12 || s[5] != ' ')
+        return false;
+
+    const double la = std::atoi(s.substr(0, 2).c_str()) + std::atoi(s.substr(2, 2).c_str()) / 60.0;
+    const double lo = std::atoi(s.substr(6, 3).c_str()) + std::atoi(s.substr(9, 2).c_str()) / 60.0;
+    lat = float((s[4] == 'S') ? -la : la);
+    lon = float((s[11] == 'W') ? -lo : lo);
+    return true;
+}
+
+unsigned short
+Csv::function( const std::string &function, const std::string &status, bool validPos )
+{
+    // the function classifiers 1 to 8 are bits 0 to 7, A (zone) bit 8 and B (border crossing) bit 9
+    unsigned short retVal = 0;
+    for (std::size_t i = 0; i < function.size() && i < 8; ++i)
+    {
+        const char c = function[i];
+        if (c >= '1' && c <= '8')
+            retVal |= (1u << (c - '1'));
+        else if (c == 'A')
+            retVal |= Locode::ZONE;
+        else if (c == 'B')
+            retVal |= Locode::CROSSING;
+    }
+
+    if (validPos)
+        retVal |= (1u << 10);
+
+    for (int i = 1; i < Locode::MAXSTATUS; ++i)
+    {
+        if (status == Locode::toString(Locode::Status(i)))
+            retVal |= (i << 11);
+    }
+
+    return retVal;
+}
+
+//
+//
+//
+
@@ -0,0 +1,61 @@
+/* Csv 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$
+ $   Csv.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ The field splitting shared by the readers of the ISO 10383, UN/LOCODE, Snapshot and IdMap files, and the decoding of
+ the UN/LOCODE fields that do not map directly onto a Locode.
+
+ A field may be double quoted, in which case it may contain commas and a doubled quote "" stands for one quote.
+ Carriage returns are dropped, so files with DOS line endings read the same.
+
+ Example
+
+ std::vector<std::string> f = Csv::split("\"GB\",\"LON\",\"London\",,\"1-3-----\",\"AI\",,,\"5130N 00007W\"");
+
+ float lat, lon;
+ if (Csv::coordinates("5130N 00007W", lat, lon))
+     std::cout << lat << " " << lon << std::endl; // 51.5 -0.116667
+
+ */
+
+
+#ifndef __CSV_H__
+#define __CSV_H__
+
+#include <string>
+#include <vector>
+
+
+
+class Csv
+{
+public:
+
+    // the fields of one line
+    static std::vector<std::string>
+    split( const std::string &line );
+
+    // UN/LOCODE coordinates e.g. "5130N 00007W", returns false if s is not of that form
+    static bool
+    coordinates( const std::string &s, float &lat, float &lon );
+
+    // the Locode::m_function bits of a UN/LOCODE entry: the function classifiers e.g. "1-3----B" as Locode::Function,
+    // bit 10 if it has valid coordinates and the status e.g. "AI" from bit 11
+    static unsigned short
+    function( const std::string &function, const std::string &status, bool validPos );
+
+private:
+
+    Csv( void )=delete;
+};
+
+
+#endif
+
+
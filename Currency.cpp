@@ -28,6 +28,8 @@
 #include "Currency.h"
 #endif
 
+#include <istream>
+#include <ostream>
 #include <cassert>
 
 std::ostream&
@@ -134,7 +136,9 @@ constexpr short Currency::m_midPoints[26] =
 
 
 
-constexpr const char * const Currency::m_codes[NUMCURRENCY] = { "NOCURRENCY", 
+namespace
+{
+constexpr const char * const s_codes[Currency::NUMCURRENCY] = { "NOCURRENCY", 
     "ADP", "AED", "AFA", "AFN", "ALL", "AMD", "ANG", "AOA", "AON", "AOR", 
     "ARS", "ATS", "AUD", "AWG", "AZM", "AZN", "BAD", "BAM", "BBD", "BDT", 
     "BEC", "BEF", "BEL", "BGL", "BGN", "BHD", "BIF", "BMD", "BND", "BOB", 
@@ -161,8 +165,13 @@ constexpr const char * const Currency::m_codes[NUMCURRENCY] = { "NOCURRENCY",
     "XUA", "XXX", "YDD", "YER", "YUD", "YUM", "ZAL", "ZAR", "ZMK", "ZMW", 
     "ZRN", "ZWC", "ZWD", "ZWG", "ZWL", "ZWN", "ZWR"
 };
+constexpr auto s_codesBlock = makeStringBlock<stringBlockSize(s_codes)>(s_codes);
+}
+constexpr StringPool Currency::m_codes(s_codesBlock);
 
-constexpr const char * const Currency::m_fullNames[NUMCURRENCY] = { "No Currency",
+namespace
+{
+constexpr const char * const s_fullNames[Currency::NUMCURRENCY] = { "No Currency",
     "Andorran Peseta (1:1 peg to the Spanish Peseta)", "UAE Dirham", "Afghani", "Afghani", "Lek", "Armenian Dram", "Netherlands Antillian Guilder", "Kwanza", "Angolan New Kwanza", "Angolan Kwanza Readjustado", 
     "Argentine Peso", "Austrian Schilling", "Australian Dollar", "Aruban Guilder", "Azerbaijani Manat", "Azerbaijanian Manat", "Bosnia and Herzegovina Dinar", "Convertible Marks", "Barbados Dollar", "Taka", 
     "Belgian Franc (convertible)", "Belgian Franc (currency union with LUF)", "Belgian Franc (financial)", "Bulgarian Lev A/99", "Bulgarian Lev", "Bahraini Dinar", "Burundi Franc", "Bermudian Dollar", "Brunei Dollar", "Boliviano", 
@@ -189,6 +198,9 @@ constexpr const char * const Currency::m_fullNames[NUMCURRENCY] = { "No Currency
     "ADB Unit of Account", "No Currency", "South Yemeni Dinar", "Yemeni Rial", "Yugoslav Dinar", "Yugoslav Dinar", "South African Financial Rand (funds code)", "Rand", "Zambian Kwacha", "Zambian Kwacha", 
     "Zairean New Zaire", "Zimbabwe Rhodesian Dollar", "Zimbabwe Dollar", "Zimbabwe Gold", "Zimbabwe Dollar", "Zimbabwean Dollar", "Zimbabwean Dollar"
 };
+constexpr auto s_fullNamesBlock = makeStringBlock<stringBlockSize(s_fullNames)>(s_fullNames);
+}
+constexpr StringPool Currency::m_fullNames(s_fullNamesBlock);
 constexpr short Currency::m_fromISO[MAXCURRENCY] = {
     0, 0, 0, 0, 3, 0, 0, 0, 5, 0, 
     0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 
@@ -321,7 +333,7 @@ constexpr const short Currency::m_toISO[NUMCURRENCY] = { NOCURRENCY,
 };
 
 // default base currency
-Currency Currency::m_baseCurrency = Currency::USD;
+constinit Currency Currency::m_baseCurrency = Currency::USD;
 
 //
 //
@@ -64,7 +64,11 @@
 #define __CURRENCY_H__
 
 #include <string>
-#include <iostream>
+#include <iosfwd>
+
+#ifndef __STRINGPOOL_H__
+#include "StringPool.h"
+#endif
 
 
 
@@ -106,10 +110,10 @@ public:
 
     
     Currency( void ): m_ccy(m_baseCurrency) {}
-    ~Currency( void ) { m_ccy = NOCURRENCY; } 
+    ~Currency( void )=default;
     
     // non-explicit constructors intentional here
-    Currency( CurrencyCode i ): m_ccy(i) {} // e.g. i = Currency::GBP
+    constexpr Currency( CurrencyCode i ): m_ccy(i) {} // e.g. i = Currency::GBP
     Currency( const std::string &s ): m_ccy(NOCURRENCY) { setCurrency(s); } 
     Currency( const char *s ): m_ccy(NOCURRENCY) { if (s) setCurrency(s); }  
 
@@ -148,14 +152,17 @@ public:
     
 private:
     
+    friend class ArrowExport;
+    template <typename> friend class Dense;
+    
     short m_ccy; 
     
     static const short m_search[28]; 
     static const short m_midPoints[26]; 
     static const short m_fromISO[MAXCURRENCY]; 
     static const short m_toISO[NUMCURRENCY]; 
-    static const char * const m_codes[NUMCURRENCY];
-    static const char * const m_fullNames[NUMCURRENCY];
+    static const StringPool   m_codes;
+    static const StringPool   m_fullNames;
     
     static Currency m_baseCurrency;
 };
@@ -167,6 +174,14 @@ operator<<( std::ostream &ostr, const Currency &c );
 std::istream&
 operator>>( std::istream &istr, Currency &c );
 
+// hashed by the ISO 4217 numeric code
+template <>
+struct std::hash<Currency>
+{
+    std::size_t
+    operator()( const Currency &c ) const noexcept { return std::size_t(short(c)); }
+};
+
 
 #endif
 
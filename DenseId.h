@@ -0,0 +1,218 @@
+/* DenseId 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   DenseId.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Dense<T> is a Country, Currency, MarketId or City held by its dense index() rather than its numeric code.
+
+ T holds a numeric code (ISO 3166, ISO 4217 or my own), so each accessor first reads m_fromISO[code] to find the row and
+ only then reads the data: two dependent loads, the first into a sparse array (MAXCOUNTRY is 1010 for 256 countries).
+ Dense<T> holds the row itself, so its accessors make a single load, and the numeric code is read only when asked for.
+ Code that reads several attributes of many ids in a loop, or that keeps ids in bulk, should convert once and use Dense<T>.
+
+ Conversion either way is one table read and is implicit: a Dense<T> can be passed wherever a T is expected and the
+ reverse. Names and codes are returned as const char* (the static strings in the tables) rather than std::string, so the
+ accessors do not allocate. Locode is not included as its value is already its index.
+
+ Example
+
+ std::vector<Dense<City>> cities = ...;   // converted from City once
+
+ double lat = 0.0;
+ for (const Dense<City> &c : cities)
+     lat += c.lat();                      // one load per city
+
+ City c = cities.front();                 // back to the numeric code
+ Dense<MarketId> m = MarketId("XLON");
+ std::cout << m.to4Code() << " " << m.name() << " " << short(m.code()) << std::endl;
+
+ */
+
+
+#ifndef __DENSEID_H__
+#define __DENSEID_H__
+
+#include <utility>
+
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __CURRENCY_H__
+#include "Currency.h"
+#endif
+
+#ifndef __MARKETID_H__
+#include "MarketId.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+
+// what every Dense<T> has: the index and the conversions to and from T
+template <typename T>
+class DenseIndex
+{
+public:
+
+    DenseIndex( void ): m_index(0) {}
+    DenseIndex( const T &t ): m_index(short(T::index(t))) {}
+
+    operator T( void ) const { return T::index(m_index); }
+
+    T
+    code( void ) const { return T::index(m_index); }
+
+    // i.e. T::index(code())
+    int
+    index( void ) const { return m_index; }
+
+    bool
+    valid( void ) const { return m_index != 0; }
+
+    bool
+    operator==( const DenseIndex &rhs ) const { return m_index == rhs.m_index; }
+
+    bool
+    operator!=( const DenseIndex &rhs ) const { return m_index != rhs.m_index; }
+
+    // index order, which is the alphabetical order of the codes
+    bool
+    operator<( const DenseIndex &rhs ) const { return m_index < rhs.m_index; }
+
+protected:
+
+    short m_index;
+};
+
+
+template <typename T> class Dense;
+
+
+template <>
+class Dense<Country> : public DenseIndex<Country>
+{
+public:
+
+    Dense( void ) {}
+    Dense( const Country &c ): DenseIndex<Country>(c) {}
+    Dense( Country::CountryCode c ): DenseIndex<Country>(c) {}
+
+    static Dense
+    index( int i ) { Dense d; d.m_index = short(i); return d; }
+
+    using DenseIndex<Country>::index;
+
+    const char*
+    to2Code( void ) const { return Country::m_codes2Print[m_index]; }
+
+    const char*
+    to3Code( void ) const { return Country::m_codes3[m_index]; }
+
+    const char*
+    name( void ) const { return Country::m_fullNames[m_index]; }
+};
+
+
+template <>
+class Dense<Currency> : public DenseIndex<Currency>
+{
+public:
+
+    Dense( void ) {}
+    Dense( const Currency &c ): DenseIndex<Currency>(c) {}
+    Dense( Currency::CurrencyCode c ): DenseIndex<Currency>(c) {}
+
+    static Dense
+    index( int i ) { Dense d; d.m_index = short(i); return d; }
+
+    using DenseIndex<Currency>::index;
+
+    const char*
+    to3Code( void ) const { return Currency::m_codes[m_index]; }
+
+    const char*
+    name( void ) const { return Currency::m_fullNames[m_index]; }
+};
+
+
+template <>
+class Dense<MarketId> : public DenseIndex<MarketId>
+{
+public:
+
+    Dense( void ) {}
+    Dense( const MarketId &m ): DenseIndex<MarketId>(m) {}
+    Dense( MarketId::MarketIdCode m ): DenseIndex<MarketId>(m) {}
+
+    static Dense
+    index( int i ) { Dense d; d.m_index = short(i); return d; }
+
+    using DenseIndex<MarketId>::index;
+
+    const char*
+    to4Code( void ) const { return MarketId::m_codes[m_index]; }
+
+    const char*
+    name( void ) const { return MarketId::m_fullNames[m_index]; }
+};
+
+
+template <>
+class Dense<City> : public DenseIndex<City>
+{
+public:
+
+    Dense( void ) {}
+    Dense( const City &c ): DenseIndex<City>(c) {}
+    Dense( City::CityCode c ): DenseIndex<City>(c) {}
+
+    static Dense
+    index( int i ) { Dense d; d.m_index = short(i); return d; }
+
+    using DenseIndex<City>::index;
+
+    const char*
+    to3Code( void ) const { return City::m_codes3[m_index]; }
+
+    const char*
+    locode( void ) const { return City::m_codes5Print[m_index]; }
+
+    const char*
+    name( void ) const { return City::m_fullNames[m_index]; }
+
+    // City keeps the subdivisions by numeric code
+    const char*
+    subdiv( void ) const { const char *s = City::m_subdiv[City::m_toISO3[m_index]]; return s ? s : "XXX"; }
+
+    const char*
+    timezone( void ) const { return City::m_timezoneNames[City::m_timezones[m_index]]; }
+
+    int
+    timezoneid( void ) const { return City::m_timezones[m_index]; }
+
+    bool
+    capital( void ) const { return City::m_capital[m_index]; }
+
+    double
+    lat( void ) const { return City::m_position[m_index][0]; }
+
+    double
+    lon( void ) const { return City::m_position[m_index][1]; }
+
+    std::pair<double,double>
+    pos( void ) const { return std::pair<double,double>(City::m_position[m_index][0], City::m_position[m_index][1]); }
+};
+
+
+#endif
+
+
@@ -0,0 +1,263 @@
+/* DenseMap 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   DenseMap.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Maps from a Country, Currency, MarketId, City or Locode to a value held as an array over the dense index() space of the key,
+ i.e. element i holds the value of K::index(i), in the same way as EntitySet holds a set.
+
+ A lookup is an index into a contiguous array (K::index() is itself one table read) rather than a hash and a probe, every
+ key is always present with a value initialised value, and iteration visits the keys in index order, which is the
+ alphabetical order of their codes. Index 0, the NO... value of the key, is skipped by iteration. A Dense<K> key
+ (see DenseId.h) skips the K::index() read.
+
+ DenseCounter is the concurrent version for accumulation: each element is a std::atomic and add() is a relaxed fetch_add.
+ With many updates per thread it is cheaper still to accumulate into a private DenseMap and add() it once, which is a
+ single pass over the array.
+
+ Example
+
+ DenseMap<MarketId, double> volume;
+ for (const Trade &t : trades)
+     volume[t.mic] += t.qty * t.px;
+
+ for (auto [mic, v] : volume)
+     if (v > 0.0)
+         std::cout << mic << " " << v << std::endl;
+
+ // from many threads
+ DenseCounter<Country, std::uint64_t> count;
+ count.add(Country::GB);
+ DenseMap<Country, std::uint64_t> total = count.load();
+
+ */
+
+
+#ifndef __DENSEMAP_H__
+#define __DENSEMAP_H__
+
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <concepts>
+#include <cstddef>
+
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __CURRENCY_H__
+#include "Currency.h"
+#endif
+
+#ifndef __MARKETID_H__
+#include "MarketId.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __DENSEID_H__
+#include "DenseId.h"
+#endif
+
+
+// the size of the dense index() space of K
+template <typename K> struct DenseSize;
+template <> struct DenseSize<Country>  { static constexpr int value = Country::NUMCOUNTRY; };
+template <> struct DenseSize<Currency> { static constexpr int value = Currency::NUMCURRENCY; };
+template <> struct DenseSize<MarketId> { static constexpr int value = MarketId::NUMMARKETID; };
+template <> struct DenseSize<City>     { static constexpr int value = City::NUMCITY; };
+template <> struct DenseSize<Locode>   { static constexpr int value = LOCODE::NUMLOCODE; };
+
+
+template <typename K, typename V>
+class DenseMap
+{
+public:
+
+    static constexpr int SIZE = DenseSize<K>::value;
+
+    // an array rather than a std::vector so that V = bool is a plain bool per key rather than a packed bit proxy
+    DenseMap( void ): m_values(new V[SIZE]()) {}
+    explicit DenseMap( const V &v ): m_values(new V[SIZE]) { fill(v); }
+    DenseMap( const DenseMap &m ): m_values(new V[SIZE]) { std::copy(m.data(), m.data() + SIZE, data()); }
+    DenseMap( DenseMap&& )=default;
+    ~DenseMap( void )=default;
+
+    DenseMap&
+    operator=( const DenseMap &m )
+    {
+        if (!m_values)
+            m_values.reset(new V[SIZE]);
+        if (this != &m)
+            std::copy(m.data(), m.data() + SIZE, data());
+        return *this;
+    }
+
+    DenseMap&
+    operator=( DenseMap&& )=default;
+
+    V&
+    operator[]( const K &k ) { return m_values[K::index(k)]; }
+
+    const V&
+    operator[]( const K &k ) const { return m_values[K::index(k)]; }
+
+    // a Dense<K> is already an index; a template so that an enum value (which converts to both K and Dense<K>) picks K
+    template <std::same_as<Dense<K>> D>
+    V&
+    operator[]( const D &k ) { return m_values[k.index()]; }
+
+    template <std::same_as<Dense<K>> D>
+    const V&
+    operator[]( const D &k ) const { return m_values[k.index()]; }
+
+    // by dense index i.e. at(i) is the value of K::index(i)
+    V&
+    at( int i ) { return m_values[i]; }
+
+    const V&
+    at( int i ) const { return m_values[i]; }
+
+    // every key has a value, so the size is fixed
+    static constexpr int
+    size( void ) { return SIZE; }
+
+    void
+    fill( const V &v ) { std::fill(data(), data() + SIZE, v); }
+
+    // the array itself, e.g. for vectorised reductions
+    V*
+    data( void ) { return m_values.get(); }
+
+    const V*
+    data( void ) const { return m_values.get(); }
+
+    //
+    // iteration - (key, value) pairs in dense index order from index 1
+    //
+    template <typename M, typename R>
+    class Iterator
+    {
+    public:
+
+        Iterator( M *m, int i ): m_map(m), m_i(i) {}
+
+        std::pair<K, R&>
+        operator*( void ) const { return std::pair<K, R&>(K::index(m_i), m_map->at(m_i)); }
+
+        Iterator&
+        operator++( void ) { ++m_i; return *this; }
+
+        bool
+        operator==( const Iterator &rhs ) const { return m_i == rhs.m_i; }
+
+        bool
+        operator!=( const Iterator &rhs ) const { return m_i != rhs.m_i; }
+
+    private:
+
+        M  *m_map;
+        int m_i;
+    };
+
+    typedef Iterator<DenseMap, V>             iterator;
+    typedef Iterator<const DenseMap, const V> const_iterator;
+
+    iterator
+    begin( void ) { return iterator(this, 1); }
+
+    iterator
+    end( void ) { return iterator(this, SIZE); }
+
+    const_iterator
+    begin( void ) const { return const_iterator(this, 1); }
+
+    const_iterator
+    end( void ) const { return const_iterator(this, SIZE); }
+
+    template <typename F>
+    void
+    forEach( F f ) const
+    {
+        for (int i = 1; i < SIZE; ++i)
+            f(K::index(i), m_values[i]);
+    }
+
+private:
+
+    std::unique_ptr<V[]> m_values;
+};
+
+
+template <typename K, typename V>
+class DenseCounter
+{
+public:
+
+    static constexpr int SIZE = DenseSize<K>::value;
+
+    DenseCounter( void ): m_values(new std::atomic<V>[SIZE]) { clear(); }
+    ~DenseCounter( void )=default;
+
+    DenseCounter( const DenseCounter& )=delete;
+    DenseCounter&
+    operator=( const DenseCounter& )=delete;
+
+    // relaxed, so concurrent adds are exact but only ordered by a later synchronisation e.g. joining the threads
+    void
+    add( const K &k, V v = V(1) ) { m_values[K::index(k)].fetch_add(v, std::memory_order_relaxed); }
+
+    // add every value of a private DenseMap
+    void
+    add( const DenseMap<K, V> &m )
+    {
+        for (int i = 1; i < SIZE; ++i)
+        {
+            if (m.at(i) != V())
+                m_values[i].fetch_add(m.at(i), std::memory_order_relaxed);
+        }
+    }
+
+    V
+    load( const K &k ) const { return m_values[K::index(k)].load(std::memory_order_relaxed); }
+
+    // a copy of every value, not an atomic snapshot while adds are in progress
+    DenseMap<K, V>
+    load( void ) const
+    {
+        DenseMap<K, V> retVal;
+        for (int i = 0; i < SIZE; ++i)
+            retVal.at(i) = m_values[i].load(std::memory_order_relaxed);
+        return retVal;
+    }
+
+    void
+    clear( void )
+    {
+        for (int i = 0; i < SIZE; ++i)
+            m_values[i].store(V(), std::memory_order_relaxed);
+    }
+
+private:
+
+    std::unique_ptr<std::atomic<V>[]> m_values;
+};
+
+
+#endif
+
+
@@ -0,0 +1,577 @@
+/* Trade Enrichment 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   ENRICH_main.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Streaming CSV trade enrichment.
+
+ Reads a CSV file of trades with a header row, finds the MIC, currency and country columns by name,
+ and appends the columns country, currency, city, timezone, region and subregion from Gazetteer.
+
+ Usage:  enrich [-d delim] [-t threads] [-m mic_col] [-c ccy_col] [-k country_col] [-o out.csv] trades.csv
+
+ The default column names are MIC, CURRENCY (or CCY) and COUNTRY (matched ignoring case). Any of the three may be absent.
+ A valid MIC determines the country, city and currency; otherwise the country column (2 or 3 letter ISO codes) is used,
+ then the currency column. A valid currency column is passed through unchanged.
+
+ The input file is memory mapped and processed as a pipeline of stages connected by bounded queues:
+
+    split   (1 thread)  - cuts the mapping into blocks of whole lines
+    parse   (N threads) - finds the line and the three key fields in each row
+    enrich  (N threads) - looks up the Gazetteer and formats the output block
+    write   (1 thread)  - writes blocks strictly in input order
+
+ Each block carries a sequence number and the writer holds back out of order blocks, so the output preserves the input order.
+ Row and field boundaries are found with std::memchr which the C library implements with vector instructions.
+ Quoted fields are supported but quoted fields may not contain newlines.
+
+ On completion the rows/s and the busy time of each stage are reported to std::cerr.
+
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <map>
+#include <array>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <cstdio>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __NAME_H__
+#include "Name.h"
+#endif
+
+
+//
+// A blocking queue of bounded capacity shared by several producers and consumers
+//
+template <typename T>
+class BoundedQueue
+{
+public:
+
+    BoundedQueue( std::size_t capacity, int producers ): m_capacity(capacity), m_producers(producers) {}
+    ~BoundedQueue( void )=default;
+
+    // blocks while the queue is full
+    void
+    push( T &&item )
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this] { return m_queue.size() < m_capacity; });
+        m_queue.push_back(std::move(item));
+        m_notEmpty.notify_one();
+    }
+
+    // blocks while the queue is empty - returns false once every producer is done and the queue is drained
+    bool
+    pop( T &item )
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notEmpty.wait(lock, [this] { return !m_queue.empty() || m_producers == 0; });
+
+        if (m_queue.empty())
+            return false;
+
+        item = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_notFull.notify_one();
+        return true;
+    }
+
+    // called once by each producer when it has finished
+    void
+    done( void )
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_producers == 0)
+            m_notEmpty.notify_all();
+    }
+
+private:
+
+    std::mutex              m_mutex;
+    std::condition_variable m_notFull;
+    std::condition_variable m_notEmpty;
+    std::deque<T>           m_queue;
+    std::size_t             m_capacity;
+    int                     m_producers;
+};
+
+
+//
+// Work items
+//
+struct Row
+{
+    std::string_view line;
+    std::string_view mic;
+    std::string_view ccy;
+    std::string_view cid;
+};
+
+struct Block
+{
+    long             seq = 0;
+    std::string_view text;   // whole lines
+    std::vector<Row> rows;
+    std::string      out;
+};
+
+
+//
+// Stage timings - nanoseconds of work (not waiting) summed over the threads in a stage
+//
+enum Stage { SPLIT = 0, PARSE, ENRICH, WRITE, MAXSTAGE };
+
+static std::array<std::atomic<long long>, MAXSTAGE> g_busy = {};
+
+class StageTimer
+{
+public:
+
+    StageTimer( Stage s ): m_stage(s), m_start(std::chrono::steady_clock::now()) {}
+    ~StageTimer( void )
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+        g_busy[m_stage] += ns;
+    }
+
+private:
+
+    Stage m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+
+//
+// CSV
+//
+struct Options
+{
+    char        delim    = ',';
+    int         threads  = 0;
+    std::size_t block    = 1 << 20; // bytes per block
+    std::string micCol   = "MIC";
+    std::string ccyCol   = "CURRENCY";
+    std::string cidCol   = "COUNTRY";
+    std::string input;
+    std::string output;
+};
+
+static const char*
+fieldEnd( const char *p, const char *end, char delim )
+// the end of the field starting at p
+{
+    if (p < end && *p == '"')
+    {
+        // skip quoted text; a doubled quote "" is an escaped quote
+        ++p;
+        while ((p = static_cast<const char*>(std::memchr(p, '"', end - p))) != nullptr)
+        {
+            if (++p < end && *p == '"')
+                ++p;
+            else break;
+        }
+        if (!p)
+            return end;
+    }
+
+    const char *q = static_cast<const char*>(std::memchr(p, delim, end - p));
+    return (q) ? q : end;
+}
+
+static std::string_view
+unquote( std::string_view field )
+{
+    if (field.size() >= 2 && field.front() == '"' && field.back() == '"')
+        field = field.substr(1, field.size() - 2);
+
+    while (!field.empty() && field.front() == ' ')
+        field.remove_prefix(1);
+    while (!field.empty() && field.back() == ' ')
+        field.remove_suffix(1);
+
+    return field;
+}
+
+static std::vector<std::string>
+splitHeader( std::string_view line, char delim )
+{
+    std::vector<std::string> retVal;
+
+    const char *p = line.data();
+    const char *end = line.data() + line.size();
+
+    while (true)
+    {
+        const char *q = fieldEnd(p, end, delim);
+        retVal.push_back(Name::toupper(std::string(unquote(std::string_view(p, q - p)))));
+        if (q == end)
+            break;
+        p = q + 1;
+    }
+
+    return retVal;
+}
+
+static int
+findColumn( const std::vector<std::string> &header, const std::string &name, const std::string &alt = "" )
+{
+    const std::string key = Name::toupper(name);
+    for (std::size_t i = 0; i < header.size(); ++i)
+    {
+        if (header[i] == key || (!alt.empty() && header[i] == alt))
+            return int(i);
+    }
+    return -1;
+}
+
+
+//
+// Stages
+//
+static void
+parseBlock( Block &block, char delim, const std::array<int, 3> &cols, int maxCol )
+{
+    const char *p   = block.text.data();
+    const char *end = block.text.data() + block.text.size();
+
+    while (p < end)
+    {
+        const char *eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!eol)
+            eol = end;
+
+        const char *lineEnd = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+
+        Row row;
+        row.line = std::string_view(p, lineEnd - p);
+
+        // walk only as far as the last key column
+        const char *f = p;
+        for (int col = 0; col <= maxCol && f <= lineEnd; ++col)
+        {
+            const char *q = fieldEnd(f, lineEnd, delim);
+            std::string_view field = unquote(std::string_view(f, q - f));
+
+            if (col == cols[0])
+                row.mic = field;
+            else if (col == cols[1])
+                row.ccy = field;
+            else if (col == cols[2])
+                row.cid = field;
+
+            f = q + 1;
+        }
+
+        // blank lines are kept so the output has one row per input row
+        block.rows.push_back(row);
+
+        p = eol + 1;
+    }
+}
+
+static void
+enrichBlock( Block &block, char delim )
+{
+    const Gazetteer g;
+
+    block.out.reserve(block.text.size() + block.rows.size() * 80);
+
+    for (const Row &row : block.rows)
+    {
+        MarketId mic;
+        Country  cid;
+        Currency ccy(Currency::NOCURRENCY);
+        City     cty;
+
+        const bool validMic = (row.mic.size() == 4) && mic.setMarketId(std::string(row.mic));
+        const bool validCcy = (row.ccy.size() == 3) && ccy.setCurrency(std::string(row.ccy));
+        bool validCid = false;
+
+        if (validMic && mic != MarketId::XXXX)
+        {
+            cty = g.city(mic);
+            cid = g.country(cty);
+            validCid = true;
+        }
+        else if ((row.cid.size() == 2 || row.cid.size() == 3) && cid.setCountry(std::string(row.cid)))
+        {
+            validCid = true;
+        }
+        else if (validCcy)
+        {
+            cid = g.country(ccy);
+            validCid = cid.valid();
+        }
+
+        if (!validCcy)
+            ccy = (validCid) ? g.ccy(cid) : Currency(Currency::NOCURRENCY);
+
+        block.out.append(row.line);
+        block.out += delim;
+        if (validCid)
+            block.out += cid.to3Code();
+        block.out += delim;
+        if (ccy.valid())
+            block.out += ccy.to3Code();
+        block.out += delim;
+        if (cty.valid())
+            block.out += cty.to3Code();
+        block.out += delim;
+        if (cty.valid())
+            block.out += cty.timezone();
+        block.out += delim;
+        if (validCid)
+            block.out += g.regionName(g.region(cid));
+        block.out += delim;
+        if (validCid)
+            block.out += g.subregionName(g.subregion(cid));
+        block.out += '\n';
+    }
+}
+
+static bool
+options( int argc, const char *argv[], Options &opt )
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if (arg == "-d" && hasValue)
+            opt.delim = (std::string(argv[++i]) == "\\t") ? '\t' : argv[i][0];
+        else if (arg == "-t" && hasValue)
+            opt.threads = std::stoi(argv[++i]);
+        else if (arg == "-m" && hasValue)
+            opt.micCol = argv[++i];
+        else if (arg == "-c" && hasValue)
+            opt.ccyCol = argv[++i];
+        else if (arg == "-k" && hasValue)
+            opt.cidCol = argv[++i];
+        else if (arg == "-o" && hasValue)
+            opt.output = argv[++i];
+        else if (arg[0] != '-' && opt.input.empty())
+            opt.input = arg;
+        else return false;
+    }
+
+    if (opt.threads < 1)
+        opt.threads = std::max(1u, std::thread::hardware_concurrency() / 2);
+
+    return !opt.input.empty();
+}
+
+
+int
+main( int argc, const char *argv[] )
+{
+    Options opt;
+    if (!options(argc, argv, opt))
+    {
+        std::cerr << "usage: " << argv[0] << " [-d delim] [-t threads] [-m mic_col] [-c ccy_col] [-k country_col] [-o out.csv] trades.csv" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    //
+    // map the input
+    //
+    const int fd = ::open(opt.input.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || ::fstat(fd, &st) != 0)
+    {
+        std::cerr << "cannot open " << opt.input << std::endl;
+        if (fd >= 0)
+            ::close(fd);
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t size = st.st_size;
+    const char *data = nullptr;
+    if (size > 0)
+    {
+        void *map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            std::cerr << "cannot map " << opt.input << std::endl;
+            ::close(fd);
+            return EXIT_FAILURE;
+        }
+        ::madvise(map, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(map);
+    }
+    const char *end = data + size;
+
+    FILE *out = (opt.output.empty()) ? stdout : std::fopen(opt.output.c_str(), "wb");
+    if (!out)
+    {
+        std::cerr << "cannot write " << opt.output << std::endl;
+        if (data)
+            ::munmap(const_cast<char*>(data), size);
+        ::close(fd);
+        return EXIT_FAILURE;
+    }
+
+    //
+    // header
+    //
+    const char *body = (size) ? static_cast<const char*>(std::memchr(data, '\n', size)) : nullptr;
+    body = (body) ? body + 1 : end;
+
+    std::string_view headerLine(data, body - data);
+    while (!headerLine.empty() && (headerLine.back() == '\n' || headerLine.back() == '\r'))
+        headerLine.remove_suffix(1);
+
+    const std::vector<std::string> header = splitHeader(headerLine, opt.delim);
+    const std::array<int, 3> cols = {
+        findColumn(header, opt.micCol),
+        findColumn(header, opt.ccyCol, "CCY"),
+        findColumn(header, opt.cidCol)
+    };
+    const int maxCol = std::max(cols[0], std::max(cols[1], cols[2]));
+
+    if (maxCol < 0)
+    {
+        std::cerr << "no " << opt.micCol << ", " << opt.ccyCol << " or " << opt.cidCol << " column in " << opt.input << std::endl;
+        if (out != stdout)
+            std::fclose(out);
+        if (data)
+            ::munmap(const_cast<char*>(data), size);
+        ::close(fd);
+        return EXIT_FAILURE;
+    }
+
+    const std::string d(1, opt.delim);
+    std::string newHeader(headerLine);
+    newHeader += d + "COUNTRY_ENRICHED" + d + "CURRENCY_ENRICHED" + d + "CITY" + d + "TIMEZONE" + d + "REGION" + d + "SUBREGION\n";
+    std::fwrite(newHeader.data(), 1, newHeader.size(), out);
+
+    //
+    // pipeline
+    //
+    const std::size_t depth = 4 * opt.threads;
+    BoundedQueue<Block> toParse(depth, 1);
+    BoundedQueue<Block> toEnrich(depth, opt.threads);
+    BoundedQueue<Block> toWrite(depth, opt.threads);
+
+    long rows = 0;
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < opt.threads; ++i)
+    {
+        workers.emplace_back([&] {
+            Block block;
+            while (toParse.pop(block))
+            {
+                {
+                    StageTimer timer(PARSE);
+                    parseBlock(block, opt.delim, cols, maxCol);
+                }
+                toEnrich.push(std::move(block));
+            }
+            toEnrich.done();
+        });
+
+        workers.emplace_back([&] {
+            Block block;
+            while (toEnrich.pop(block))
+            {
+                {
+                    StageTimer timer(ENRICH);
+                    enrichBlock(block, opt.delim);
+                }
+                toWrite.push(std::move(block));
+            }
+            toWrite.done();
+        });
+    }
+
+    std::thread writer([&] {
+        std::map<long, Block> pending; // blocks that arrived ahead of their turn
+        long next = 0;
+        Block block;
+        while (toWrite.pop(block))
+        {
+            StageTimer timer(WRITE);
+            pending.emplace(block.seq, std::move(block));
+
+            for (auto itr = pending.find(next); itr != pending.end(); itr = pending.find(++next))
+            {
+                rows += itr->second.rows.size();
+                std::fwrite(itr->second.out.data(), 1, itr->second.out.size(), out);
+                pending.erase(itr);
+            }
+        }
+    });
+
+    // split on line boundaries
+    long seq = 0;
+    for (const char *p = body; p < end; )
+    {
+        Block block;
+        {
+            StageTimer timer(SPLIT);
+            const char *q = std::min(end, p + opt.block);
+            if (q < end)
+            {
+                const char *eol = static_cast<const char*>(std::memchr(q, '\n', end - q));
+                q = (eol) ? eol + 1 : end;
+            }
+            block.seq  = seq++;
+            block.text = std::string_view(p, q - p);
+            p = q;
+        }
+        toParse.push(std::move(block));
+    }
+    toParse.done();
+
+    for (std::thread &t : workers)
+        t.join();
+    writer.join();
+
+    std::fflush(out);
+    if (out != stdout)
+        std::fclose(out);
+    if (data)
+        ::munmap(const_cast<char*>(data), size);
+    ::close(fd);
+
+    //
+    // report
+    //
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const char *names[MAXSTAGE] = { "split", "parse", "enrich", "write" };
+
+    std::cerr << rows << " rows in " << secs << " s (" << ((secs > 0.0) ? rows / secs : 0.0) << " rows/s) using " << opt.threads << " threads per stage" << std::endl;
+    for (int i = 0; i < MAXSTAGE; ++i)
+        std::cerr << "  " << names[i] << " : " << g_busy[i] / 1.0e9 << " s busy" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+//
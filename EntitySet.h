@@ -0,0 +1,206 @@
+/* EntitySet 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   EntitySet.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A fixed size set of Countries, Currencies, MarketIds or Cities held as a bitset over the dense index() space of the class.
+ i.e. bit i is set if T::index(i) is a member of the set.
+
+ Union, intersection and difference are a single pass over an array of 64 bit words and the size of the set is a popcount.
+ The loops are simple enough that the compiler vectorises them; a MarketSet is 48 words so set algebra over every market
+ is a few tens of instructions. All operations are constexpr so that sets can be precomputed at compile time (see Gazetteer).
+
+ Example
+
+ Gazetteer g;
+
+ // EUR markets in Southern Europe
+ MarketSet m = g.marketSet(Currency::EUR) & g.marketSet(Gazetteer::SOUTHERN_EUROPE);
+ std::cout << m.count() << std::endl;
+
+ for (MarketId mic : m.toVector())
+     std::cout << mic << " " << mic.name() << std::endl;
+
+ // non-EUR countries in Europe
+ CountrySet c = g.countrySet(Gazetteer::EUROPE) - g.countrySet(Currency::EUR);
+
+ */
+
+
+#ifndef __ENTITYSET_H__
+#define __ENTITYSET_H__
+
+#include <array>
+#include <vector>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __CURRENCY_H__
+#include "Currency.h"
+#endif
+
+#ifndef __MARKETID_H__
+#include "MarketId.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+
+
+template <typename T, int N>
+class EntitySet
+{
+public:
+
+    static constexpr int SIZE  = N;
+    static constexpr int WORDS = (N + 63) / 64;
+
+    constexpr EntitySet( void ): m_bits{} {}
+    EntitySet( std::initializer_list<T> l ): m_bits{} { for (const T &t : l) insert(t); }
+    ~EntitySet( void )=default;
+
+    //
+    // members
+    //
+    void
+    insert( const T &t ) { set(T::index(t)); }
+
+    void
+    erase( const T &t ) { reset(T::index(t)); }
+
+    bool
+    contains( const T &t ) const { return test(T::index(t)); }
+
+    // by dense index i.e. bit i represents T::index(i)
+    constexpr void
+    set( int i ) { m_bits[i >> 6] |= (std::uint64_t(1) << (i & 63)); }
+
+    constexpr void
+    reset( int i ) { m_bits[i >> 6] &= ~(std::uint64_t(1) << (i & 63)); }
+
+    constexpr bool
+    test( int i ) const { return (m_bits[i >> 6] >> (i & 63)) & 1u; }
+
+    constexpr void
+    clear( void ) { for (int i = 0; i < WORDS; ++i) m_bits[i] = 0; }
+
+    constexpr int
+    count( void ) const
+    {
+        int c = 0;
+        for (int i = 0; i < WORDS; ++i)
+            c += std::popcount(m_bits[i]);
+        return c;
+    }
+
+    constexpr bool
+    empty( void ) const
+    {
+        std::uint64_t any = 0;
+        for (int i = 0; i < WORDS; ++i)
+            any |= m_bits[i];
+        return any == 0;
+    }
+
+    // every valid member of T i.e. index 1 to N - 1
+    static constexpr EntitySet
+    all( void )
+    {
+        EntitySet s;
+        for (int i = 1; i < N; ++i)
+            s.set(i);
+        return s;
+    }
+
+    //
+    // set algebra
+    //
+    constexpr EntitySet&
+    operator|=( const EntitySet &rhs ) { for (int i = 0; i < WORDS; ++i) m_bits[i] |= rhs.m_bits[i]; return *this; }
+
+    constexpr EntitySet&
+    operator&=( const EntitySet &rhs ) { for (int i = 0; i < WORDS; ++i) m_bits[i] &= rhs.m_bits[i]; return *this; }
+
+    constexpr EntitySet&
+    operator-=( const EntitySet &rhs ) { for (int i = 0; i < WORDS; ++i) m_bits[i] &= ~rhs.m_bits[i]; return *this; }
+
+    constexpr EntitySet&
+    operator^=( const EntitySet &rhs ) { for (int i = 0; i < WORDS; ++i) m_bits[i] ^= rhs.m_bits[i]; return *this; }
+
+    // union
+    friend constexpr EntitySet
+    operator|( EntitySet lhs, const EntitySet &rhs ) { return lhs |= rhs; }
+
+    // intersection
+    friend constexpr EntitySet
+    operator&( EntitySet lhs, const EntitySet &rhs ) { return lhs &= rhs; }
+
+    // difference
+    friend constexpr EntitySet
+    operator-( EntitySet lhs, const EntitySet &rhs ) { return lhs -= rhs; }
+
+    // symmetric difference
+    friend constexpr EntitySet
+    operator^( EntitySet lhs, const EntitySet &rhs ) { return lhs ^= rhs; }
+
+    // complement with respect to all()
+    constexpr EntitySet
+    operator~( void ) const { return all() - *this; }
+
+    constexpr bool
+    operator==( const EntitySet &rhs ) const { return m_bits == rhs.m_bits; }
+
+    //
+    // iteration - members are visited in dense index order
+    //
+    template <typename F>
+    void
+    forEach( F f ) const
+    {
+        for (int i = 0; i < WORDS; ++i)
+        {
+            for (std::uint64_t w = m_bits[i]; w; w &= (w - 1))
+                f(T::index((i << 6) + std::countr_zero(w)));
+        }
+    }
+
+    std::vector<T>
+    toVector( void ) const
+    {
+        std::vector<T> retVal;
+        retVal.reserve(count());
+        forEach([&retVal](const T &t) { retVal.push_back(t); });
+        return retVal;
+    }
+
+    const std::array<std::uint64_t, WORDS>&
+    words( void ) const { return m_bits; }
+
+private:
+
+    std::array<std::uint64_t, WORDS> m_bits;
+};
+
+
+typedef EntitySet<Country,  Country::NUMCOUNTRY>   CountrySet;
+typedef EntitySet<Currency, Currency::NUMCURRENCY> CurrencySet;
+typedef EntitySet<MarketId, MarketId::NUMMARKETID> MarketSet;
+typedef EntitySet<City,     City::NUMCITY>         CitySet;
+
+
+#endif
+
+
@@ -0,0 +1,123 @@
+/* Epoch 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   Epoch.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ The reclamation argument: a writer swaps the pointer and then bumps the epoch to e, retiring the old object at e.
+ A reader records the epoch in its slot before it loads the pointer (all sequentially consistent). A reader whose slot holds an
+ epoch >= e read the epoch after the bump, hence after the swap, so it cannot have the old pointer. Any reader that might
+ have the old pointer holds an epoch < e in its slot, and so oldest() stays below e until that slot is cleared.
+ A reader without a slot increments s_overflow before it loads the pointer, and oldest() is 0 while s_overflow
+ is non zero; if oldest() read zero the increment came later, so that reader loads the new pointer.
+
+ */
+
+
+#ifndef __EPOCH_H__
+#include "Epoch.h"
+#endif
+
+#include <atomic>
+
+
+namespace
+{
+
+struct alignas(64) Slot
+{
+    std::atomic<std::uint64_t> epoch{0}; // 0 when the owning thread is not reading
+    std::atomic<bool>          used{false};
+};
+
+// all constant initialised, so there is nothing to construct at program start
+constinit Slot                          s_slots[Epoch::MAXREADER];
+constinit std::atomic<std::uint64_t>    s_epoch{1};
+constinit std::atomic<int>              s_overflow{0}; // readers on threads that found no free slot
+
+// a thread claims a slot on its first Guard and gives it back when it exits; a thread that finds none reads
+// through s_overflow and tries again on its next outermost Guard
+struct ThreadSlot
+{
+    int index = -1;
+    int depth = 0;
+
+    ~ThreadSlot( void )
+    {
+        if (index >= 0)
+        {
+            s_slots[index].epoch.store(0);
+            s_slots[index].used.store(false);
+        }
+    }
+
+    // nullptr if every slot is taken
+    Slot*
+    slot( void )
+    {
+        for (int i = 0; i < Epoch::MAXREADER && index < 0; ++i)
+        {
+            bool expected = false;
+            if (s_slots[i].used.compare_exchange_strong(expected, true))
+                index = i;
+        }
+        return (index < 0) ? nullptr : &s_slots[index];
+    }
+};
+
+constinit thread_local ThreadSlot t_slot;
+
+} // namespace
+
+
+Epoch::Guard::Guard( void )
+{
+    // nested Guards on the same thread share the outermost epoch
+    if (t_slot.depth++ == 0)
+    {
+        Slot *slot = t_slot.slot();
+        if (slot)
+            slot->epoch.store(s_epoch.load());
+        else s_overflow.fetch_add(1);
+    }
+}
+
+Epoch::Guard::~Guard( void )
+{
+    // the slot of a thread does not change while it holds a Guard
+    if (--t_slot.depth == 0)
+    {
+        if (t_slot.index >= 0)
+            s_slots[t_slot.index].epoch.store(0);
+        else s_overflow.fetch_sub(1);
+    }
+}
+
+std::uint64_t
+Epoch::advance( void )
+{
+    return s_epoch.fetch_add(1) + 1;
+}
+
+std::uint64_t
+Epoch::oldest( void )
+{
+    // a reader without a slot may hold anything
+    if (s_overflow.load())
+        return 0;
+
+    std::uint64_t retVal = UINT64_MAX;
+    for (int i = 0; i < MAXREADER; ++i)
+    {
+        const std::uint64_t e = s_slots[i].epoch.load();
+        if (e && e < retVal)
+            retVal = e;
+    }
+    return retVal;
+}
+
+
@@ -0,0 +1,79 @@
+/* Epoch 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   Epoch.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Epoch based reclamation for structures whose readers follow an atomic pointer without locking, shared by Snapshot
+ and GazetteerCache. A reader holds an Epoch::Guard while it uses what it loaded. A writer swaps the pointer, calls
+ advance() and keeps the old object until its epoch is <= oldest(), after which no reader can still hold it.
+
+ Each reader thread owns a slot in which it records the global epoch on entry and clears on exit. Guards nest and share the
+ outermost epoch. A thread takes one of MAXREADER slots on its first Guard and holds it until the thread exits; threads beyond
+ that read through a shared counter instead, which is as safe but makes oldest() 0, holding back all reclamation, while any
+ of them is reading. Keep Guards short lived as a Guard that is never released holds back every later retirement.
+
+ Readers must load the pointer after the Guard is taken and writers must swap it before advance(), both sequentially
+ consistent, which is the default for std::atomic.
+
+ Example
+
+ std::atomic<const T*> p;
+
+ // reader
+ {
+     Epoch::Guard g;
+     const T *t = p.load();
+     use(t);
+ }
+
+ // writer, serialised by the caller
+ const T *old = p.exchange(next);
+ retired.emplace_back(Epoch::advance(), old);
+ ...
+ const std::uint64_t oldest = Epoch::oldest();   // free each retired (e, t) with e <= oldest
+
+ */
+
+
+#ifndef __EPOCH_H__
+#define __EPOCH_H__
+
+#include <cstdint>
+
+
+class Epoch
+{
+public:
+
+    static constexpr int MAXREADER = 256;
+
+    class Guard
+    {
+    public:
+
+        Guard( void );
+        ~Guard( void );
+
+        Guard( const Guard& )=delete;
+        Guard&
+        operator=( const Guard& )=delete;
+    };
+
+    // bumps the global epoch and returns the epoch at which to retire what was just unlinked
+    static std::uint64_t
+    advance( void );
+
+    // an object retired at epoch e may be freed if e <= oldest(); 0 while a reader without a slot is reading
+    static std::uint64_t
+    oldest( void );
+};
+
+
+#endif
+
+
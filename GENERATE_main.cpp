@@ -0,0 +1,965 @@
+/* Table Generator 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   GENERATE_main.cpp - code    $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Regenerates the constexpr tables of MarketId, City, Locode and the Gazetteer relations from the published source files.
+
+ Usage:  generate [-m ISO10383_MIC.csv] [-x] [-c cities.csv] [-l name] [-s statuses] [-o outdir] [unlocode.csv ...]
+
+ -m  the ISO 10383 MIC list (https://www.iso20022.org/market-identifier-codes), columns are found by name:
+     MIC, MARKET NAME-INSTITUTION DESCRIPTION, ISO COUNTRY CODE (ISO 3166), CITY, STATUS
+ -x  include MICs with STATUS EXPIRED that are not already in MarketId
+ -c  the city list, one row per city with the header
+     CODE3,LOCODE,NAME,SUBDIV,COUNTRY,CAPITAL,LATITUDE,LONGITUDE,TIMEZONE
+     where COUNTRY is an ISO 3 letter code and TIMEZONE an IANA name e.g. LON,GBLON,London,LND,GBR,1,51.5072,-0.1276,Europe/London
+ -l  the name of the LOCODE table set, e.g. SMALL or LARGE, default SMALL
+ -s  the UN/LOCODE status codes to keep, e.g. AM,AA,AC,AI,AF,AS, default all
+ -o  the output directory, default .
+
+ The remaining arguments are the UN/LOCODE code list files (https://unece.org/trade/uncefact/unlocode) as published
+ by UNECE i.e. no header and the columns Ch, Country, Location, Name, NameWoDiacritics, SubDiv, Function, Status, Date,
+ IATA, Coordinates, Remarks. Country heading rows (no location) and deletions (Ch = 'X') are skipped.
+
+ Output
+
+ CITY_TABLES.txt          - the City enum, CityData.cpp tables and Gazetteer::m_cty2cid
+ MARKETID_TABLES.txt      - the MarketId enum, MarketIdData.cpp tables, Gazetteer::m_mic2cty and Gazetteer::m_cty2mics
+ LOCODES_name_HEADER.h    - drop in replacement for LOCODES_SMALL_HEADER.h or LOCODES_LARGE_HEADER.h
+ LOCODES_name_BODY.txt    - drop in replacement for LOCODES_SMALL_BODY.txt or LOCODES_LARGE_BODY.txt
+
+ The enum values of MarketId and City are numeric codes used by client code and stored in files, so they are kept stable:
+ codes already in the compiled tables keep their value, new codes are numbered from the current MAXMARKETID/MAXCITY, and
+ nothing is removed (removing an enum member would break client code, do that by hand). Without -c the cities are taken
+ from the compiled City class, so the MIC tables can be regenerated on their own.
+
+ Everything else is derived: the dense index order (sorted by code), the m_search buckets used by the binary chops,
+ the m_fromISO/m_toISO permutations and the count prefixed relation lists. Only ordered containers are used and the
+ inputs are sorted before use so the output depends only on the input files.
+
+ City::m_timezoneNames is rebuilt as the sorted list of the time zones the cities use, so its size and the values of
+ City::timezoneid() may change.
+
+ The string tables are written as lists of literals that the data files turn into StringPools at compile time.
+
+ A MIC is placed in a city by its existing relation, or for a new MIC by matching the ISO CITY field with a city name in
+ the same country (ignoring case); MICs that cannot be placed go to City::XXX.
+
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cstdlib>
+#include <cstdio>
+
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+
+
+struct Options
+{
+    std::string              mics;
+    std::string              cities;
+    std::string              locodeName = "SMALL";
+    std::set<std::string>    statuses;
+    std::string              outdir = ".";
+    std::vector<std::string> locodes;
+    bool                     expired = false;
+};
+
+struct CityEntry
+{
+    std::string code3;
+    std::string locode;
+    std::string name;
+    std::string subdiv;   // empty for none
+    std::string country;  // ISO 3 letter code
+    bool        capital = false;
+    float       lat = 0.0f;
+    float       lon = 0.0f;
+    std::string timezone;
+    int         id = 0;
+};
+
+struct MicEntry
+{
+    std::string code;
+    std::string name;
+    std::string city;     // City code3
+    int         id = 0;
+};
+
+struct LocodeEntry
+{
+    std::string    code;
+    std::string    name;
+    std::string    subdiv;
+    unsigned short function = 0; // Locode::m_function layout i.e. functions, valid position bit and status
+    float          lat = 0.0f;
+    float          lon = 0.0f;
+};
+
+typedef std::vector<std::vector<std::string>> Records;
+
+
+//
+// input
+//
+static bool
+readCsv( const std::string &fname, Records &recs )
+{
+    std::ifstream in(fname);
+    if (!in)
+    {
+        std::cerr << "cannot open " << fname << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line != "\r")
+            recs.push_back(Csv::split(line));
+    }
+
+    return true;
+}
+
+static int
+column( const std::vector<std::string> &header, const char *name )
+{
+    auto iter = std::find(header.begin(), header.end(), name);
+    return (iter != header.end()) ? int(iter - header.begin()) : -1;
+}
+
+static std::string
+upper( std::string s )
+{
+    for (char &c : s)
+        c = char(std::toupper((unsigned char) c));
+    return s;
+}
+
+//
+// output
+//
+static std::string
+literal( const std::string &s )
+{
+    std::string retVal = "\"";
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\' || c == '\'')
+            retVal += '\\';
+        retVal += c;
+    }
+    return retVal + '"';
+}
+
+static std::string
+literalOrNull( const std::string &s )
+{
+    return (s.empty()) ? "nullptr" : literal(s);
+}
+
+static std::string
+number( float x )
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", x);
+    return buffer;
+}
+
+// MICs and cities starting with a digit are not legal c++ enums, see MarketId.h
+static std::string
+enumName( const std::string &code )
+{
+    return (!code.empty() && std::isdigit((unsigned char) code[0])) ? "_" + code : code;
+}
+
+// the items from first, perLine to a line
+static void
+writeList( std::ostream &out, const std::vector<std::string> &items, std::size_t first, int perLine, const char *indent = "    " )
+{
+    for (std::size_t i = first; i < items.size(); ++i)
+    {
+        if ((i - first) % perLine == 0)
+            out << indent;
+        out << items[i];
+        if (i + 1 < items.size())
+            out << ", ";
+        if ((i - first) % perLine == std::size_t(perLine - 1) || i + 1 == items.size())
+            out << '\n';
+    }
+}
+
+// a string table is a StringPool built at compile time from a list of literals, see StringPool.h
+static void
+poolBegin( std::ostream &out, const std::string &member, const std::string &size )
+{
+    out << "namespace\n{\nconstexpr const char * const s_" << member << "[" << size << "] = { ";
+}
+
+static void
+poolEnd( std::ostream &out, const std::string &cls, const std::string &member )
+{
+    const std::string s = "s_" + member;
+    out << "};\n";
+    out << "constexpr auto " << s << "Block = makeStringBlock<stringBlockSize(" << s << ")>(" << s << ");\n}\n";
+    out << "constexpr StringPool " << cls << "::m_" << member << "(" << s << "Block);\n";
+}
+
+// m_search - the first index of each initial letter in the sorted codes, codes[0] is the NO... entry
+// with a digit bucket '@' all codes preceding 'A' share bucket 0 (MarketId), otherwise bucket 0 is 'A' (City, Locode)
+static std::vector<int>
+searchBuckets( const std::vector<std::string> &codes, bool digitBucket )
+{
+    const int N = digitBucket ? 28 : 27;
+    std::vector<int> retVal(N, int(codes.size()));
+
+    for (int k = 0; k < N - 1; ++k)
+    {
+        for (std::size_t i = 1; i < codes.size(); ++i)
+        {
+            const int c = (unsigned char) codes[i][0];
+            const int bucket = digitBucket ? std::max(int('@'), c) - '@' : c - 'A';
+            if (bucket >= k)
+            {
+                retVal[k] = int(i);
+                break;
+            }
+        }
+    }
+
+    return retVal;
+}
+
+static std::string
+joinInts( const std::vector<int> &v )
+{
+    std::string retVal;
+    for (std::size_t i = 0; i < v.size(); ++i)
+        retVal += ((i) ? ", " : "") + std::to_string(v[i]);
+    return retVal;
+}
+
+static void
+banner( std::ostream &out, const std::string &fname, const std::string &kind, const std::string &history )
+{
+    const std::string title = "$   " + fname + " - " + kind + "   $";
+    const std::string rule(title.size(), '$');
+
+    out << "/* " << fname.substr(0, fname.find('.')) << " (generated)\n \n";
+    out << " " << rule << "\n " << title << "\n " << rule << "\n \n";
+    out << " by W.B. Yates    \n Copyright (c) W.B. Yates. All rights reserved. \n \n";
+    out << " History: " << history << "\n \n */\n\n\n";
+}
+
+
+//
+// Cities
+//
+static std::vector<CityEntry>
+compiledCities( void )
+{
+    Gazetteer g;
+    std::vector<CityEntry> retVal;
+
+    for (int i = 1; i < City::NUMCITY; ++i)
+    {
+        const City c = City::index(i);
+        const Country cid = g.country(c);
+
+        CityEntry e;
+        e.code3    = c.to3Code();
+        e.locode   = c.locode();
+        e.name     = c.name();
+        e.subdiv   = (c.subdiv() != "XXX") ? c.subdiv() : "";
+        e.country  = cid.valid() ? cid.to3Code() : "";
+        e.capital  = c.capital();
+        e.lat      = float(c.lat());
+        e.lon      = float(c.lon());
+        e.timezone = (c.timezoneid()) ? c.timezone() : "";
+        e.id       = short(c);
+        retVal.push_back(e);
+    }
+
+    return retVal;
+}
+
+static bool
+readCities( const std::string &fname, std::vector<CityEntry> &cities )
+{
+    Records recs;
+    if (!readCsv(fname, recs) || recs.empty())
+        return false;
+
+    const std::vector<std::string> &h = recs[0];
+    const int code3 = column(h, "CODE3"), locode = column(h, "LOCODE"), name = column(h, "NAME"), subdiv = column(h, "SUBDIV");
+    const int country = column(h, "COUNTRY"), capital = column(h, "CAPITAL"), lat = column(h, "LATITUDE"), lon = column(h, "LONGITUDE");
+    const int tz = column(h, "TIMEZONE");
+
+    if (std::min({ code3, locode, name, subdiv, country, capital, lat, lon, tz }) < 0)
+    {
+        std::cerr << fname << ": missing column" << std::endl;
+        return false;
+    }
+
+    for (std::size_t i = 1; i < recs.size(); ++i)
+    {
+        const std::vector<std::string> &r = recs[i];
+        if (r.size() < h.size())
+        {
+            std::cerr << fname << ": short row " << i << std::endl;
+            return false;
+        }
+
+        CityEntry e;
+        e.code3    = r[code3];
+        e.locode   = r[locode];
+        e.name     = r[name];
+        e.subdiv   = r[subdiv];
+        e.country  = r[country];
+        e.capital  = (r[capital] == "1");
+        e.lat      = std::strtof(r[lat].c_str(), nullptr);
+        e.lon      = std::strtof(r[lon].c_str(), nullptr);
+        e.timezone = r[tz];
+
+        // keep the numeric code of a known city
+        const City c(e.code3);
+        e.id = (c.valid() && e.code3 != "XXX") ? short(c) : 0;
+        if (e.code3 == "XXX")
+            e.id = City::XXX;
+
+        cities.push_back(e);
+    }
+
+    return true;
+}
+
+// sort by code3, give new cities an id and check the codes are unique
+static bool
+numberCities( std::vector<CityEntry> &cities )
+{
+    std::sort(cities.begin(), cities.end(), []( const CityEntry &a, const CityEntry &b ) { return a.code3 < b.code3; });
+
+    std::set<std::string> locodes;
+    int next = City::MAXCITY;
+    for (std::size_t i = 0; i < cities.size(); ++i)
+    {
+        if ((i && cities[i].code3 == cities[i - 1].code3) || !locodes.insert(cities[i].locode).second)
+        {
+            std::cerr << "duplicate city " << cities[i].code3 << " " << cities[i].locode << std::endl;
+            return false;
+        }
+        if (cities[i].id == 0)
+            cities[i].id = next++;
+    }
+
+    return true;
+}
+
+static void
+writeCities( const std::string &outdir, const std::vector<CityEntry> &cities )
+{
+    const std::string fname = "CITY_TABLES.txt";
+    std::ofstream out(outdir + "/" + fname);
+
+    const int NUM = int(cities.size()) + 1;
+    int MAX = 0;
+    for (const CityEntry &c : cities)
+        MAX = std::max(MAX, c.id + 1);
+
+    banner(out, fname, "code", "City tables, paste the enum into City.h and the rest into CityData.cpp and GazetteerData.cpp");
+
+    // enum
+    out << "// City.h\n\n    enum CityCode : short { NOCITY = 0, \n";
+    std::vector<std::string> items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(c.code3 + " = " + std::to_string(c.id) + ", " + c.locode + " = " + std::to_string(c.id));
+    items.push_back("\n        MAXCITY = " + std::to_string(MAX) + ", NUMCITY = " + std::to_string(NUM) + " \n    };");
+    writeList(out, items, 1, 10, "        ");
+    out << "\n\n// CityData.cpp\n\n";
+
+    // code3 order
+    std::vector<std::string> codes3 = { "NOCITY" };
+    for (const CityEntry &c : cities)
+        codes3.push_back(c.code3);
+
+    out << "constexpr short City::m_search3[28] = {\n    " << joinInts(searchBuckets(codes3, false)) << "\n    , -1 \n};\n\n";
+
+    std::vector<std::string> fromISO(MAX, "0");
+    for (std::size_t i = 0; i < cities.size(); ++i)
+        fromISO[cities[i].id] = std::to_string(i + 1);
+    out << "constexpr short City::m_fromISO[MAXCITY] = { \n";
+    writeList(out, fromISO, 0, 11);
+    out << "};\n\n";
+
+    items = { "NOCITY" };
+    for (const CityEntry &c : cities)
+        items.push_back(c.code3);
+    out << "constexpr short City::m_toISO3[NUMCITY] = { NOCITY, \n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back("{" + number(c.lat) + ", " + number(c.lon) + "}");
+    out << "constexpr float City::m_position[NUMCITY][2] = { { 0.0, 0.0 }, // NOCITY\n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(c.capital ? "1" : "0");
+    out << "constexpr const unsigned char City::m_capital[NUMCITY] = { 0, // NOCITY\n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(literal(c.code3));
+    poolBegin(out, "codes3", "City::NUMCITY");
+    out << "\"NOCITY\", \n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "City", "codes3");
+    out << "\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(literal(c.name));
+    poolBegin(out, "fullNames", "City::NUMCITY");
+    out << "\"No City\",\n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "City", "fullNames");
+    out << "\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(literalOrNull(c.subdiv));
+    poolBegin(out, "subdiv", "City::NUMCITY");
+    out << "\"XXX\",\n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "City", "subdiv");
+    out << "\n";
+
+    // time zones, sorted, 0 is no time zone
+    std::set<std::string> zones;
+    for (const CityEntry &c : cities)
+    {
+        if (!c.timezone.empty())
+            zones.insert(c.timezone);
+    }
+    std::map<std::string, int> zoneIndex;
+    items = { "" };
+    for (const std::string &z : zones)
+    {
+        zoneIndex[z] = int(items.size());
+        items.push_back(literal(z));
+    }
+    poolBegin(out, "timezoneNames", std::to_string(items.size()));
+    out << "\n    \"No Timezone\",\n";
+    writeList(out, items, 1, 5);
+    poolEnd(out, "City", "timezoneNames");
+    out << "\n";
+
+    items = { "0" };
+    for (const CityEntry &c : cities)
+        items.push_back(std::to_string(c.timezone.empty() ? 0 : zoneIndex[c.timezone]));
+    out << "constexpr const short City::m_timezones[NUMCITY] = { \n    0, \n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back(literal(c.locode));
+    poolBegin(out, "codes5Print", "City::NUMCITY");
+    out << "\"NOCITY\", \n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "City", "codes5Print");
+    out << "\n";
+
+    // locode order
+    std::vector<const CityEntry*> byLocode;
+    for (const CityEntry &c : cities)
+        byLocode.push_back(&c);
+    std::sort(byLocode.begin(), byLocode.end(), []( const CityEntry *a, const CityEntry *b ) { return a->locode < b->locode; });
+
+    std::vector<std::string> codes5 = { "NOCITY" };
+    for (const CityEntry *c : byLocode)
+        codes5.push_back(c->locode);
+
+    out << "constexpr short City::m_search5[28] = {\n    " << joinInts(searchBuckets(codes5, false)) << "\n    , -1\n};\n\n";
+
+    items = { "" };
+    for (const CityEntry *c : byLocode)
+        items.push_back(c->locode);
+    out << "constexpr short City::m_toISO5[NUMCITY] = { NOCITY, \n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const CityEntry *c : byLocode)
+        items.push_back(literal(c->locode));
+    poolBegin(out, "codes5", "City::NUMCITY");
+    out << "\"NOCITY\", \n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "City", "codes5");
+    out << "\n";
+
+    // relation
+    out << "\n// GazetteerData.cpp\n\n";
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back("Country::" + (c.country.empty() ? std::string("NOCOUNTRY") : c.country));
+    out << "constexpr short Gazetteer::m_cty2cid[City::NUMCITY] = { \n    Country::NOCOUNTRY,\n";
+    writeList(out, items, 1, 10);
+    out << "};\n\n";
+}
+
+
+//
+// Markets
+//
+static bool
+readMics( const std::string &fname, bool expired, const std::vector<CityEntry> &cities, std::vector<MicEntry> &mics )
+{
+    Gazetteer g;
+
+    // the current list
+    std::map<std::string, MicEntry> byCode;
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+    {
+        const MarketId m = MarketId::index(i);
+        byCode[m.to4Code()] = MicEntry{ m.to4Code(), m.name(), g.city(m).to3Code(), short(m) };
+    }
+
+    // (country 2 code, upper case city name) -> city, for placing new MICs
+    std::map<std::string, std::string> cityByName;
+    for (const CityEntry &c : cities)
+    {
+        const Country cid(c.country);
+        if (cid.valid())
+            cityByName.emplace(std::string(cid.to2Code()) + upper(c.name), c.code3);
+    }
+
+    if (!fname.empty())
+    {
+        Records recs;
+        if (!readCsv(fname, recs) || recs.empty())
+            return false;
+
+        const std::vector<std::string> &h = recs[0];
+        const int mic = column(h, "MIC"), name = column(h, "MARKET NAME-INSTITUTION DESCRIPTION");
+        const int country = column(h, "ISO COUNTRY CODE (ISO 3166)"), city = column(h, "CITY"), status = column(h, "STATUS");
+
+        if (std::min({ mic, name, country, city, status }) < 0)
+        {
+            std::cerr << fname << ": missing column" << std::endl;
+            return false;
+        }
+
+        // new MICs are numbered in code order so the numbering does not depend on the row order of the file
+        std::vector<std::size_t> rows;
+        for (std::size_t i = 1; i < recs.size(); ++i)
+        {
+            if (recs[i].size() >= h.size() && recs[i][mic].size() == 4)
+                rows.push_back(i);
+        }
+        std::sort(rows.begin(), rows.end(), [&recs, mic]( std::size_t a, std::size_t b ) { return recs[a][mic] < recs[b][mic]; });
+
+        int next = MarketId::MAXMARKETID;
+        for (std::size_t i : rows)
+        {
+            const std::vector<std::string> &r = recs[i];
+            auto iter = byCode.find(r[mic]);
+
+            if (iter != byCode.end())
+            {
+                if (!r[name].empty())
+                    iter->second.name = r[name];
+                continue;
+            }
+
+            if (r[status] == "EXPIRED" && !expired)
+                continue;
+
+            auto c = cityByName.find(r[country] + upper(r[city]));
+            byCode[r[mic]] = MicEntry{ r[mic], r[name], (c != cityByName.end()) ? c->second : "XXX", next++ };
+        }
+    }
+
+    for (const auto &p : byCode)
+        mics.push_back(p.second);
+
+    return true;
+}
+
+static void
+writeMics( const std::string &outdir, const std::vector<MicEntry> &mics, const std::vector<CityEntry> &cities )
+{
+    const std::string fname = "MARKETID_TABLES.txt";
+    std::ofstream out(outdir + "/" + fname);
+
+    const int NUM = int(mics.size()) + 1;
+    int MAX = 0;
+    for (const MicEntry &m : mics)
+        MAX = std::max(MAX, m.id + 1);
+
+    banner(out, fname, "code", "MarketId tables, paste the enum into MarketId.h and the rest into MarketIdData.cpp and GazetteerData.cpp");
+
+    // enum, alphabetical by enum name
+    std::vector<const MicEntry*> byName;
+    for (const MicEntry &m : mics)
+        byName.push_back(&m);
+    std::sort(byName.begin(), byName.end(), []( const MicEntry *a, const MicEntry *b ) { return enumName(a->code) < enumName(b->code); });
+
+    out << "// MarketId.h\n\n    enum MarketIdCode : short {\n        NOMARKETID = 0,\n";
+    std::vector<std::string> items = { "" };
+    for (const MicEntry *m : byName)
+        items.push_back(enumName(m->code) + " = " + std::to_string(m->id));
+    writeList(out, items, 1, 10, "        ");
+    out << "        MAXMARKETID = " << MAX << ", NUMMARKETID = " << NUM << " \n    };\n\n\n// MarketIdData.cpp\n\n";
+
+    std::vector<std::string> codes = { "NOMARKET" };
+    for (const MicEntry &m : mics)
+        codes.push_back(m.code);
+
+    out << "constexpr short MarketId::m_search[28] = { \n    " << joinInts(searchBuckets(codes, true)) << " \n};\n\n\n";
+
+    std::vector<std::string> fromISO(MAX, "0");
+    for (std::size_t i = 0; i < mics.size(); ++i)
+        fromISO[mics[i].id] = std::to_string(i + 1);
+    out << "constexpr short MarketId::m_fromISO[MAXMARKETID] = {\n";
+    writeList(out, fromISO, 0, 10);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const MicEntry &m : mics)
+        items.push_back(enumName(m.code));
+    out << "constexpr short MarketId::m_toISO[NUMMARKETID] = { NOMARKETID,\n";
+    writeList(out, items, 1, 10);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const MicEntry &m : mics)
+        items.push_back(literal(m.code));
+    poolBegin(out, "codes", "MarketId::NUMMARKETID");
+    out << "\"NOMARKET\", \n";
+    writeList(out, items, 1, 10);
+    poolEnd(out, "MarketId", "codes");
+    out << "\n";
+
+    items = { "" };
+    for (const MicEntry &m : mics)
+        items.push_back(literal(m.name));
+    poolBegin(out, "fullNames", "MarketId::NUMMARKETID");
+    out << "\"No Market (Unlisted)\",\n";
+    writeList(out, items, 1, 10);
+    poolEnd(out, "MarketId", "fullNames");
+    out << "\n";
+
+    // relations
+    out << "\n// GazetteerData.cpp\n\n// MarketId to City\n";
+    items = { "" };
+    for (const MicEntry &m : mics)
+        items.push_back("City::" + m.city);
+    out << "constexpr short Gazetteer::m_mic2cty[MarketId::NUMMARKETID] = { \n    City::NOCITY,\n";
+    writeList(out, items, 1, 10);
+    out << "};\n\n";
+
+    // City to MarketIds, count prefixed lists in city order, cities without markets have XXXX
+    std::map<std::string, std::vector<std::string>> cty2mics;
+    for (const MicEntry &m : mics)
+        cty2mics[m.city].push_back("MarketId::" + enumName(m.code));
+
+    out << "static constexpr short d_NOCITY[2] = { 1, MarketId::NOMARKETID };\n";
+    for (const CityEntry &c : cities)
+    {
+        std::vector<std::string> &v = cty2mics[c.code3];
+        if (v.empty())
+            v.push_back("MarketId::XXXX");
+
+        out << "static constexpr short d_" << c.code3 << "[" << v.size() + 1 << "] = { " << v.size();
+        for (const std::string &s : v)
+            out << ", " << s;
+        out << " };\n";
+    }
+
+    items = { "" };
+    for (const CityEntry &c : cities)
+        items.push_back("d_" + c.code3);
+    out << "\nconstexpr const short * Gazetteer::m_cty2mics[City::NUMCITY] = { \n    d_NOCITY,\n";
+    writeList(out, items, 1, 10);
+    out << "};\n\n";
+}
+
+
+//
+// Locodes
+//
+static bool
+readLocodes( const std::vector<std::string> &fnames, const std::set<std::string> &statuses, std::vector<LocodeEntry> &locodes )
+{
+    std::map<std::string, LocodeEntry> byCode;
+
+    for (const std::string &fname : fnames)
+    {
+        Records recs;
+        if (!readCsv(fname, recs))
+            return false;
+
+        for (const std::vector<std::string> &r : recs)
+        {
+            // Ch, Country, Location, Name, NameWoDiacritics, SubDiv, Function, Status, Date, IATA, Coordinates, Remarks
+            if (r.size() < 11 || r[2].size() != 3 || r[1].size() != 2 || r[0] == "X")
+                continue;
+            if (!statuses.empty() && !statuses.count(r[7]))
+                continue;
+
+            LocodeEntry e;
+            e.code   = r[1] + r[2];
+            e.name   = r[3];
+            e.subdiv = r[5];
+
+            e.function = Csv::function(r[6], r[7], Csv::coordinates(r[10], e.lat, e.lon));
+
+            // a code appearing in more than one file keeps its first entry
+            byCode.emplace(e.code, e);
+        }
+    }
+
+    // the unknown location, see Locode.h
+    LocodeEntry unknown;
+    unknown.code = "XXXXX";
+    byCode.emplace(unknown.code, unknown);
+
+    for (const auto &p : byCode)
+        locodes.push_back(p.second);
+
+    return true;
+}
+
+static void
+writeLocodes( const std::string &outdir, const std::string &name, const std::vector<LocodeEntry> &locodes )
+{
+    const int NUM = int(locodes.size()) + 1;
+
+    // header
+    {
+        const std::string fname = "LOCODES_" + name + "_HEADER.h";
+        const std::string guard = "__LOCODES_" + name + "_HEADER_H__";
+        std::ofstream out(outdir + "/" + fname);
+
+        // the composition table, as in LOCODES_SMALL_HEADER.h
+        std::vector<int> count(Locode::MAXSTATUS, 0);
+        std::vector<int> coords(Locode::MAXSTATUS, 0);
+        for (const LocodeEntry &e : locodes)
+        {
+            count[e.function >> 11]++;
+            if (e.function & (1u << 10))
+                coords[e.function >> 11]++;
+        }
+
+        std::stringstream ss;
+        ss << "\n\n A set of " << NUM << " UN/LOCODE codes. Ordered alphabetically.\n\n\n";
+        ss << " UN/LOCODE Composition\n ----------------------------------------------------------------\n";
+        ss << " Status | Number of Codes | Number with Coordinates\n ----------------------------------------------------------------\n";
+        for (int i = 1; i <= Locode::MAXSTATUS; ++i)
+        {
+            const int s = i % Locode::MAXSTATUS; // NONE last
+            if (count[s])
+            {
+                const std::string label = (s) ? Locode::toString(Locode::Status(s)) : "NONE";
+                char buffer[80];
+                std::snprintf(buffer, sizeof(buffer), " %-6s | %7d         | %9d\n", label.c_str(), count[s], coords[s]);
+                ss << buffer;
+            }
+        }
+        ss << " ----------------------------------------------------------------";
+
+        banner(out, fname, "header", ss.str());
+        out << "//\n#ifndef " << guard << "\n#define " << guard << "\n\n#undef PLOSS\n#undef DEBUG\n\nnamespace LOCODE\n{\n\n";
+
+        int unknown = 0;
+        for (std::size_t i = 0; i < locodes.size(); ++i)
+        {
+            // XXXXX is defined in Locode.h
+            if (locodes[i].code == "XXXXX")
+            {
+                unknown = int(i) + 1;
+                out << "//";
+            }
+            out << "constexpr int " << locodes[i].code << " = " << i + 1 << ";\n";
+            if (i % 11 == 9)
+                out << "\n";
+        }
+        out << "\n};\n\n#endif\n\n";
+
+        std::cout << "Locode.h: XXXXX = " << unknown << ", MAXLOCODE = " << NUM << ", NUMLOCODE = " << NUM << std::endl;
+    }
+
+    // body
+    const std::string fname = "LOCODES_" + name + "_BODY.txt";
+    std::ofstream out(outdir + "/" + fname);
+    banner(out, fname, "code", "");
+    out << "using namespace LOCODE;\n\n\n\n// this speeds up setLocode a bit\n\n";
+
+    std::vector<std::string> codes = { "NOLOCODE" };
+    for (const LocodeEntry &e : locodes)
+        codes.push_back(e.code);
+    out << "constexpr int Locode::m_search[28] = {\n    " << joinInts(searchBuckets(codes, false)) << ", -1 \n};\n\n\n\n";
+
+    std::vector<std::string> items = { "" };
+    for (const LocodeEntry &e : locodes)
+        items.push_back(std::to_string(e.function));
+    out << "constexpr unsigned short Locode::m_function[NUMLOCODE] = { Function::UNKNOWN, \n";
+    writeList(out, items, 1, 11, "");
+    out << "};\n\n";
+
+    items = { "" };
+    for (const LocodeEntry &e : locodes)
+        items.push_back("{" + number(e.lat) + ", " + number(e.lon) + "}");
+    out << "constexpr float Locode::m_position[NUMLOCODE][2] = { { 0.0, 0.0 }, // NOLOCODE\n";
+    writeList(out, items, 1, 11);
+    out << "};\n\n";
+
+    items = { "" };
+    for (const LocodeEntry &e : locodes)
+        items.push_back(literal(e.code));
+    poolBegin(out, "codes", "NUMLOCODE");
+    out << "\"NOLOCODE\", \n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "Locode", "codes");
+    out << "\n";
+
+    items = { "" };
+    for (const LocodeEntry &e : locodes)
+        items.push_back(literal(e.name));
+    poolBegin(out, "fullNames", "NUMLOCODE");
+    out << "\"No Locode\",\n";
+    writeList(out, items, 1, 11);
+    poolEnd(out, "Locode", "fullNames");
+    out << "\n";
+
+    items = { "" };
+    for (const LocodeEntry &e : locodes)
+        items.push_back(literalOrNull(e.subdiv));
+    poolBegin(out, "subdiv", "NUMLOCODE");
+    out << "\"XXX\",\n";
+    writeList(out, items, 1, 11, "");
+    poolEnd(out, "Locode", "subdiv");
+}
+
+
+//
+//
+//
+static bool
+options( int argc, const char *argv[], Options &opt )
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if (arg == "-m" && hasValue)
+            opt.mics = argv[++i];
+        else if (arg == "-x")
+            opt.expired = true;
+        else if (arg == "-c" && hasValue)
+            opt.cities = argv[++i];
+        else if (arg == "-l" && hasValue)
+            opt.locodeName = upper(argv[++i]);
+        else if (arg == "-s" && hasValue)
+        {
+            std::stringstream ss(argv[++i]);
+            std::string s;
+            while (std::getline(ss, s, ','))
+                opt.statuses.insert(s);
+        }
+        else if (arg == "-o" && hasValue)
+            opt.outdir = argv[++i];
+        else if (arg[0] != '-')
+            opt.locodes.push_back(arg);
+        else return false;
+    }
+
+    return !opt.mics.empty() || !opt.cities.empty() || !opt.locodes.empty();
+}
+
+
+int
+main( int argc, const char *argv[] )
+{
+    Options opt;
+    if (!options(argc, argv, opt))
+    {
+        std::cerr << "usage: " << argv[0] << " [-m ISO10383_MIC.csv] [-x] [-c cities.csv] [-l name] [-s statuses] [-o outdir] [unlocode.csv ...]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<CityEntry> cities;
+    if (!opt.cities.empty())
+    {
+        if (!readCities(opt.cities, cities) || !numberCities(cities))
+            return EXIT_FAILURE;
+        writeCities(opt.outdir, cities);
+        std::cout << "cities  : " << cities.size() << std::endl;
+    }
+    else
+    {
+        cities = compiledCities();
+        numberCities(cities);
+    }
+
+    if (!opt.mics.empty())
+    {
+        std::vector<MicEntry> mics;
+        if (!readMics(opt.mics, opt.expired, cities, mics))
+            return EXIT_FAILURE;
+        writeMics(opt.outdir, mics, cities);
+        std::cout << "markets : " << mics.size() << std::endl;
+    }
+
+    if (!opt.locodes.empty())
+    {
+        std::vector<LocodeEntry> locodes;
+        if (!readLocodes(opt.locodes, opt.statuses, locodes))
+            return EXIT_FAILURE;
+        writeLocodes(opt.outdir, opt.locodeName, locodes);
+        std::cout << "locodes : " << locodes.size() << std::endl;
+    }
+
+    const std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start;
+    std::cout << "time    : " << secs.count() << "s" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
@@ -25,6 +25,7 @@
  std::cout << City("MAD").name() << ", " << g.country(City::MAD).name() << ", " << g.ccy( g.country(City::MAD) ).name() << std::endl;
  std::cout << Country("GB").name() << ", " << g.capital(Country::GBR).name() << ", " << g.ccy(Country::GB) << std::endl;     
  std::cout << Country(Country::CH).name() << ", " << g.capital("CHE").name() << ", " << g.ccys(Country::CHE) << std::endl;
+ std::cout << Locode("NLRTM").name() << ", " << g.city(Locode("NLRTM")).name() << ", " << g.ccy(Locode("NLRTM")) << ", " << g.locode(City::AMS) << std::endl;
  
  std::cout << "Spanish cities " << g.cities(Country::ESP) << std::endl << std::endl;
  std::cout << "Spanish markets " <<  g.markets(Country::ESP) << std::endl << std::endl;
@@ -38,6 +39,13 @@
  std::cout << "The countries of  Subregion::SOUTHERN_EUROPE" << std::endl;
  std::vector<Country> southern_europe = g.subregion(Gazetteer::Subregion::SOUTHERN_EUROPE);
  std::cout << southern_europe << std::endl;
+ 
+ // column at a time enrichment
+ std::vector<MarketId> mics = { MarketId::XLON, MarketId::XNYS, MarketId::XPAR };
+ std::vector<Currency> ccys(mics.size());
+ std::vector<Gazetteer::Region> regions(mics.size());
+ g.ccy(mics, ccys);
+ g.region(mics, regions);
 
  
  */
@@ -48,6 +56,8 @@
 
 #include <vector>
 #include <string>
+#include <span>
+#include <concepts>
 
 
 #ifndef __MARKETID_H__
@@ -66,6 +76,20 @@
 #include "Currency.h"
 #endif
 
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __SUBDIVISION_H__
+#include "Subdivision.h"
+#endif
+
+#ifndef __ENTITYSET_H__
+#include "EntitySet.h"
+#endif
+
+
+class GeoCoord;
 
 
 class Gazetteer 
@@ -143,6 +167,14 @@ public:
     std::vector<City>
     cities( const std::string &pattern ) const;
     
+    // cities whose name is within maxDist edits of name (Name::dist ignoring case and accents), closest first
+    std::vector<City>
+    cities( const std::string &name, int maxDist ) const;
+    
+    // cities within metres of p, nearest first
+    std::vector<City>
+    cities( const GeoCoord &p, double metres ) const;
+    
     std::vector<MarketId>
     markets( const City &cty ) const;
         
@@ -150,6 +182,60 @@ public:
     markets( const Country &cid ) const; 
 
     
+    //
+    // UN/LOCODEs
+    //
+    // Locode converts implicitly from int, and so from the City, Country and Currency enums, so these take exactly a
+    // Locode and g.country(City::MAD) still calls country(const City&). Pass an id as Locode::index(i).
+    //
+    template <std::same_as<Locode> L>
+    City // City::NOCITY if this locode is not a city
+    city( const L &loc ) const { return City::CityCode(locodeLink(loc).cty); }
+
+    template <std::same_as<Locode> L>
+    Country // Country::NOCOUNTRY if the country code of this locode is not an ISO country
+    country( const L &loc ) const { return Country::CountryCode(locodeLink(loc).cid); }
+
+    template <std::same_as<Locode> L>
+    Currency // the main/principal ccy of the country of this locode
+    ccy( const L &loc ) const { return Currency::CurrencyCode(locodeLink(loc).ccy); }
+
+    Locode // LOCODE::NOLOCODE if this city has no UN/LOCODE in the compiled table
+    locode( const City &cty ) const;
+
+    template <std::same_as<Locode> L>
+    City // the city of this locode, else the nearest city in its country, City::NOCITY if it is not a city and has no position
+    nearestCity( const L &loc ) const { return City::CityCode(nearLink(loc).cty); }
+
+    template <std::same_as<Locode> L>
+    double // metres from this locode to nearestCity(loc), -1 if either has no position
+    nearestCityDist( const L &loc ) const { return nearLink(loc).metres; }
+
+    template <std::same_as<Locode> L>
+    std::string // the time zone of nearestCity(loc)
+    timezone( const L &loc ) const { return nearestCity(loc).timezone(); }
+
+    template <std::same_as<Locode> L>
+    Region
+    region( const L &loc ) const { return region(country(loc)); }
+
+    
+    //
+    // Subdivisions
+    //
+    // the members of a subdivision in id order, views of tables built on first use
+    //
+    std::span<const City>
+    cities( const Subdivision &sd ) const;
+
+    std::span<const Locode>
+    locodes( const Subdivision &sd ) const;
+
+    // the markets of the cities of sd
+    std::span<const MarketId>
+    markets( const Subdivision &sd ) const;
+
+    
     //
     // Regions
     //
@@ -195,9 +281,193 @@ public:
     
     Subregion
     subregion( const MarketId &mic  ) const;
+    
+    
+    //
+    // Batch - column at a time versions of the lookups above i.e. out[i] = country(mic[i])
+    // out must be at least as long as the input column
+    //
+    void
+    country( std::span<const MarketId> mic, std::span<Country> out ) const;
+    
+    void
+    country( std::span<const City> cty, std::span<Country> out ) const;
+    
+    void
+    ccy( std::span<const MarketId> mic, std::span<Currency> out ) const;
+    
+    void
+    ccy( std::span<const City> cty, std::span<Currency> out ) const;
+    
+    void
+    ccy( std::span<const Country> cid, std::span<Currency> out ) const;
+    
+    void
+    city( std::span<const MarketId> mic, std::span<City> out ) const;
+
+    void
+    city( std::span<const Locode> loc, std::span<City> out ) const;
+
+    void
+    country( std::span<const Locode> loc, std::span<Country> out ) const;
+
+    void
+    ccy( std::span<const Locode> loc, std::span<Currency> out ) const;
+    
+    void
+    region( std::span<const MarketId> mic, std::span<Region> out ) const;
+    
+    void
+    region( std::span<const City> cty, std::span<Region> out ) const;
+    
+    void
+    region( std::span<const Country> cid, std::span<Region> out ) const;
+    
+    void
+    subregion( std::span<const MarketId> mic, std::span<Subregion> out ) const;
+    
+    void
+    subregion( std::span<const City> cty, std::span<Subregion> out ) const;
+    
+    void
+    subregion( std::span<const Country> cid, std::span<Subregion> out ) const;
+    
+    
+    //
+    // Sets - bitsets over the dense index() space, see EntitySet.h
+    //
+    const CountrySet&
+    countrySet( Region rid ) const { return m_regionSet[regionIndex(rid)]; }
+    
+    const CountrySet&
+    countrySet( Subregion rid ) const { return m_subregionSet[subregionIndex(rid)]; }
+    
+    const CountrySet& // the countries whose main/principal ccy is c - a currency union for EUR, XAF, XCD, XOF, etc
+    countrySet( const Currency &c ) const;
+    
+    CurrencySet // the main/principal ccys of these countries
+    ccySet( const CountrySet &cids ) const;
+    
+    const CitySet&
+    citySet( const Country &cid ) const;
+    
+    CitySet
+    citySet( const CountrySet &cids ) const;
+    
+    const MarketSet&
+    marketSet( const Country &cid ) const;
+    
+    MarketSet
+    marketSet( const CountrySet &cids ) const;
+    
+    const MarketSet&
+    marketSet( Region rid ) const;
+    
+    const MarketSet&
+    marketSet( Subregion rid ) const;
+    
+    MarketSet // markets whose country has c as its main/principal ccy
+    marketSet( const Currency &c ) const { return marketSet(countrySet(c)); }
         
 private:
 
+    friend class ArrowExport;
+
+    // index of the country of a city/market in the Country tables
+    static int
+    cidIndex( const City &cty ) { return Country::index(Country(Country::CountryCode(m_cty2cid[City::index(cty)]))); }
+    
+    static int
+    cidIndex( const MarketId &mic ) { return cidIndex(City(City::CityCode(m_mic2cty[MarketId::index(mic)]))); }
+
+    // position of a region/subregion in the region tables
+    static constexpr int
+    regionIndex( Region rid )
+    {
+        switch (rid)
+        {
+            case NOREGION:         return 0; break;
+            case ANTARCTIC_REGION: return 1; break;
+            case AFRICA:           return 2; break;
+            case OCEANIA:          return 3; break;
+            case AMERICAS:         return 4; break;
+            case ASIA:             return 5; break;
+            case EUROPE:           return 6; break;
+            default:               return 0; break;
+        }
+    }
+    
+    static constexpr int
+    subregionIndex( Subregion rid )
+    {
+        switch (rid)
+        {
+            case NOSUBREGION:           return 0; break;
+            case ANTARCTIC_SUBREGION:   return 1; break;
+            case SOUTH_AMERICA:         return 2; break;
+            case WESTERN_AFRICA:        return 3; break;
+            case CENTRAL_AMERICA:       return 4; break;
+            case EASTERN_AFRICA:        return 5; break;
+            case NORTHERN_AFRICA:       return 6; break;
+            case MIDDLE_AFRICA:         return 7; break;
+            case SOUTHERN_AFRICA:       return 8; break;
+            case NORTHERN_AMERICA:      return 9; break;
+            case CARIBBEAN:             return 10; break;
+            case EASTERN_ASIA:          return 11; break;
+            case SOUTHERN_ASIA:         return 12; break;
+            case SOUTH_EASTERN_ASIA:    return 13; break;
+            case SOUTHERN_EUROPE:       return 14; break;
+            case AUSTRALIA_NEW_ZEALAND: return 15; break;
+            case MELANESIA:             return 16; break;
+            case MICRONESIA:            return 17; break;
+            case POLYNESIA:             return 18; break;
+            case CENTRAL_ASIA:          return 19; break;
+            case WESTERN_ASIA:          return 20; break;
+            case EASTERN_EUROPE:        return 21; break;
+            case NORTHERN_EUROPE:       return 22; break;
+            case WESTERN_EUROPE:        return 23; break;
+            default:                    return 0; break;
+        }
+    }
+    
+    // sets that depend on the index tables of other classes are built on first use
+    struct SetTables;
+    
+    static const SetTables&
+    sets( void );
+
+    // the City, Country and Currency codes of a Locode id, and the Locode id of each city, also built on first use
+    struct LocodeLink
+    {
+        short cty;
+        short cid;
+        short ccy;
+    };
+
+    struct LinkTables;
+
+    static const LinkTables&
+    links( void );
+
+    static const LocodeLink&
+    locodeLink( int loc );
+
+    // the nearest city of a Locode id, built on the first call as it takes a distance search
+    struct NearLink
+    {
+        short cty;
+        float metres;
+    };
+
+    static const NearLink&
+    nearLink( int loc );
+
+    // the cities, locodes and markets of each subdivision as CSR (compressed sparse row) arrays
+    struct SubdivisionTables;
+
+    static const SubdivisionTables&
+    subdivisions( void );
+
     static const short m_cty2cid[City::NUMCITY]; 
     static const short m_cid2ccy[Country::NUMCOUNTRY];
     static const short m_cid2cap[Country::NUMCOUNTRY];
@@ -215,6 +485,9 @@ private:
     
     static const unsigned char m_region[Country::NUMCOUNTRY];
     static const unsigned char m_subregion[Country::NUMCOUNTRY];
+    
+    static const std::array<CountrySet, 7>  m_regionSet;
+    static const std::array<CountrySet, 24> m_subregionSet;
 };
 
 
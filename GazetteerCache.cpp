@@ -0,0 +1,268 @@
+/* GazetteerCache 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   GazetteerCache.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __GAZETTEERCACHE_H__
+#include "GazetteerCache.h"
+#endif
+
+#ifndef __NAME_H__
+#include "Name.h"
+#endif
+
+#ifndef __GEOCOORD_H__
+#include "GeoCoord.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cassert>
+
+
+//
+// ClockCache
+//
+template <typename V>
+ClockCache<V>::ClockCache( std::size_t capacity, int shards ): m_sets(0), m_shards(std::max(shards, 1))
+{
+    const std::size_t perShard = (capacity + m_shards.size() - 1) / m_shards.size();
+    m_sets = std::max<std::size_t>((perShard + WAYS - 1) / WAYS, 1);
+
+    for (Shard &s : m_shards)
+    {
+        s.slots.reset(new Slot[m_sets * WAYS]);
+        s.hands.reset(new unsigned char[m_sets]());
+    }
+}
+
+template <typename V>
+ClockCache<V>::~ClockCache( void )
+{
+    for (Shard &s : m_shards)
+    {
+        for (std::size_t i = 0; i < m_sets * WAYS; ++i)
+            delete s.slots[i].entry.load();
+        for (const std::pair<std::uint64_t, const Entry*> &r : s.retired)
+            delete r.second;
+    }
+}
+
+template <typename V>
+bool
+ClockCache<V>::find( const std::string &key, std::uint64_t generation, V &out )
+{
+    const std::size_t h = std::hash<std::string>()(key);
+    Shard &s = shard(h);
+    Slot *ways = set(s, h);
+
+    // the guard is taken before the loads, which are sequentially consistent as Epoch requires
+    Epoch::Guard guard;
+
+    for (int i = 0; i < WAYS; ++i)
+    {
+        const Entry *e = ways[i].entry.load();
+        if (!e || e->hash != h || e->key != key)
+            continue;
+
+        if (e->generation != generation)
+        {
+            s.stale.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+
+        if (!ways[i].referenced.load(std::memory_order_relaxed))
+            ways[i].referenced.store(true, std::memory_order_relaxed);
+
+        out = e->value;
+        s.hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    s.misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+template <typename V>
+void
+ClockCache<V>::insert( const std::string &key, std::uint64_t generation, V value )
+{
+    const std::size_t h = std::hash<std::string>()(key);
+    Shard &s = shard(h);
+    Slot *ways = set(s, h);
+    const std::size_t k = (ways - s.slots.get()) / WAYS;
+
+    const Entry *e = new Entry{ key, h, generation, std::move(value) };
+
+    std::lock_guard<std::mutex> lock(s.writer);
+
+    // the same key (perhaps from an older generation), else an empty or stale way
+    int victim = -1;
+    for (int i = 0; i < WAYS && victim < 0; ++i)
+    {
+        const Entry *old = ways[i].entry.load(std::memory_order_relaxed);
+        if (old && old->hash == h && old->key == key)
+            victim = i;
+    }
+    for (int i = 0; i < WAYS && victim < 0; ++i)
+    {
+        const Entry *old = ways[i].entry.load(std::memory_order_relaxed);
+        if (!old || old->generation != generation)
+            victim = i;
+    }
+
+    // second chance: the hand clears referenced ways until it finds one that has not been read since it last passed
+    if (victim < 0)
+    {
+        int hand = s.hands[k];
+        while (ways[hand].referenced.exchange(false, std::memory_order_relaxed))
+            hand = (hand + 1) % WAYS;
+
+        victim = hand;
+        s.hands[k] = (unsigned char) ((hand + 1) % WAYS);
+        s.evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ways[victim].referenced.store(false, std::memory_order_relaxed);
+    const Entry *old = ways[victim].entry.exchange(e);
+    if (old)
+        s.retired.emplace_back(Epoch::advance(), old);
+
+    // free what no lookup can still be reading
+    const std::uint64_t oldest = Epoch::oldest();
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < s.retired.size(); ++i)
+    {
+        if (s.retired[i].first <= oldest)
+            delete s.retired[i].second;
+        else s.retired[j++] = s.retired[i];
+    }
+    s.retired.resize(j);
+}
+
+template <typename V>
+typename ClockCache<V>::Stats
+ClockCache<V>::stats( void ) const
+{
+    Stats retVal;
+    for (const Shard &s : m_shards)
+    {
+        retVal.hits      += s.hits.load(std::memory_order_relaxed);
+        retVal.misses    += s.misses.load(std::memory_order_relaxed);
+        retVal.evictions += s.evictions.load(std::memory_order_relaxed);
+        retVal.stale     += s.stale.load(std::memory_order_relaxed);
+    }
+    return retVal;
+}
+
+template class ClockCache<std::vector<Country>>;
+template class ClockCache<std::vector<City>>;
+
+
+//
+// GazetteerCache
+//
+GazetteerCache::GazetteerCache( std::size_t capacity ): m_g(), m_cleared(0), m_countries(capacity / 4), m_cities(capacity)
+{
+}
+
+std::uint64_t
+GazetteerCache::generation( void ) const
+{
+    return m_cleared.load(std::memory_order_acquire);
+}
+
+template <typename V>
+V
+GazetteerCache::lookup( ClockCache<V> &cache, const std::string &key, const std::function<V(void)> &compute )
+{
+    // taken before computing, so a result that races with clear() is filed under the old generation
+    const std::uint64_t gen = generation();
+
+    V retVal;
+    if (cache.find(key, gen, retVal))
+        return retVal;
+
+    retVal = compute();
+    cache.insert(key, gen, retVal);
+    return retVal;
+}
+
+std::string
+GazetteerCache::canonicalName( const std::string &name )
+{
+    const std::string s = Name::toupper(Name::deaccent(Name::trim(name)));
+
+    std::string retVal;
+    for (char c : s)
+    {
+        const bool space = (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+        if (!space)
+            retVal += c;
+        else if (retVal.empty() || retVal.back() != ' ')
+            retVal += ' ';
+    }
+    return retVal;
+}
+
+std::string
+GazetteerCache::canonicalPosition( const GeoCoord &p, double metres )
+{
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.4f,%.4f,%.0f", std::round(p.lat() * 1e4) / 1e4, std::round(p.lon() * 1e4) / 1e4, std::round(metres));
+    return buffer;
+}
+
+std::vector<Country>
+GazetteerCache::countries( const std::string &pattern )
+{
+    return lookup<std::vector<Country>>(m_countries, "P" + pattern, [&]() { return m_g.countries(pattern); });
+}
+
+std::vector<City>
+GazetteerCache::cities( const std::string &pattern )
+{
+    return lookup<std::vector<City>>(m_cities, "P" + pattern, [&]() { return m_g.cities(pattern); });
+}
+
+std::vector<City>
+GazetteerCache::cities( const std::string &name, int maxDist )
+{
+    const std::string n = canonicalName(name);
+    return lookup<std::vector<City>>(m_cities, "N" + std::to_string(maxDist) + ":" + n, [&]() { return m_g.cities(n, maxDist); });
+}
+
+std::vector<City>
+GazetteerCache::cities( const GeoCoord &p, double metres )
+{
+    // compute for the rounded query so that every query sharing the key gets the same answer
+    const GeoCoord q(std::round(p.lat() * 1e4) / 1e4, std::round(p.lon() * 1e4) / 1e4);
+    const double r = std::round(metres);
+    return lookup<std::vector<City>>(m_cities, "G" + canonicalPosition(q, r), [&]() { return m_g.cities(q, r); });
+}
+
+GazetteerCache::Stats
+GazetteerCache::stats( void ) const
+{
+    const ClockCache<std::vector<Country>>::Stats a = m_countries.stats();
+    Stats retVal = m_cities.stats();
+    retVal.hits      += a.hits;
+    retVal.misses    += a.misses;
+    retVal.evictions += a.evictions;
+    retVal.stale     += a.stale;
+    return retVal;
+}
+
+//
+//
+//
+
@@ -0,0 +1,205 @@
+/* GazetteerCache 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   GazetteerCache.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A bounded concurrent cache in front of the Gazetteer queries that scan a whole table: the pattern searches
+ countries(pattern) and cities(pattern), the fuzzy name search cities(name, maxDist) and the radius search
+ cities(GeoCoord, metres). Services tend to repeat the same few thousand of these, each costing a regex or
+ Damerau–Levenshtein or Vincenty computation per row.
+
+ Keys are canonical queries, so near identical queries share an entry: names are trimmed, deaccented, upper cased and
+ have runs of spaces collapsed, positions are rounded to 1e-4 degrees (about 11m) and radii to the metre, and the
+ result is computed for the canonical query. Patterns are regular expressions and are used as given.
+
+ ClockCache
+
+ The cache is split into shards by key hash and each shard is a set associative table of WAYS entries per set. An entry
+ is an immutable (key, generation, value) held by a plain atomic pointer and a lookup takes an Epoch::Guard, loads the
+ pointer and copies the value out on a hit, so the read path is lock free (a std::atomic<std::shared_ptr> is not, as
+ libstdc++ implements it with a lock). Inserts take the shard's mutex, choose a victim within the set by CLOCK (second
+ chance): each hit sets a referenced bit and the hand skips and clears referenced entries, and retire the entry they
+ replace, which is freed by a later insert into the shard once no lookup can still be reading it (see Epoch.h).
+
+ Every entry records the generation it was computed in, where the generation counts clear() calls, and an entry from
+ an earlier generation is a miss. clear() therefore invalidates the whole cache at once and the stale entries are replaced
+ as they are met. The results come from the compiled Gazetteer tables, which a Snapshot::publish() does not change, so
+ publishing leaves the cache as it is.
+
+ hits, misses, evictions (valid entries replaced) and stale (misses due to an old generation) are counted per shard.
+
+ Example
+
+ GazetteerCache cache(4096);
+
+ std::vector<City> a = cache.cities("Londn", 1);   // computed
+ std::vector<City> b = cache.cities(" londn ", 1); // the same entry
+ std::vector<City> c = cache.cities(GeoCoord(51.5072, -0.1276), 50000.0);
+
+ GazetteerCache::Stats s = cache.stats();
+ std::cout << s.hits << " " << s.misses << " " << s.evictions << std::endl;
+
+ */
+
+
+#ifndef __GAZETTEERCACHE_H__
+#define __GAZETTEERCACHE_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <utility>
+#include <cstdint>
+
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __EPOCH_H__
+#include "Epoch.h"
+#endif
+
+
+class GeoCoord;
+
+
+template <typename V>
+class ClockCache
+{
+public:
+
+    static constexpr int WAYS = 4;
+
+    struct Stats
+    {
+        std::uint64_t hits      = 0;
+        std::uint64_t misses    = 0;
+        std::uint64_t evictions = 0;
+        std::uint64_t stale     = 0;
+    };
+
+    // capacity is rounded up to a whole number of sets in each shard
+    explicit ClockCache( std::size_t capacity, int shards = 16 );
+    ~ClockCache( void );
+
+    ClockCache( const ClockCache& )=delete;
+    ClockCache&
+    operator=( const ClockCache& )=delete;
+
+    // copies the value of key into out if it was computed in generation, lock free
+    bool
+    find( const std::string &key, std::uint64_t generation, V &out );
+
+    void
+    insert( const std::string &key, std::uint64_t generation, V value );
+
+    std::size_t
+    capacity( void ) const { return m_shards.size() * m_sets * WAYS; }
+
+    Stats
+    stats( void ) const;
+
+private:
+
+    struct Entry
+    {
+        std::string   key;
+        std::size_t   hash;
+        std::uint64_t generation;
+        V             value;
+    };
+
+    struct Slot
+    {
+        std::atomic<const Entry*> entry{nullptr};
+        std::atomic<bool>         referenced{false};
+    };
+
+    struct alignas(64) Shard
+    {
+        std::unique_ptr<Slot[]>          slots;  // m_sets * WAYS
+        std::unique_ptr<unsigned char[]> hands;  // the CLOCK hand of each set
+        std::mutex                       writer;
+        std::vector<std::pair<std::uint64_t, const Entry*>> retired; // (epoch, entry) replaced but perhaps still read
+
+        std::atomic<std::uint64_t>       hits{0};
+        std::atomic<std::uint64_t>       misses{0};
+        std::atomic<std::uint64_t>       evictions{0};
+        std::atomic<std::uint64_t>       stale{0};
+    };
+
+    Shard&
+    shard( std::size_t hash ) { return m_shards[hash % m_shards.size()]; }
+
+    Slot*
+    set( Shard &s, std::size_t hash ) { return s.slots.get() + ((hash / m_shards.size()) % m_sets) * WAYS; }
+
+    std::size_t          m_sets;
+    std::vector<Shard>   m_shards;
+};
+
+
+class GazetteerCache
+{
+public:
+
+    typedef ClockCache<std::vector<City>>::Stats Stats;
+
+    explicit GazetteerCache( std::size_t capacity = 4096 );
+    ~GazetteerCache( void )=default;
+
+    std::vector<Country>
+    countries( const std::string &pattern );
+
+    std::vector<City>
+    cities( const std::string &pattern );
+
+    std::vector<City>
+    cities( const std::string &name, int maxDist );
+
+    std::vector<City>
+    cities( const GeoCoord &p, double metres );
+
+    // invalidate every entry
+    void
+    clear( void ) { m_cleared.fetch_add(1); }
+
+    // the sum over both caches
+    Stats
+    stats( void ) const;
+
+    // the canonical forms used as keys
+    static std::string
+    canonicalName( const std::string &name );
+
+    static std::string
+    canonicalPosition( const GeoCoord &p, double metres );
+
+private:
+
+    std::uint64_t
+    generation( void ) const;
+
+    template <typename V>
+    V
+    lookup( ClockCache<V> &cache, const std::string &key, const std::function<V(void)> &compute );
+
+    Gazetteer                         m_g;
+    std::atomic<std::uint64_t>        m_cleared;
+    ClockCache<std::vector<Country>>  m_countries;
+    ClockCache<std::vector<City>>     m_cities;
+};
+
+
+#endif
+
+
@@ -30,6 +30,8 @@
 #endif
 
 
+#include <istream>
+#include <ostream>
 #include <cmath>
 #include <cassert>
 #include <sstream>
@@ -52,7 +54,12 @@ constexpr unsigned int GeoCoord::m_char_index_table[75] =
 constexpr char GeoCoord::m_char_map[33] =  "0123456789bcdefghjkmnpqrstuvwxyz"; 
 
 // ISO-6709 DEG format for lat/long '±DD.DDDD±DDD.DDDD' used by tzselect -c
-const std::regex GeoCoord::m_format( R"(((\+|\-)(\d\d)(\.\d+)?)((\+|\-)(\d\d\d)(\.\d+)?))" );
+const std::regex&
+GeoCoord::isoFormat( void )
+{
+    static const std::regex format( R"(((\+|\-)(\d\d)(\.\d+)?)((\+|\-)(\d\d\d)(\.\d+)?))" );
+    return format;
+}
 
 
 
@@ -89,7 +96,7 @@ GeoCoord::setGeoCoord( const std::string &str )
 // https://en.wikipedia.org/wiki/ISO_6709
 {
     std::smatch match;
-    if (std::regex_match(str, match, m_format)) 
+    if (std::regex_match(str, match, isoFormat())) 
     {
         m_lat = std::stod(match[1].str());
         m_lon = std::stod(match[5].str());
@@ -306,6 +313,26 @@ GeoCoord::dist( double lat1, double lon1, double lat2, double lon2 )
 * Calculates geodetic distance in metres between two points specified by latitude/longitude using 
 * Vincenty inverse formula for ellipsoids
 */
+{
+    double sinU1, cosU1, sinU2, cosU2;
+    reduced(lat1, sinU1, cosU1);
+    reduced(lat2, sinU2, cosU2);
+    return dist(sinU1, cosU1, sinU2, cosU2, lon2 - lon1);
+}
+
+void
+GeoCoord::reduced( double lat, double &sinU, double &cosU )
+{
+    constexpr double D2R = (M_PI / 180.0); 
+    constexpr double f = 1.0 / 298.257223563; // ellipsoid flattening;  
+
+    const double U = std::atan((1.0 - f) * std::tan(lat * D2R));
+    sinU = std::sin(U);
+    cosU = std::cos(U);
+}
+
+double
+GeoCoord::dist( double sinU1, double cosU1, double sinU2, double cosU2, double dlon )
 {
     // convert degrees to and from radians
     constexpr double D2R = (M_PI / 180.0); 
@@ -316,11 +343,7 @@ GeoCoord::dist( double lat1, double lon1, double lat2, double lon2 )
     const double b = 6356752.31424518;    // ellipsoid polar radius;   
     constexpr double f = 1.0 / 298.257223563; // ellipsoid flattening;  
     
-    double L = (lon2 - lon1) * D2R;
-    double U1 = std::atan((1.0 - f) * std::tan(lat1 * D2R));
-    double U2 = std::atan((1.0 - f) * std::tan(lat2 * D2R));
-    double sinU1 = std::sin(U1), cosU1 = std::cos(U1);
-    double sinU2 = std::sin(U2), cosU2 = std::cos(U2);
+    double L = dlon * D2R;
     
     double lambda = L; 
     double lambdaP;
@@ -67,7 +67,7 @@
 
 #include <string>
 #include <utility>
-#include <iostream>
+#include <iosfwd>
 #include <regex> 
 
 class GeoCoord
@@ -148,6 +148,14 @@ public:
     static double
     dist( double lat1, double lon1, double lat2, double lon2 );
     
+    // the sine and cosine of the reduced latitude atan((1 - f) tan(lat)) of lat in degrees, the per point part of dist()
+    static void
+    reduced( double lat, double &sinU, double &cosU );
+
+    // dist() from the reduced latitudes of the two points and the difference in longitude lon2 - lon1 in degrees
+    static double
+    dist( double sinU1, double cosU1, double sinU2, double cosU2, double dlon );
+
 
     // encode/decode Geohash string - points in degrees
     static std::string
@@ -173,7 +181,10 @@ private:
 
     static const unsigned int m_char_index_table[75];
     static const char         m_char_map[33]; 
-    static const std::regex   m_format;
+
+    // ISO-6709 DEG format, compiled on first use rather than at program start
+    static const std::regex&
+    isoFormat( void );
 
 };
 
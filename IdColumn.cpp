@@ -0,0 +1,240 @@
+/* IdColumn 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   IdColumn.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __IDCOLUMN_H__
+#include "IdColumn.h"
+#endif
+
+#include <fstream>
+#include <algorithm>
+#include <string_view>
+#include <cstring>
+#include <cassert>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace
+{
+
+constexpr char     MAGIC[8] = { 'I', 'D', 'C', 'O', 'L', 'U', 'M', 'N' };
+constexpr unsigned FORMAT   = 1;
+
+std::size_t
+padded( std::size_t n )
+{
+    return (n + 7) & ~std::size_t(7);
+}
+
+} // namespace
+
+
+IdColumn::IdColumn( void ): m_map(nullptr), m_size(0), m_data(nullptr), m_count(0), m_width(0), m_version(0)
+{
+}
+
+template <typename T>
+bool
+IdColumn::write( const std::string &fname, const IdMap &m, const T *ids, std::size_t n, int width )
+{
+    // the dictionary holds the ids that occur, in id order
+    std::vector<bool> seen(m.size(), false);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (ids[i] == 0 || int(ids[i]) >= m.size() || m.code(int(ids[i])).empty())
+            return false;
+        seen[ids[i]] = true;
+    }
+
+    std::vector<std::uint32_t> dict, offsets(1, 0);
+    std::string codes;
+    for (int i = 1; i < m.size(); ++i)
+    {
+        if (seen[i])
+        {
+            dict.push_back(std::uint32_t(i));
+            codes += m.code(i);
+            offsets.push_back(std::uint32_t(codes.size()));
+        }
+    }
+
+    Header h;
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.format     = FORMAT;
+    h.kind       = std::uint32_t(m.kind());
+    h.version    = std::uint32_t(m.version());
+    h.width      = std::uint32_t(width);
+    h.count      = n;
+    h.dictionary = std::uint32_t(dict.size());
+    h.characters = std::uint32_t(codes.size());
+
+    const std::size_t head = sizeof(Header) + dict.size() * 4 + offsets.size() * 4 + codes.size();
+    const std::string pad(padded(head) - head, '\0');
+
+    std::ofstream out(fname, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(dict.data()), std::streamsize(dict.size() * 4));
+    out.write(reinterpret_cast<const char*>(offsets.data()), std::streamsize(offsets.size() * 4));
+    out.write(codes.data(), std::streamsize(codes.size()));
+    out.write(pad.data(), std::streamsize(pad.size()));
+    out.write(reinterpret_cast<const char*>(ids), std::streamsize(n * sizeof(T)));
+
+    return bool(out);
+}
+
+bool
+IdColumn::write( const std::string &fname, const IdMap &m, const std::uint16_t *ids, std::size_t n )
+{
+    return write(fname, m, ids, n, 2);
+}
+
+bool
+IdColumn::write( const std::string &fname, const IdMap &m, const std::uint32_t *ids, std::size_t n )
+{
+    return write(fname, m, ids, n, 4);
+}
+
+template <typename T>
+bool
+IdColumn::translate( const std::vector<int> &remap )
+{
+    const T *from = static_cast<const T*>(m_data);
+    m_owned.resize(m_count * sizeof(T));
+    T *to = reinterpret_cast<T*>(m_owned.data());
+    for (std::size_t i = 0; i < m_count; ++i)
+    {
+        // a value missing from the dictionary means the file is corrupt
+        if (from[i] >= remap.size() || remap[from[i]] < 0)
+            return false;
+        to[i] = T(remap[from[i]]);
+    }
+    m_data = to;
+    return true;
+}
+
+bool
+IdColumn::open( const std::string &fname, const IdMap &m )
+{
+    close();
+
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(Header))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        return false;
+
+    const Header *h = static_cast<const Header*>(map);
+    const std::size_t d = h->dictionary;
+    const std::size_t head = padded(sizeof(Header) + d * 4 + (d + 1) * 4 + h->characters);
+
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) || h->format != FORMAT || h->kind != std::uint32_t(m.kind()) ||
+        (h->width != 2 && h->width != 4) || head + h->count * h->width != std::size_t(st.st_size))
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    const char *p = static_cast<const char*>(map) + sizeof(Header);
+    const std::uint32_t *dict    = reinterpret_cast<const std::uint32_t*>(p);
+    const std::uint32_t *offsets = dict + d;
+    const char          *codes   = reinterpret_cast<const char*>(offsets + d + 1);
+
+    bool valid = (offsets[0] == 0 && offsets[d] == h->characters);
+    for (std::size_t i = 0; i < d && valid; ++i)
+        valid = (offsets[i] <= offsets[i + 1]);
+    if (!valid)
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    // check each code against the map, noting the ids that have moved
+    std::vector<int> remap;
+    for (std::size_t i = 0; i < d; ++i)
+    {
+        const std::string_view code(codes + offsets[i], offsets[i + 1] - offsets[i]);
+        if (int(dict[i]) < m.size() && m.code(int(dict[i])) == code)
+            continue;
+
+        const int id = m.find(code);
+        if (id <= 0 || (h->width == 2 && id > 0xFFFF))
+        {
+            munmap(map, st.st_size);
+            return false;
+        }
+
+        if (remap.empty())
+        {
+            // values not in the dictionary map to -1
+            std::uint32_t top = 0;
+            for (std::size_t j = 0; j < d; ++j)
+                top = std::max(top, dict[j]);
+            remap.assign(std::size_t(top) + 1, -1);
+            for (std::size_t j = 0; j < d; ++j)
+                remap[dict[j]] = int(dict[j]);
+        }
+        remap[dict[i]] = id;
+    }
+
+    m_map     = map;
+    m_size    = st.st_size;
+    m_data    = static_cast<const char*>(map) + head;
+    m_count   = h->count;
+    m_width   = int(h->width);
+    m_version = int(h->version);
+
+    if (!remap.empty())
+    {
+        const bool ok = (m_width == 2) ? translate<std::uint16_t>(remap) : translate<std::uint32_t>(remap);
+        if (!ok)
+        {
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+IdColumn::close( void )
+{
+    if (m_map)
+        munmap(m_map, m_size);
+
+    m_map     = nullptr;
+    m_size    = 0;
+    m_data    = nullptr;
+    m_count   = 0;
+    m_width   = 0;
+    m_version = 0;
+    m_owned.clear();
+}
+
+//
+//
+//
+
@@ -0,0 +1,146 @@
+/* IdColumn 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   IdColumn.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A column of ids from an IdMap stored as a flat binary file that is read back without copying.
+
+ The values are written as they are, 2 or 4 bytes each in the byte order of the machine, behind a header that names the
+ kind of id, the IdMap version used and a dictionary of the (id, code) pairs that occur in the column. open() memory maps
+ the file and checks the dictionary against the caller's map. As an IdMap only appends, a column written with any earlier
+ version of the map matches and the values are used in place (zeroCopy() is true), so a file written years ago is read
+ at the cost of its dictionary. If the map has been rebuilt and some codes have other ids, open() translates the column
+ into memory using the dictionary; it fails only if a code is not in the map at all or the kinds differ.
+
+ File
+
+ header     : "IDCOLUMN", format version, kind, map version, width, count, dictionary size, dictionary characters
+ dictionary : ids uint32[size], offsets uint32[size + 1], codes char[characters], padded to 8 bytes
+ values     : uint16[count] or uint32[count]
+
+ Example
+
+ IdMap m;
+ m.load("markets.idmap");
+
+ std::vector<std::uint16_t> venue;  // one per tick, venue.push_back(m.id(mic))
+ IdColumn::write("venue.ids", m, venue.data(), venue.size());
+
+ IdColumn c;
+ if (c.open("venue.ids", m))
+ {
+     const std::uint16_t *v = c.data16(); // straight from the file when c.zeroCopy()
+     for (std::size_t i = 0; i < c.size(); ++i)
+         std::cout << m.code(v[i]) << std::endl;
+ }
+
+ */
+
+
+#ifndef __IDCOLUMN_H__
+#define __IDCOLUMN_H__
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+#ifndef __IDMAP_H__
+#include "IdMap.h"
+#endif
+
+
+
+class IdColumn
+{
+public:
+
+    IdColumn( void );
+    ~IdColumn( void ) { close(); }
+
+    IdColumn( const IdColumn& )=delete;
+    IdColumn&
+    operator=( const IdColumn& )=delete;
+
+    // false if an id is not mapped in m or the file cannot be written
+    static bool
+    write( const std::string &fname, const IdMap &m, const std::uint16_t *ids, std::size_t n );
+
+    static bool
+    write( const std::string &fname, const IdMap &m, const std::uint32_t *ids, std::size_t n );
+
+    // false if the file cannot be mapped, is not a column of the kind of m, uses a code m does not have or, when the
+    // column must be translated, holds a value its dictionary does not list
+    bool
+    open( const std::string &fname, const IdMap &m );
+
+    void
+    close( void );
+
+    std::size_t
+    size( void ) const { return m_count; }
+
+    // 2 or 4 bytes a value, 0 if not open
+    int
+    width( void ) const { return m_width; }
+
+    // the version of the IdMap the column was written with
+    int
+    version( void ) const { return m_version; }
+
+    // true if the values are read from the mapped file
+    bool
+    zeroCopy( void ) const { return m_count && m_owned.empty(); }
+
+    // the values, null unless of that width
+    const std::uint16_t*
+    data16( void ) const { return (m_width == 2) ? static_cast<const std::uint16_t*>(m_data) : nullptr; }
+
+    const std::uint32_t*
+    data32( void ) const { return (m_width == 4) ? static_cast<const std::uint32_t*>(m_data) : nullptr; }
+
+    int
+    operator[]( std::size_t i ) const { return (m_width == 2) ? data16()[i] : int(data32()[i]); }
+
+private:
+
+    struct Header
+    {
+        char          magic[8];
+        std::uint32_t format;
+        std::uint32_t kind;
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint64_t count;
+        std::uint32_t dictionary;
+        std::uint32_t characters;
+    };
+
+    template <typename T>
+    static bool
+    write( const std::string &fname, const IdMap &m, const T *ids, std::size_t n, int width );
+
+    template <typename T>
+    bool
+    translate( const std::vector<int> &remap );
+
+    void         *m_map;
+    std::size_t   m_size;
+    const void   *m_data;
+    std::size_t   m_count;
+    int           m_width;
+    int           m_version;
+
+    // the translated values when the dictionary does not match the map
+    std::vector<unsigned char> m_owned;
+};
+
+
+#endif
+
+
@@ -0,0 +1,299 @@
+/* IdMap 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   IdMap.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __IDMAP_H__
+#include "IdMap.h"
+#endif
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __CURRENCY_H__
+#include "Currency.h"
+#endif
+
+#ifndef __MARKETID_H__
+#include "MarketId.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cassert>
+
+
+namespace
+{
+
+const char * const s_kinds[IdMap::MAXKIND] = { "NOKIND", "COUNTRY", "CURRENCY", "MARKETID", "CITY", "LOCODE" };
+
+} // namespace
+
+
+const char*
+IdMap::toString( Kind k )
+{
+    return (k >= NOKIND && k < MAXKIND) ? s_kinds[k] : s_kinds[NOKIND];
+}
+
+std::vector<std::pair<int, std::string>>
+IdMap::table( Kind k )
+{
+    std::vector<std::pair<int, std::string>> retVal;
+    switch (k)
+    {
+        case COUNTRY:
+            for (int i = 1; i < Country::NUMCOUNTRY; ++i)
+                retVal.emplace_back(short(Country::index(i)), Country::index(i).to3Code());
+            break;
+        case CURRENCY:
+            for (int i = 1; i < Currency::NUMCURRENCY; ++i)
+                retVal.emplace_back(short(Currency::index(i)), Currency::index(i).to3Code());
+            break;
+        case MARKETID:
+            for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+                retVal.emplace_back(short(MarketId::index(i)), MarketId::index(i).to4Code());
+            break;
+        case CITY:
+            for (int i = 1; i < City::NUMCITY; ++i)
+                retVal.emplace_back(short(City::index(i)), City::index(i).locode());
+            break;
+        case LOCODE:
+            for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+                retVal.emplace_back(int(Locode::index(i)), Locode::index(i).locode());
+            break;
+        default:
+            break;
+    }
+    return retVal;
+}
+
+IdMap
+IdMap::compiled( Kind k )
+{
+    IdMap retVal(k);
+    retVal.m_version = 1;
+
+    const std::vector<std::pair<int, std::string>> t = table(k);
+    int n = 1;
+    for (const auto &e : t)
+        n = std::max(n, e.first + 1);
+
+    retVal.m_codes.assign(n, std::string());
+    retVal.m_added.assign(n, 0);
+    retVal.m_retired.assign(n, 0);
+    for (const auto &e : t)
+    {
+        retVal.m_codes[e.first] = e.second;
+        retVal.m_added[e.first] = 1;
+        retVal.m_ids[e.second]  = e.first;
+    }
+
+    retVal.link();
+    return retVal;
+}
+
+void
+IdMap::link( void )
+{
+    m_toCurrent.assign(m_codes.size(), 0);
+    m_fromCurrent.clear();
+
+    for (const auto &e : table(m_kind))
+    {
+        if (e.first >= int(m_fromCurrent.size()))
+            m_fromCurrent.resize(e.first + 1, -1);
+
+        const int i = find(e.second);
+        m_fromCurrent[e.first] = i;
+        if (i > 0)
+            m_toCurrent[i] = e.first;
+    }
+}
+
+bool
+IdMap::load( const std::string &fname )
+{
+    std::ifstream in(fname);
+    if (!in)
+        return false;
+
+    std::string line;
+    if (!std::getline(in, line))
+        return false;
+
+    std::vector<std::string> f = Csv::split(line);
+    if (f.size() != 3 || f[0] != "idmap")
+        return false;
+
+    IdMap m;
+    for (int k = COUNTRY; k < MAXKIND; ++k)
+    {
+        if (f[1] == s_kinds[k])
+            m.m_kind = Kind(k);
+    }
+    m.m_version = std::atoi(f[2].c_str());
+    if (m.m_kind == NOKIND || m.m_version <= 0)
+        return false;
+
+    m.m_codes.assign(1, std::string());
+    m.m_added.assign(1, 0);
+    m.m_retired.assign(1, 0);
+    while (std::getline(in, line))
+    {
+        f = Csv::split(line);
+        if (f.empty() || (f.size() == 1 && f[0].empty()))
+            continue;
+
+        const int i = (f.size() == 4) ? std::atoi(f[0].c_str()) : 0;
+        // ids are increasing and a code appears once
+        if (i < int(m.m_codes.size()) || f[1].empty() || m.m_ids.count(f[1]))
+            return false;
+
+        m.m_codes.resize(i + 1);
+        m.m_added.resize(i + 1, 0);
+        m.m_retired.resize(i + 1, 0);
+        m.m_codes[i]   = f[1];
+        m.m_added[i]   = std::atoi(f[2].c_str());
+        m.m_retired[i] = std::atoi(f[3].c_str());
+        m.m_ids[f[1]]  = i;
+    }
+
+    m.link();
+    *this = std::move(m);
+    return true;
+}
+
+bool
+IdMap::save( const std::string &fname ) const
+{
+    std::ofstream out(fname);
+    out << "idmap," << toString(m_kind) << "," << m_version << "\n";
+    for (int i = 1; i < size(); ++i)
+    {
+        if (!m_codes[i].empty())
+            out << i << "," << m_codes[i] << "," << m_added[i] << "," << m_retired[i] << "\n";
+    }
+    return bool(out);
+}
+
+int
+IdMap::update( const std::vector<std::string> &codes )
+{
+    if (m_codes.empty())
+    {
+        m_codes.assign(1, std::string());
+        m_added.assign(1, 0);
+        m_retired.assign(1, 0);
+    }
+
+    ++m_version;
+
+    std::unordered_map<std::string, int> present;
+    int retVal = 0;
+    for (const std::string &c : codes)
+    {
+        if (c.empty() || present.count(c))
+            continue;
+
+        int i = find(c);
+        if (i < 0)
+        {
+            i = size();
+            m_codes.push_back(c);
+            m_added.push_back(m_version);
+            m_retired.push_back(0);
+            m_ids[c] = i;
+            ++retVal;
+        }
+        else if (m_retired[i])
+            m_retired[i] = 0; // a code that comes back keeps its id
+
+        present[c] = i;
+    }
+
+    for (int i = 1; i < size(); ++i)
+    {
+        if (!m_codes[i].empty() && !m_retired[i] && !present.count(m_codes[i]))
+            m_retired[i] = m_version;
+    }
+
+    link();
+    return retVal;
+}
+
+int
+IdMap::find( std::string_view code ) const
+{
+    auto iter = m_ids.find(std::string(code));
+    return (iter == m_ids.end()) ? -1 : iter->second;
+}
+
+int
+IdMap::id( const Country &c ) const
+{
+    assert(m_kind == COUNTRY);
+    return fromCurrent(short(c));
+}
+
+int
+IdMap::id( const Currency &c ) const
+{
+    assert(m_kind == CURRENCY);
+    return fromCurrent(short(c));
+}
+
+int
+IdMap::id( const MarketId &c ) const
+{
+    assert(m_kind == MARKETID);
+    return fromCurrent(short(c));
+}
+
+int
+IdMap::id( const City &c ) const
+{
+    assert(m_kind == CITY);
+    return fromCurrent(short(c));
+}
+
+int
+IdMap::id( const Locode &c ) const
+{
+    assert(m_kind == LOCODE);
+    return fromCurrent(int(c));
+}
+
+std::string
+IdMap::code( int id ) const
+{
+    return (id > 0 && id < size()) ? m_codes[id] : std::string();
+}
+
+//
+//
+//
+
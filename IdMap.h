@@ -0,0 +1,170 @@
+/* IdMap 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   IdMap.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A persistent, versioned mapping between codes and the small integers stored in place of them.
+
+ The numeric value of a Country, Currency, MarketId, City or Locode is fixed only for one build of the library: Locode ids
+ are alphabetical, so every new code moves the ones after it, and the MarketId and City values are arbitrary. A file of
+ such values written today may mean something else after a data update. An IdMap is kept under version control next to
+ the data that uses it and gives each code an id that never changes: update() appends the codes it has not seen, marks the
+ codes that have gone as retired and bumps the version, and an id is never reused. A value written with any earlier
+ version of the map means the same code in every later version.
+
+ compiled() starts a map from this build, the id of a code being its current value (i.e. MarketId::XLON), so values
+ already written by the program stay valid. After that the map is only changed by update().
+
+ File (one header line, then one line per id in id order, ids with no code are left out)
+
+ idmap,<kind>,<version>
+ <id>,<code>,<version added>,<version retired or 0>
+
+ The code is the ISO 3 letter code of a Country or Currency, the MIC of a MarketId and the 5 character UN/LOCODE of a City or Locode.
+
+ Example
+
+ // once
+ IdMap::compiled(IdMap::MARKETID).save("markets.idmap");
+
+ // on each data update
+ IdMap m;
+ if (m.load("markets.idmap"))
+ {
+     std::vector<std::string> mics;
+     for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+         mics.push_back(MarketId::index(i).to4Code());
+     std::cout << m.update(mics) << " new MICs in version " << m.version() << std::endl;
+     m.save("markets.idmap");
+ }
+
+ // in the archive writer and reader
+ int id = m.id(MarketId("XLON"));
+ MarketId x = MarketId::MarketIdCode(m.current(id)); // NOMIC if the MIC is not compiled into this build
+
+ */
+
+
+#ifndef __IDMAP_H__
+#define __IDMAP_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+
+class Country;
+class Currency;
+class MarketId;
+class City;
+class Locode;
+
+
+class IdMap
+{
+public:
+
+    enum Kind { NOKIND = 0, COUNTRY, CURRENCY, MARKETID, CITY, LOCODE, MAXKIND };
+
+    explicit IdMap( Kind k = NOKIND ): m_kind(k), m_version(0) {}
+    ~IdMap( void )=default;
+
+    // the values of the compiled table as version 1
+    static IdMap
+    compiled( Kind k );
+
+    // false if the file cannot be read or is malformed, leaving the map unchanged
+    bool
+    load( const std::string &fname );
+
+    bool
+    save( const std::string &fname ) const;
+
+    // map the codes not yet mapped, retire the mapped codes not in codes and bump the version, returns the number of new ids
+    int
+    update( const std::vector<std::string> &codes );
+
+    Kind
+    kind( void ) const { return m_kind; }
+
+    int
+    version( void ) const { return m_version; }
+
+    // ids are in [1, size())
+    int
+    size( void ) const { return int(m_codes.size()); }
+
+    //
+    // code to id, -1 if unmapped
+    //
+    int
+    find( std::string_view code ) const;
+
+    int
+    id( const Country &c ) const;
+
+    int
+    id( const Currency &c ) const;
+
+    int
+    id( const MarketId &c ) const;
+
+    int
+    id( const City &c ) const;
+
+    int
+    id( const Locode &c ) const;
+
+    //
+    // id to code
+    //
+    // empty if unmapped
+    std::string
+    code( int id ) const;
+
+    bool
+    retired( int id ) const { return id > 0 && id < size() && m_retired[id] != 0; }
+
+    int
+    added( int id ) const { return (id > 0 && id < size()) ? m_added[id] : 0; }
+
+    // the value of id in this build e.g. a MarketId::MarketIdCode, 0 if the code is not compiled in
+    int
+    current( int id ) const { return (id > 0 && id < int(m_toCurrent.size())) ? m_toCurrent[id] : 0; }
+
+    static const char*
+    toString( Kind k );
+
+private:
+
+    int
+    fromCurrent( int value ) const { return (value > 0 && value < int(m_fromCurrent.size())) ? m_fromCurrent[value] : -1; }
+
+    // (value, code) of each entry of the compiled table
+    static std::vector<std::pair<int, std::string>>
+    table( Kind k );
+
+    // rebuild m_toCurrent and m_fromCurrent from the compiled table
+    void
+    link( void );
+
+    Kind                                  m_kind;
+    int                                   m_version;
+    std::vector<std::string>              m_codes;   // by id, m_codes[0] is empty
+    std::vector<int>                      m_added;
+    std::vector<int>                      m_retired;
+    std::unordered_map<std::string, int>  m_ids;
+    std::vector<int>                      m_toCurrent;
+    std::vector<int>                      m_fromCurrent;
+};
+
+
+#endif
+
+
@@ -29,8 +29,16 @@ UN/LOCODEs
 #include "GeoCoord.h"
 #endif
 
-#ifndef __LOCODE_H__
-#include "Locode.h"
+#ifndef __LOCODECODES_H__
+#include "LocodeCodes.h"
+#endif
+
+#ifndef __LOCODEINDEX_H__
+#include "LocodeIndex.h"
+#endif
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
 #endif
 
 template <typename T>
@@ -196,30 +204,24 @@ demoLOCODE( void )
 
     
     std::cout << "\n UN/LOCODE Composition" << std::endl;
-    std::vector<int> status(Locode::MAXSTATUS, 0);
-    std::vector<int> coords(Locode::MAXSTATUS, 0);
-    int  total = 0;
-    int sum = 0;
-    for( int i = 0; i < LOCODE::MAXLOCODE; ++i)
-    {
-        Locode code(i);
-        ++status[code.status()]; 
-        sum++;
-        if (code.valid_pos()) 
-        {
-            ++coords[code.status()];
-            ++total;
-        }
-    }
-   
+    const RoaringBitmap &positions = LocodeIndex::validPos();
+    std::uint64_t total = positions.count();
+    std::uint64_t sum = 0;
     for( int i = 0; i < Locode::MAXSTATUS; ++i)
     {
+        const RoaringBitmap &status = LocodeIndex::status(Locode::Status(i));
         std::string stat = Locode::toString(Locode::Status(i));
-        std::cout << stat << ", " << status[i] << ", " << coords[i] << std::endl;
+        std::cout << stat << ", " << status.count() << ", " << (status & positions).count() << std::endl;
+        sum += status.count();
     }
     std::cout  << sum << ", " << total << std::endl;
     std::cout << "Position coverage of " << 100.0 * total / double(sum) << "%" << std::endl;
 
+    std::cout << "\nSeaports with rail in NL with status AI" << std::endl;
+    RoaringBitmap ports = LocodeIndex::country(Country::NL) & LocodeIndex::has(Locode::SEAPORT) &
+                          LocodeIndex::has(Locode::RAIL) & LocodeIndex::status(Locode::AI);
+    ports.forEach([]( std::uint32_t i ) { std::cout << Locode::index(i).locode() << " " << Locode::index(i).name() << std::endl; });
+
 }
 
 
@@ -14,6 +14,21 @@
 #include "Locode.h"
 #endif
 
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __SUBDIVISION_H__
+#include "Subdivision.h"
+#endif
+
+#ifndef __PHONETICINDEX_H__
+#include "PhoneticIndex.h"
+#endif
+
+#include <istream>
+#include <ostream>
+#include <algorithm>
 #include <cassert>
 
     
@@ -91,6 +106,63 @@ Locode::setLocode( const std::string &str )
     return false;
 }
 
+Subdivision
+Locode::subdivision( void ) const
+{
+    return Subdivision::of(*this);
+}
+
+std::vector<Locode>
+Locode::soundsLike( const std::string &name )
+{
+    // built on first use; id 0 and XXXXX are not locations
+    static const PhoneticIndex *keys = [](){
+        std::vector<std::string> names(LOCODE::NUMLOCODE);
+        for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+            if (i != LOCODE::XXXXX)
+                names[i] = index(i).name();
+        return new PhoneticIndex(names);
+    }();
+
+    std::vector<Locode> retVal;
+    for (int i : keys->find(name))
+        retVal.push_back(index(i));
+    return retVal;
+}
+
+std::pair<int,int>
+Locode::range( const Country &c )
+{
+    const std::string code = c.to2Code();
+    const int index = (code.size() == 2) ? code[0] - 'A' : -1;
+    if (index < 0 || index > 25)
+        return std::pair<int,int>(0, 0);
+
+    // the codes of the initial letter, then those with the second letter
+    const char second = code[1];
+    int low  = m_search[index];
+    int high = m_search[index + 1];
+
+    while (low < high)
+    {
+        const int mid = (low + high) >> 1;
+        if (m_codes[mid][1] < second)
+            low = mid + 1;
+        else high = mid;
+    }
+
+    int last = low;
+    high = m_search[index + 1];
+    while (last < high)
+    {
+        const int mid = (last + high) >> 1;
+        if (m_codes[mid][1] <= second)
+            last = mid + 1;
+        else high = mid;
+    }
+
+    return std::pair<int,int>(low, last);
+}
 
 std::string 
 Locode::toString( Locode::Function f )
@@ -141,11 +213,6 @@ Locode::toString( Status s )
 }
 
 
-
-#ifdef __LARGE__
-#include "LOCODES_LARGE_BODY.txt"
-#else
-#include "LOCODES_SMALL_BODY.txt"
-#endif
+// the tables are in LocodeData.cpp
 
 
@@ -106,12 +106,21 @@
 
 
 #include <string>
-#include <iostream>
+#include <utility>
+#include <vector>
+#include <iosfwd>
+
+#ifndef __STRINGPOOL_H__
+#include "StringPool.h"
+#endif
 
 // #define __LARGE__
 
 // Note  NOLOCODE, XXXXX, MAXLOCODE, NUMLOCODE are not UN/LOCODE codes.
 
+// The numeric codes for every location i.e. LOCODE::USNYC are not needed to use this class and are not included here,
+// as they are large (LOCODES_LARGE_HEADER.h has 116k) and slow to compile. Include LocodeCodes.h where they are used.
+
 
 #ifdef __LARGE__
 
@@ -122,12 +131,6 @@ constexpr int XXXXX     = 114967;
 constexpr int MAXLOCODE = 115985;
 constexpr int NUMLOCODE = 115985;
 };
-// These defs are NOT necessary for compilation
-// only need to be included where numeric LOCODEs i.e LOCODE::USNYC are being used 
-// it is included here for convenience
-#ifndef __LOCODES_LARGE_HEADER_H__
-#include "LOCODES_LARGE_HEADER.h"
-#endif
 
 #else
 
@@ -140,17 +143,14 @@ constexpr int XXXXX     = 26687;
 constexpr int MAXLOCODE = 26857;
 constexpr int NUMLOCODE = 26857;
 };
-// These defs are NOT necessary for compilation
-// only need to be included where numeric LOCODEs i.e LOCODE::USNYC are being used 
-// it is included here for convenience
-#ifndef __LOCODES_SMALL_HEADER_H__
-#include "LOCODES_SMALL_HEADER.h"
-#endif 
 
 #endif
 
 
 
+class Country;
+class Subdivision;
+
 class Locode
 {
 public:
@@ -211,6 +211,10 @@ public:
     // the 3 letter subdivison code for this location e.g. LDN
     std::string
     subdiv( void ) const { return (m_subdiv[m_locode]) ? m_subdiv[m_locode] : "XXX"; }
+
+    // the ISO 3166-2 subdivision e.g. GB-LND, see Subdivision
+    Subdivision
+    subdivision( void ) const;
     
     bool
     setLocode( const std::string &s ); // e.g. s = "GBLON"
@@ -253,6 +257,14 @@ public:
     
     static int
     index( const Locode &c ) { return c; }
+
+    // the ids [first, second) of the locodes in country c, which are contiguous as the codes are sorted
+    static std::pair<int,int>
+    range( const Country &c );
+
+    // the locodes whose names have the Name::nysiis() key of name, in id order; a first filter before Name::dist()
+    static std::vector<Locode>
+    soundsLike( const std::string &name );
     
     static std::string 
     toString( Locode::Function s );
@@ -262,14 +274,17 @@ public:
 
 private:
     
+    friend class ArrowExport;
+    friend class LocodeStore;
+    
     int m_locode;
     
     static const int             m_search[28]; 
     static const unsigned short  m_function[LOCODE::NUMLOCODE]; 
     static const float           m_position[LOCODE::NUMLOCODE][2];    
-    static const char * const    m_codes[LOCODE::NUMLOCODE];
-    static const char * const    m_fullNames[LOCODE::NUMLOCODE];
-    static const char * const    m_subdiv[LOCODE::NUMLOCODE];
+    static const StringPool      m_codes;
+    static const StringPool      m_fullNames;
+    static const StringPool      m_subdiv;
 
 };
 
@@ -280,6 +295,14 @@ operator<<( std::ostream &ostr, const Locode &c );
 std::istream&
 operator>>( std::istream &istr, Locode &c );
 
+// hashed by the id
+template <>
+struct std::hash<Locode>
+{
+    std::size_t
+    operator()( const Locode &c ) const noexcept { return std::size_t(int(c)); }
+};
+
 
 #endif
 
@@ -0,0 +1,50 @@
+/* LocodeCodes 19/10/2026
+ 
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeCodes.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ 
+ by W.B. Yates    
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:  
+
+ Locode together with the numeric code of every location i.e. LOCODE::USNYC.
+ 
+ Locode.h does not declare these as there are 26857 (LOCODES_SMALL_HEADER.h) or 115985 (LOCODES_LARGE_HEADER.h) of them,
+ which is most of the cost of compiling a file that uses Locode. Include this header instead of Locode.h where the
+ constants are used. The header is self contained, so it may also be compiled once as a C++20 header unit and imported
+ e.g. with g++ -std=c++20 -fmodules-ts -fmodule-header LocodeCodes.h then import "LocodeCodes.h";
+ 
+ Example
+ 
+ Locode nyc(LOCODE::USNYC);
+ 
+ */
+
+
+#ifndef __LOCODECODES_H__
+#define __LOCODECODES_H__
+
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifdef __LARGE__
+
+#ifndef __LOCODES_LARGE_HEADER_H__
+#include "LOCODES_LARGE_HEADER.h"
+#endif
+
+#else
+
+#ifndef __LOCODES_SMALL_HEADER_H__
+#include "LOCODES_SMALL_HEADER.h"
+#endif 
+
+#endif
+
+
+#endif
+
+
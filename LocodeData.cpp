@@ -0,0 +1,27 @@
+/* LocodeData 19/10/2026
+ 
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeData.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ 
+ by W.B. Yates    
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:  
+
+ The Locode tables, see Locode.cpp. These are compiled separately so that changes to the code do not recompile the data
+ and vice versa. The tables are generated by GENERATE_main.cpp.
+ 
+ */
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+
+#ifdef __LARGE__
+#include "LOCODES_LARGE_BODY.txt"
+#else
+#include "LOCODES_SMALL_BODY.txt"
+#endif
+
+
@@ -0,0 +1,74 @@
+/* LocodeIndex 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeIndex.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __LOCODEINDEX_H__
+#include "LocodeIndex.h"
+#endif
+
+#include <bit>
+#include <cassert>
+
+
+const LocodeIndex::Index&
+LocodeIndex::index( void )
+{
+    static const Index x = []() {
+        Index retVal;
+        for (int i = 0; i < LOCODE::MAXLOCODE; ++i)
+        {
+            const Locode c = Locode::index(i);
+            for (int f = 0; f < NUMFUNCTION; ++f)
+            {
+                if (c.has(Locode::Function(1u << f)))
+                    retVal.function[f].add(i);
+            }
+            retVal.status[c.status()].add(i);
+            if (c.valid_pos())
+                retVal.validPos.add(i);
+        }
+        return retVal;
+    }();
+    return x;
+}
+
+const RoaringBitmap&
+LocodeIndex::has( Locode::Function f )
+{
+    assert(std::has_single_bit(unsigned(f)) && f < Locode::MAXFUNCTION);
+    return index().function[std::countr_zero(unsigned(f))];
+}
+
+const RoaringBitmap&
+LocodeIndex::status( Locode::Status s )
+{
+    assert(s < Locode::MAXSTATUS);
+    return index().status[s];
+}
+
+const RoaringBitmap&
+LocodeIndex::validPos( void )
+{
+    return index().validPos;
+}
+
+RoaringBitmap
+LocodeIndex::country( const Country &c )
+{
+    const std::pair<int,int> r = Locode::range(c);
+    return RoaringBitmap::range(r.first, r.second);
+}
+
+//
+//
+//
+
@@ -0,0 +1,87 @@
+/* LocodeIndex 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeIndex.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Bitmap indexes over the compiled Locode table for filtering without scanning it.
+
+ Locode::has() and Locode::status() read one entry of the packed function column, so a question such as "which codes are
+ seaports" is a scan of every entry. LocodeIndex holds a RoaringBitmap of Locode ids for each function flag, each status
+ and for valid_pos(), built in one pass over the table on first use, and a query becomes the intersection of the
+ bitmaps it names, with the country taken from Locode::range(). Counts are the popcounts of the results.
+
+ The bitmaps cover every id in [0, LOCODE::MAXLOCODE), so NOLOCODE is counted under NOSTATUS as in a scan of the table.
+ They are read only once built and may be used from any number of threads. For a single country a scan of its
+ Locode::range() is a few hundred entries and is quicker still than intersecting the bitmaps.
+
+ Example
+
+ // the seaports with a rail terminal in the Netherlands with status AI
+ RoaringBitmap r = LocodeIndex::country(Country::NL) & LocodeIndex::has(Locode::SEAPORT) & LocodeIndex::has(Locode::RAIL) &
+                   LocodeIndex::status(Locode::AI);
+
+ r.forEach([]( std::uint32_t id ) { std::cout << Locode::index(id).name() << std::endl; });
+
+ std::cout << (LocodeIndex::status(Locode::AI) & LocodeIndex::validPos()).count() << std::endl;
+
+ */
+
+
+#ifndef __LOCODEINDEX_H__
+#define __LOCODEINDEX_H__
+
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __ROARINGBITMAP_H__
+#include "RoaringBitmap.h"
+#endif
+
+
+class Country;
+
+
+class LocodeIndex
+{
+public:
+
+    // the ids with function f, a single flag e.g. Locode::SEAPORT
+    static const RoaringBitmap&
+    has( Locode::Function f );
+
+    static const RoaringBitmap&
+    status( Locode::Status s );
+
+    static const RoaringBitmap&
+    validPos( void );
+
+    // the ids of Locode::range(c)
+    static RoaringBitmap
+    country( const Country &c );
+
+private:
+
+    static constexpr int NUMFUNCTION = 10; // the flags SEAPORT to CROSSING
+
+    struct Index
+    {
+        RoaringBitmap function[NUMFUNCTION];
+        RoaringBitmap status[Locode::MAXSTATUS];
+        RoaringBitmap validPos;
+    };
+
+    static const Index&
+    index( void );
+};
+
+
+#endif
+
+
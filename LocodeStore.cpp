@@ -0,0 +1,418 @@
+/* LocodeStore 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeStore.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __LOCODESTORE_H__
+#include "LocodeStore.h"
+#endif
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cassert>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace
+{
+
+constexpr char     MAGIC[8] = { 'L', 'O', 'C', 'O', 'D', 'E', 'S', 0 };
+constexpr unsigned VERSION  = 3;
+
+struct Row
+{
+    std::string    name;
+    std::uint32_t  subdiv   = 0;
+    float          lat      = 0.0f;
+    float          lon      = 0.0f;
+    unsigned short function = 0;
+};
+
+template <typename T>
+bool
+write( std::ofstream &out, const std::vector<T> &v )
+{
+    out.write(reinterpret_cast<const char*>(v.data()), std::streamsize(v.size() * sizeof(T)));
+    return bool(out);
+}
+
+} // namespace
+
+
+LocodeStore::LocodeStore( void ): m_map(nullptr), m_size(0), m_count(0), m_codes(nullptr), m_names(nullptr), m_blob(nullptr),
+                                  m_subdiv(nullptr), m_position(nullptr), m_function(nullptr), m_symbols()
+{
+}
+
+std::uint32_t
+LocodeStore::pack( std::string_view code )
+{
+    // '0' to 'Z' are 1 to 43, which keeps the order of the codes
+    std::uint32_t retVal = 0;
+    for (char c : code)
+    {
+        if (c < '0' || c > 'Z')
+            return 0;
+        retVal = (retVal << 6) | std::uint32_t(c - '0' + 1);
+    }
+    return retVal;
+}
+
+std::string
+LocodeStore::unpack( std::uint32_t code, int length )
+{
+    std::string retVal(length, ' ');
+    for (int i = length - 1; i >= 0; --i, code >>= 6)
+        retVal[i] = char((code & 63) + '0' - 1);
+    return retVal;
+}
+
+const LocodeStore::HotTier&
+LocodeStore::hotTier( void )
+{
+    static const HotTier t = []() {
+        HotTier retVal;
+        retVal.codes[0] = 0;
+        for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+            retVal.codes[i] = pack(Locode::index(i).locode());
+
+        // the codes are sorted so the initial letters are in order
+        int j = 1;
+        for (int k = 0; k < 27; ++k)
+        {
+            while (j < LOCODE::NUMLOCODE && retVal.codes[j] >> 24 < std::uint32_t('A' + k - '0' + 1))
+                ++j;
+            retVal.first[k] = j;
+        }
+        return retVal;
+    }();
+    return t;
+}
+
+int
+LocodeStore::find( std::string_view code ) const
+{
+    if (code.size() != 5 || code[0] < 'A' || code[0] > 'Z')
+        return -1;
+
+    const std::uint32_t p = pack(code);
+    if (!p)
+        return -1;
+
+    const HotTier &h = hotTier();
+    const int k = code[0] - 'A';
+    const std::uint32_t *first = h.codes + h.first[k];
+    const std::uint32_t *last  = h.codes + h.first[k + 1];
+    const std::uint32_t *iter  = std::lower_bound(first, last, p);
+    if (iter != last && *iter == p)
+        return int(iter - h.codes);
+
+    if (m_count)
+    {
+        iter = std::lower_bound(m_codes, m_codes + m_count, p);
+        if (iter != m_codes + m_count && *iter == p)
+            return LOCODE::NUMLOCODE + int(iter - m_codes);
+    }
+
+    return -1;
+}
+
+std::string
+LocodeStore::code( int id ) const
+{
+    assert(id > 0 && id < size());
+    return (hot(id)) ? Locode::index(id).locode() : unpack(m_codes[id - LOCODE::NUMLOCODE], 5);
+}
+
+std::string
+LocodeStore::name( int id ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+        return Locode::index(id).name();
+
+    const std::string_view c = coded(id);
+    return m_symbols.decode(c.data(), c.size());
+}
+
+std::size_t
+LocodeStore::name( int id, char *buf, std::size_t capacity ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+    {
+        const std::string_view n = Locode::m_fullNames.view(id);
+        const std::size_t retVal = std::min(n.size(), capacity);
+        std::memcpy(buf, n.data(), retVal);
+        return retVal;
+    }
+
+    const std::string_view c = coded(id);
+    return m_symbols.decode(c.data(), c.size(), buf, capacity);
+}
+
+bool
+LocodeStore::nameIs( int id, std::string_view s ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+        return Locode::m_fullNames.view(id) == s;
+
+    const std::string_view c = coded(id);
+    return m_symbols.equal(c.data(), c.size(), s);
+}
+
+bool
+LocodeStore::nameStartsWith( int id, std::string_view prefix ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+        return Locode::m_fullNames.view(id).starts_with(prefix);
+
+    const std::string_view c = coded(id);
+    return m_symbols.startsWith(c.data(), c.size(), prefix);
+}
+
+std::string_view
+LocodeStore::coded( int id ) const
+{
+    const int i = id - LOCODE::NUMLOCODE;
+    return std::string_view(m_blob + m_names[i], m_names[i + 1] - m_names[i]);
+}
+
+std::string
+LocodeStore::subdiv( int id ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+        return Locode::index(id).subdiv();
+
+    std::uint32_t s = m_subdiv[id - LOCODE::NUMLOCODE];
+    std::string retVal;
+    for (; s; s >>= 8)
+        retVal.insert(retVal.begin(), char(s & 255));
+    return (retVal.empty()) ? "XXX" : retVal;
+}
+
+std::pair<double,double>
+LocodeStore::pos( int id ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+        return Locode::index(id).pos();
+
+    const float *p = m_position + 2 * (id - LOCODE::NUMLOCODE);
+    return std::pair<double,double>(p[0], p[1]);
+}
+
+unsigned short
+LocodeStore::function( int id ) const
+{
+    assert(id > 0 && id < size());
+    if (hot(id))
+    {
+        // rebuild the packed attributes from the public interface of Locode
+        const Locode c = Locode::index(id);
+        unsigned short retVal = 0;
+        for (unsigned f = 1; f < Locode::MAXFUNCTION; f <<= 1)
+        {
+            if (c.has(Locode::Function(f)))
+                retVal |= f;
+        }
+        if (c.valid_pos())
+            retVal |= VALIDPOS;
+        return retVal | (c.status() << 11);
+    }
+
+    return m_function[id - LOCODE::NUMLOCODE];
+}
+
+//
+// the cold tier
+//
+bool
+LocodeStore::build( const std::vector<std::string> &unlocodes, const std::string &fname )
+{
+    LocodeStore hotOnly;
+
+    // sorted by code, a code appearing in more than one file keeps its first entry
+    std::map<std::uint32_t, Row> rows;
+    for (const std::string &file : unlocodes)
+    {
+        std::ifstream in(file);
+        if (!in)
+            return false;
+
+        std::string line;
+        while (std::getline(in, line))
+        {
+            // Ch, Country, Location, Name, NameWoDiacritics, SubDiv, Function, Status, Date, IATA, Coordinates, Remarks
+            const std::vector<std::string> f = Csv::split(line);
+            if (f.size() < 11 || f[1].size() != 2 || f[2].size() != 3 || f[0] == "X")
+                continue;
+
+            const std::string code = f[1] + f[2];
+            const std::uint32_t p = pack(code);
+            if (!p || hotOnly.find(code) >= 0 || rows.count(p))
+                continue;
+
+            Row r;
+            r.name = f[3];
+            for (std::size_t i = 0; i < f[5].size() && i < 3; ++i)
+                r.subdiv = (r.subdiv << 8) | (unsigned char) f[5][i];
+
+            const bool validPos = Csv::coordinates(f[10], r.lat, r.lon);
+            r.function = Csv::function(f[6], f[7], validPos);
+            rows.emplace(p, r);
+        }
+    }
+
+    std::vector<std::string> sample;
+    sample.reserve(rows.size());
+    for (const auto &p : rows)
+        sample.push_back(p.second.name);
+    const SymbolTable symbols = SymbolTable::train(sample);
+
+    std::vector<std::uint32_t>  codes, names(1, 0), subdiv;
+    std::vector<float>          position;
+    std::vector<unsigned short> function;
+    std::string                 blob;
+
+    for (const auto &p : rows)
+    {
+        codes.push_back(p.first);
+        blob += symbols.encode(p.second.name);
+        names.push_back(std::uint32_t(blob.size()));
+        subdiv.push_back(p.second.subdiv);
+        position.push_back(p.second.lat);
+        position.push_back(p.second.lon);
+        function.push_back(p.second.function);
+    }
+
+    Header h;
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version  = VERSION;
+    h.count    = std::uint32_t(codes.size());
+    h.blob     = std::uint32_t(blob.size());
+    h.reserved = 0;
+
+    // the symbol table and the arrays of 4 byte items first so every array is aligned
+    const std::string table = symbols.data();
+    std::ofstream out(fname, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(table.data(), std::streamsize(table.size()));
+    write(out, codes);
+    write(out, names);
+    write(out, subdiv);
+    write(out, position);
+    write(out, function);
+    out.write(blob.data(), std::streamsize(blob.size()));
+
+    return bool(out);
+}
+
+bool
+LocodeStore::open( const std::string &fname )
+{
+    close();
+
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(Header))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        return false;
+
+    const Header *h = static_cast<const Header*>(map);
+    const std::size_t n = h->count;
+    const std::size_t expected = sizeof(Header) + SymbolTable::SIZE + n * 4 + (n + 1) * 4 + n * 4 + n * 8 + n * 2 + h->blob;
+
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) || h->version != VERSION || expected != std::size_t(st.st_size) ||
+        !m_symbols.load(static_cast<const char*>(map) + sizeof(Header)))
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    const char *p = static_cast<const char*>(map) + sizeof(Header) + SymbolTable::SIZE;
+    const std::uint32_t *codes = reinterpret_cast<const std::uint32_t*>(p);
+    const std::uint32_t *names = codes + n;
+
+    // find() binary searches the codes and name() slices the blob, so the codes must ascend strictly and the offsets
+    // ascend from 0 to the end of the blob
+    bool valid = (names[0] == 0 && names[n] == h->blob);
+    for (std::size_t i = 0; i < n && valid; ++i)
+        valid = (names[i] <= names[i + 1] && (i == 0 || codes[i - 1] < codes[i]));
+    if (!valid)
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    m_codes    = reinterpret_cast<const std::uint32_t*>(p);   p += n * 4;
+    m_names    = reinterpret_cast<const std::uint32_t*>(p);   p += (n + 1) * 4;
+    m_subdiv   = reinterpret_cast<const std::uint32_t*>(p);   p += n * 4;
+    m_position = reinterpret_cast<const float*>(p);           p += n * 8;
+    m_function = reinterpret_cast<const unsigned short*>(p);  p += n * 2;
+    m_blob     = p;
+
+    m_map   = map;
+    m_size  = st.st_size;
+    m_count = h->count;
+
+    // lookups are binary searches, so read ahead would only fetch pages that are not needed
+    madvise(map, m_size, MADV_RANDOM);
+
+    return true;
+}
+
+void
+LocodeStore::close( void )
+{
+    if (m_map)
+        munmap(m_map, m_size);
+
+    m_map      = nullptr;
+    m_size     = 0;
+    m_count    = 0;
+    m_codes    = nullptr;
+    m_names    = nullptr;
+    m_blob     = nullptr;
+    m_symbols  = SymbolTable();
+    m_subdiv   = nullptr;
+    m_position = nullptr;
+    m_function = nullptr;
+}
+
+//
+//
+//
+
@@ -0,0 +1,199 @@
+/* LocodeStore 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   LocodeStore.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Two tier UN/LOCODE lookup: the compiled Locode table backed by the full UN/LOCODE code list.
+
+ Locode holds the small set (26857 codes with an approved status) compiled into the program. The full code list has
+ around 116k codes, most of them rarely used, and compiling them in (__LARGE__) makes every Locode lookup pay for
+ a table four times the size. A LocodeStore keeps the compiled table as the hot tier and adds a cold tier holding
+ only the codes the compiled table lacks.
+
+ Hot tier  - the compiled codes packed 6 bits per character into a 32 bit integer (107KB, alphabetical order so the
+             index is the Locode id), searched within the range of the first letter. Built on first use.
+ Cold tier - a file written by build() from the UN/LOCODE code list files and memory mapped by open(), so the OS reads
+             only the pages a lookup touches. It holds the sorted packed codes, name offsets, packed subdivisions,
+             positions and functions as flat arrays, and the names compressed with a SymbolTable trained on them.
+
+ The names are most of the cold tier and are read far less often than the codes, so each is coded on its own with the
+ file's SymbolTable (stored after the header) and decoded on access, which cuts the names block to under a third.
+ name(id, buf, capacity) decodes one name into a caller buffer without allocating, and nameIs() and nameStartsWith()
+ compare a name against a string without decoding it. Code lookups do not touch the names.
+
+ find() probes the hot tier and then the cold tier. Ids are stable across the tiers: a compiled code has its Locode id
+ (i.e. LOCODE::GBLON) and a cold code has LOCODE::NUMLOCODE plus its index in the file, so hot ids can be passed
+ straight to Locode. Cold ids depend only on the code list files used to build the file.
+
+ The file is in the byte order of the machine that built it. find() and the accessors may be called from several
+ threads; open() and close() may not be called while other threads use the store.
+
+ Example
+
+ LocodeStore::build({ "2024-2 UNLOCODE CodeListPart1.csv", "2024-2 UNLOCODE CodeListPart2.csv", "2024-2 UNLOCODE CodeListPart3.csv" }, "locodes.bin");
+
+ LocodeStore s;
+ if (!s.open("locodes.bin"))
+     exit(1);
+
+ int id = s.find("GBLON");                           // hot, id == LOCODE::GBLON
+ int rare = s.find("NOXYZ");                         // cold if not compiled in, -1 if unknown
+ if (rare >= 0)
+     std::cout << s.name(rare) << " " << s.subdiv(rare) << " " << s.pos(rare).first << std::endl;
+
+ */
+
+
+#ifndef __LOCODESTORE_H__
+#define __LOCODESTORE_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __SYMBOLTABLE_H__
+#include "SymbolTable.h"
+#endif
+
+
+
+class LocodeStore
+{
+public:
+
+    LocodeStore( void );
+    ~LocodeStore( void ) { close(); }
+
+    LocodeStore( const LocodeStore& )=delete;
+    LocodeStore&
+    operator=( const LocodeStore& )=delete;
+
+    // write the codes in the UN/LOCODE code list files that are not compiled into Locode to fname
+    // the files have no header and the columns Ch, Country, Location, Name, NameWoDiacritics, SubDiv, Function, Status,
+    // Date, IATA, Coordinates, Remarks as published by UNECE, returns false if a file cannot be read or written
+    static bool
+    build( const std::vector<std::string> &unlocodes, const std::string &fname );
+
+    // map a file written by build(), returns false (leaving only the hot tier) if it cannot be mapped or is not such a file
+    bool
+    open( const std::string &fname );
+
+    void
+    close( void );
+
+    // the id of a 5 character UN/LOCODE e.g. "GBLON", -1 if unknown
+    int
+    find( std::string_view code ) const;
+
+    // ids are in [1, size())
+    int
+    size( void ) const { return LOCODE::NUMLOCODE + int(m_count); }
+
+    // true if id is a compiled Locode id
+    static bool
+    hot( int id ) { return id > 0 && id < LOCODE::NUMLOCODE; }
+
+    //
+    // attributes of an id from find()
+    //
+    std::string
+    code( int id ) const;
+
+    std::string
+    name( int id ) const;
+
+    // the name of id in buf, returns its length (at most capacity, in which case it may be cut short), no NUL is added
+    std::size_t
+    name( int id, char *buf, std::size_t capacity ) const;
+
+    bool
+    nameIs( int id, std::string_view s ) const;
+
+    bool
+    nameStartsWith( int id, std::string_view prefix ) const;
+
+    // the subdivision code e.g. "LND", "XXX" if none (as Locode)
+    std::string
+    subdiv( int id ) const;
+
+    // (latitude, longitude)
+    std::pair<double,double>
+    pos( int id ) const;
+
+    bool
+    valid_pos( int id ) const { return function(id) & VALIDPOS; }
+
+    bool
+    has( int id, Locode::Function f ) const { return function(id) & f; }
+
+    Locode::Status
+    status( int id ) const { return Locode::Status(function(id) >> 11); }
+
+    // the code packed 6 bits a character, in the same order as the codes
+    static std::uint32_t
+    pack( std::string_view code );
+
+private:
+
+    // Locode::m_function layout: the functions, bit 10 for a valid position and the status from bit 11
+    static constexpr unsigned short VALIDPOS = (1u << 10);
+
+    struct Header
+    {
+        char          magic[8];
+        std::uint32_t version;
+        std::uint32_t count;
+        std::uint32_t blob;      // bytes of coded names
+        std::uint32_t reserved;
+    };
+
+    struct HotTier
+    {
+        std::uint32_t codes[LOCODE::NUMLOCODE];
+        int           first[27]; // first index of each initial letter, as Locode::m_search
+    };
+
+    static const HotTier&
+    hotTier( void );
+
+    static std::string
+    unpack( std::uint32_t code, int length );
+
+    unsigned short
+    function( int id ) const;
+
+    // the coded name of a cold id
+    std::string_view
+    coded( int id ) const;
+
+    void                 *m_map;
+    std::size_t           m_size;
+    std::uint32_t         m_count;
+
+    // the cold tier, pointers into the mapping
+    const std::uint32_t  *m_codes;
+    const std::uint32_t  *m_names;   // m_count + 1 offsets into m_blob
+    const char           *m_blob;
+    const std::uint32_t  *m_subdiv;  // up to 3 characters, 8 bits each, 0 for none
+    const float          *m_position;// m_count (lat, lon) pairs
+    const unsigned short *m_function;
+
+    SymbolTable           m_symbols;
+};
+
+
+#endif
+
+
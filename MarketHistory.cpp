@@ -0,0 +1,226 @@
+/* MarketHistory 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   MarketHistory.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __MARKETHISTORY_H__
+#include "MarketHistory.h"
+#endif
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+#include <cassert>
+
+
+namespace
+{
+
+int
+toDate( const std::string &s, int defaultDate )
+{
+    // yyyymmdd, anything else is treated as no date
+    if (s.size() != 8 || !std::all_of(s.begin(), s.end(), ::isdigit))
+        return defaultDate;
+    return std::atoi(s.c_str());
+}
+
+} // namespace
+
+
+MarketHistory::MarketHistory( void ): m_changes(), m_epochs()
+{
+    std::fill(m_created, m_created + MarketId::NUMMARKETID, MINDATE);
+    std::fill(m_expiry, m_expiry + MarketId::NUMMARKETID, MAXDATE);
+    std::fill(m_status, m_status + MarketId::NUMMARKETID, NOSTATUS);
+    rebuild();
+}
+
+bool
+MarketHistory::load( const std::string &fname )
+{
+    std::ifstream in(fname);
+    if (!in)
+        return false;
+
+    std::string line;
+    if (!std::getline(in, line))
+        return false;
+
+    // find the columns by name as the ISO file has gained columns over the years
+    const std::vector<std::string> header = Csv::split(line);
+    auto column = [&header]( const char *name ) {
+        auto iter = std::find(header.begin(), header.end(), name);
+        return (iter != header.end()) ? int(iter - header.begin()) : -1;
+    };
+
+    const int micCol     = column("MIC");
+    const int statusCol  = column("STATUS");
+    const int createdCol = column("CREATION DATE");
+    const int expiryCol  = column("EXPIRY DATE");
+
+    if (micCol < 0 || createdCol < 0)
+        return false;
+
+    while (std::getline(in, line))
+    {
+        const std::vector<std::string> f = Csv::split(line);
+        if (int(f.size()) < int(header.size()))
+            continue;
+
+        MarketId mic(f[micCol]);
+        if (!mic.valid())
+            continue;
+
+        Status s = NOSTATUS;
+        if (statusCol >= 0)
+        {
+            if (f[statusCol] == "ACTIVE")
+                s = ACTIVE;
+            else if (f[statusCol] == "UPDATED")
+                s = UPDATED;
+            else if (f[statusCol] == "EXPIRED")
+                s = EXPIRED;
+        }
+
+        const int i = MarketId::index(mic);
+        m_created[i] = toDate(f[createdCol], MINDATE);
+        m_expiry[i]  = (expiryCol >= 0) ? toDate(f[expiryCol], MAXDATE) : MAXDATE;
+        m_status[i]  = s;
+    }
+
+    rebuild();
+    return true;
+}
+
+void
+MarketHistory::set( const MarketId &mic, int created, int expiry, Status status )
+{
+    const int i = MarketId::index(mic);
+    const int oldCreated = m_created[i];
+    const int oldExpiry  = m_expiry[i];
+
+    m_created[i] = created;
+    m_expiry[i]  = expiry;
+    m_status[i]  = status;
+
+    // update the index in place, a rebuild() per record would make loading n records cost n * rebuild()
+    split(created);
+    split(expiry);
+    for (std::size_t e = 0; e < m_epochs.size(); ++e)
+    {
+        const int date = (e) ? m_changes[e - 1] : MINDATE;
+        if (created <= date && date < expiry)
+            m_epochs[e].set(i);
+        else m_epochs[e].reset(i);
+    }
+    merge(oldCreated);
+    merge(oldExpiry);
+}
+
+void
+MarketHistory::split( int date )
+{
+    if (date <= MINDATE || date >= MAXDATE)
+        return;
+
+    auto iter = std::lower_bound(m_changes.begin(), m_changes.end(), date);
+    if (iter != m_changes.end() && *iter == date)
+        return;
+
+    // the epoch containing date is copied to start a new one at date
+    const std::size_t e = iter - m_changes.begin();
+    m_changes.insert(iter, date);
+    m_epochs.insert(m_epochs.begin() + e + 1, m_epochs[e]);
+}
+
+void
+MarketHistory::merge( int date )
+{
+    auto iter = std::lower_bound(m_changes.begin(), m_changes.end(), date);
+    if (iter == m_changes.end() || *iter != date)
+        return;
+
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+    {
+        if (m_created[i] == date || m_expiry[i] == date)
+            return;
+    }
+
+    // no MIC changes on date, so the epochs either side of it are equal
+    const std::size_t e = iter - m_changes.begin();
+    assert(m_epochs[e] == m_epochs[e + 1]);
+    m_changes.erase(iter);
+    m_epochs.erase(m_epochs.begin() + e + 1);
+}
+
+const MarketSet&
+MarketHistory::epoch( int date ) const
+{
+    const int i = int(std::upper_bound(m_changes.begin(), m_changes.end(), date) - m_changes.begin());
+    return m_epochs[i];
+}
+
+void
+MarketHistory::rebuild( void )
+{
+    m_changes.clear();
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+    {
+        if (m_created[i] > MINDATE)
+            m_changes.push_back(m_created[i]);
+        if (m_expiry[i] < MAXDATE)
+            m_changes.push_back(m_expiry[i]);
+    }
+
+    std::sort(m_changes.begin(), m_changes.end());
+    m_changes.erase(std::unique(m_changes.begin(), m_changes.end()), m_changes.end());
+
+    // each epoch is a half open interval of dates over which no MIC changes, so test its first date
+    m_epochs.assign(m_changes.size() + 1, MarketSet());
+    for (std::size_t e = 0; e < m_epochs.size(); ++e)
+    {
+        const int date = (e) ? m_changes[e - 1] : MINDATE;
+        for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+        {
+            if (m_created[i] <= date && date < m_expiry[i])
+                m_epochs[e].set(i);
+        }
+    }
+}
+
+//
+// AsOf
+//
+MarketSet
+MarketHistory::AsOf::marketSet( const Country &cid ) const
+{
+    Gazetteer g;
+    return g.marketSet(cid) & *m_valid;
+}
+
+std::vector<MarketId>
+MarketHistory::AsOf::markets( const Country &cid ) const
+{
+    return marketSet(cid).toVector();
+}
+
+//
+//
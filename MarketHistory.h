@@ -0,0 +1,163 @@
+/* MarketHistory 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   MarketHistory.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Effective and expiry dates for MICs i.e. the ISO 10383 list as it stood on a given date.
+
+ MarketId only knows the current list. MarketHistory records, for each MarketId, the date it was created, the date it
+ expired (if it has) and its ISO status. It is loaded from the ISO 10383 CSV (https://www.iso20022.org/market-identifier-codes),
+ which includes expired MICs, using the MIC, STATUS, CREATION DATE and EXPIRY DATE columns. MICs the compiled MarketId
+ does not know are skipped (see Snapshot for runtime MICs).
+
+ A MIC is valid on dates d with created <= d < expiry. A MIC without history is valid on every date, so an empty
+ MarketHistory agrees with MarketId.
+
+ Dates are integers of the form yyyymmdd as used in the ISO file e.g. 20251222.
+
+ The index is the sorted list of distinct creation and expiry dates (the change points) and, for each interval between
+ consecutive change points, a MarketSet of the MICs valid throughout it. A lookup is a binary search over a few hundred
+ change points followed by a bit test, and asOf(date) returns a view that does the search once.
+
+ Example
+
+ MarketHistory h;
+ if (!h.load("ISO10383_MIC.csv"))
+     exit(1);
+
+ std::cout << h.valid(MarketId::XLON, 20150101) << std::endl;
+
+ MarketHistory::AsOf v = h.asOf(20150101);
+ for (MarketId mic : v.markets(Country::GBR))
+     std::cout << mic << " " << mic.name() << std::endl;
+
+ */
+
+
+#ifndef __MARKETHISTORY_H__
+#define __MARKETHISTORY_H__
+
+#include <string>
+#include <vector>
+
+
+#ifndef __MARKETID_H__
+#include "MarketId.h"
+#endif
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+#ifndef __ENTITYSET_H__
+#include "EntitySet.h"
+#endif
+
+
+
+class MarketHistory
+{
+public:
+
+    enum Status : char { NOSTATUS = 0, ACTIVE, UPDATED, EXPIRED };
+
+    static constexpr int MINDATE = 0;
+    static constexpr int MAXDATE = 99991231;
+
+    // a view of the list on one date
+    class AsOf
+    {
+    public:
+
+        int
+        date( void ) const { return m_date; }
+
+        bool
+        valid( const MarketId &mic ) const { return m_valid->contains(mic); }
+
+        const MarketSet&
+        markets( void ) const { return *m_valid; }
+
+        std::vector<MarketId>
+        markets( const Country &cid ) const;
+
+        MarketSet
+        marketSet( const Country &cid ) const;
+
+    private:
+
+        friend class MarketHistory;
+
+        AsOf( int date, const MarketSet *valid ): m_date(date), m_valid(valid) {}
+
+        int              m_date;
+        const MarketSet *m_valid;
+    };
+
+    MarketHistory( void );
+    ~MarketHistory( void )=default;
+
+    // read the ISO 10383 CSV, returns false if the file cannot be read or lacks the required columns
+    bool
+    load( const std::string &fname );
+
+    // record the history of one MIC, replacing any earlier record
+    void
+    set( const MarketId &mic, int created, int expiry = MAXDATE, Status status = ACTIVE );
+
+    int
+    created( const MarketId &mic ) const { return m_created[MarketId::index(mic)]; }
+
+    int
+    expiry( const MarketId &mic ) const { return m_expiry[MarketId::index(mic)]; }
+
+    Status
+    status( const MarketId &mic ) const { return m_status[MarketId::index(mic)]; }
+
+    bool
+    valid( const MarketId &mic, int date ) const { return epoch(date).contains(mic); }
+
+    std::vector<MarketId>
+    markets( const Country &cid, int date ) const { return asOf(date).markets(cid); }
+
+    AsOf
+    asOf( int date ) const { return AsOf(date, &epoch(date)); }
+
+    // the dates on which the list changed, ascending
+    const std::vector<int>&
+    changes( void ) const { return m_changes; }
+
+private:
+
+    // the MICs valid on date
+    const MarketSet&
+    epoch( int date ) const;
+
+    void
+    rebuild( void );
+
+    // make date a change point, or drop it when no MIC changes on it
+    void
+    split( int date );
+
+    void
+    merge( int date );
+
+    int              m_created[MarketId::NUMMARKETID];
+    int              m_expiry[MarketId::NUMMARKETID];
+    Status           m_status[MarketId::NUMMARKETID];
+
+    // m_epochs[i] holds for m_changes[i - 1] <= date < m_changes[i], m_epochs[0] is before the first change
+    std::vector<int>       m_changes;
+    std::vector<MarketSet> m_epochs;
+};
+
+
+#endif
+
+
@@ -18,6 +18,8 @@
 #include "MarketId.h"
 #endif
 
+#include <istream>
+#include <ostream>
 #include <cassert>
 
     
@@ -102,1250 +104,6 @@ MarketId::setMarketId( const std::string &str )
     
     m_mic = MarketId::XXXX; // NOMARKET
     return false;
-} 
-
-// this speeds up setMarketId quite a bit
-
-constexpr short MarketId::m_search[28] = { 
-    1, 12, 140, 389, 618, 700, 842, 920, 1022, 1074, 1240, 1276, 1310, 1385, 1567, 1683, 1738, 1821, 1828, 1886, 2067, 2265, 2313, 2360, 2400, 3040, 3043, 3056 
-};
-
-
-constexpr short MarketId::m_fromISO[MAXMARKETID] = {
-    0, 1, 4, 5, 8, 9, 11, 12, 13, 14, 
-    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 
-    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 
-    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 
-    45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 
-    55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 
-    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 
-    75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 
-    85, 86, 87, 88, 89, 91, 93, 94, 95, 96, 
-    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 
-    107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 
-    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 
-    127, 128, 129, 130, 131, 132, 135, 136, 138, 139, 
-    140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 
-    150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 
-    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 
-    170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 
-    180, 181, 182, 184, 185, 186, 187, 188, 189, 190, 
-    191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 
-    201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 
-    211, 213, 214, 215, 216, 217, 218, 219, 220, 221, 
-    222, 223, 224, 226, 227, 228, 229, 230, 231, 232, 
-    233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 
-    243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 
-    253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 
-    263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 
-    273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 
-    283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 
-    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 
-    303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 
-    313, 314, 315, 316, 317, 318, 319, 320, 322, 323, 
-    324, 325, 326, 327, 328, 329, 330, 331, 332, 337, 
-    339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 
-    349, 350, 351, 352, 353, 355, 356, 357, 358, 359, 
-    360, 362, 363, 364, 365, 366, 367, 368, 369, 370, 
-    371, 373, 375, 376, 377, 379, 380, 381, 382, 383, 
-    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 
-    394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 
-    404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 
-    414, 415, 416, 418, 419, 420, 421, 422, 423, 424, 
-    425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 
-    435, 436, 437, 439, 440, 441, 442, 443, 444, 445, 
-    446, 448, 449, 450, 451, 452, 453, 454, 455, 456, 
-    457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 
-    467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 
-    477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 
-    487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 
-    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 
-    507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 
-    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 
-    527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 
-    537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 
-    547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 
-    558, 559, 560, 561, 563, 564, 565, 566, 567, 568, 
-    569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 
-    579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 
-    589, 590, 595, 596, 598, 599, 600, 601, 603, 604, 
-    605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 
-    615, 616, 617, 618, 619, 620, 621, 622, 623, 625, 
-    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 
-    636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 
-    648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 
-    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 
-    668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 
-    678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 
-    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 
-    698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 
-    708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 
-    718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 
-    728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 
-    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 
-    748, 750, 751, 752, 753, 754, 755, 756, 757, 758, 
-    759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 
-    769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 
-    779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 
-    789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 
-    799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 
-    809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 
-    819, 820, 821, 822, 823, 825, 826, 827, 828, 829, 
-    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 
-    840, 841, 842, 843, 844, 845, 846, 847, 850, 851, 
-    852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 
-    862, 863, 864, 865, 866, 867, 869, 871, 872, 873, 
-    874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 
-    884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 
-    894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 
-    905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 
-    915, 916, 917, 918, 919, 920, 921, 922, 924, 925, 
-    926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 
-    936, 938, 939, 940, 941, 942, 943, 944, 945, 946, 
-    947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 
-    957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 
-    967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 
-    977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 
-    987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 
-    997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 
-    1007, 1008, 1009, 1010, 1012, 1013, 1014, 1015, 1016, 1017, 
-    1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 
-    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 
-    1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 
-    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 
-    1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 
-    1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 
-    1078, 1079, 1080, 1081, 1082, 1083, 1085, 1086, 1087, 1088, 
-    1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 
-    1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 
-    1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 
-    1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 
-    1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 
-    1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 
-    1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 
-    1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 
-    1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 
-    1179, 1180, 1181, 1182, 1183, 1184, 1186, 1187, 1188, 1190, 
-    1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 
-    1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 
-    1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 
-    1221, 1222, 1223, 1224, 1225, 1226, 1228, 1229, 1230, 1231, 
-    1232, 1233, 1234, 1235, 1236, 1238, 1239, 1240, 1241, 1242, 
-    1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 
-    1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 
-    1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 
-    1273, 1274, 1275, 1276, 1277, 1279, 1280, 1281, 1282, 1283, 
-    1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 
-    1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 
-    1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 
-    1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 
-    1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1334, 1335, 
-    1336, 1337, 1338, 1339, 1340, 1341, 1343, 1344, 1345, 1347, 
-    1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 
-    1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 
-    1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 
-    1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 
-    1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 
-    1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 
-    1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 
-    1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 
-    1429, 1430, 1431, 1432, 1433, 1434, 1436, 1437, 1438, 1439, 
-    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 
-    1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 
-    1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 
-    1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 
-    1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 
-    1490, 1491, 1492, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 
-    1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 
-    1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 
-    1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 
-    1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 
-    1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 
-    1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 
-    1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 
-    1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 
-    1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 
-    1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 
-    1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 
-    1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 
-    1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 
-    1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 
-    1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 
-    1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 
-    1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 
-    1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 
-    1682, 1684, 1686, 1687, 1688, 1689, 1690, 1691, 1693, 1694, 
-    1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 
-    1705, 1706, 1707, 1708, 1709, 1712, 1713, 1714, 1715, 1717, 
-    1719, 1720, 1721, 1722, 1723, 1725, 1726, 1727, 1728, 1730, 
-    1731, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 
-    1742, 1743, 1744, 1745, 1746, 1747, 1749, 1750, 1751, 1752, 
-    1753, 1754, 1755, 1756, 1757, 1758, 1763, 1764, 1765, 1767, 
-    1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 
-    1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 
-    1789, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 
-    1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1810, 
-    1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 
-    1821, 1823, 1824, 1825, 1827, 1828, 1829, 1830, 1831, 1832, 
-    1833, 1834, 1835, 1836, 1837, 1838, 1840, 1841, 1842, 1843, 
-    1844, 1845, 1846, 1847, 1848, 1849, 1850, 1852, 1853, 1854, 
-    1855, 1856, 1857, 1858, 1859, 1861, 1862, 1863, 1864, 1865, 
-    1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 
-    1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 
-    1887, 1888, 1889, 1890, 1891, 1892, 1893, 1895, 1896, 1897, 
-    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 
-    1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 
-    1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 
-    1928, 1929, 1930, 1931, 1932, 1933, 1934, 1936, 1937, 1938, 
-    1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 
-    1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 
-    1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 
-    1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 
-    1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 
-    1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 
-    1999, 2000, 2001, 2002, 2003, 2004, 2006, 2007, 2008, 2009, 
-    2010, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 
-    2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 
-    2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 
-    2041, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 
-    2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 
-    2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 
-    2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2082, 2083, 
-    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 
-    2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 
-    2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 
-    2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 
-    2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 
-    2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 
-    2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 
-    2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 
-    2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 
-    2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 
-    2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 
-    2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2204, 2205, 
-    2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 
-    2216, 2217, 2218, 2219, 2220, 2221, 2223, 2224, 2225, 2226, 
-    2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 
-    2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 
-    2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 
-    2257, 2259, 2260, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 
-    2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 
-    2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 
-    2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 
-    2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 
-    2311, 2312, 2313, 2314, 2315, 2316, 2318, 2320, 2321, 2322, 
-    2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 
-    2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 
-    2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 
-    2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 
-    2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 
-    2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 
-    2383, 2384, 2385, 2389, 2391, 2392, 2393, 2394, 2396, 2397, 
-    2398, 2400, 2401, 2402, 2403, 2404, 2406, 2407, 2408, 2409, 
-    2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2419, 2420, 
-    2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 
-    2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 
-    2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 
-    2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 
-    2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 
-    2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 
-    2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 
-    2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 
-    2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 
-    2511, 2512, 2513, 2514, 2516, 2517, 2518, 2519, 2520, 2521, 
-    2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 
-    2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 
-    2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 
-    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 
-    2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 
-    2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 
-    2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 
-    2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 
-    2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 
-    2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 
-    2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 
-    2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 
-    2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 
-    2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 
-    2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 
-    2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 
-    2683, 2684, 2685, 2686, 2687, 2689, 2690, 2691, 2692, 2693, 
-    2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 
-    2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 
-    2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 
-    2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 
-    2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 
-    2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 
-    2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2764, 
-    2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 
-    2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 
-    2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 
-    2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 
-    2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 
-    2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 
-    2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 
-    2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 
-    2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 
-    2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 
-    2865, 2866, 2867, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 
-    2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 
-    2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 
-    2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 
-    2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 
-    2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 
-    2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 
-    2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 
-    2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 
-    2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 
-    2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 
-    2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 
-    2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 
-    2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 
-    3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 
-    3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 
-    3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 
-    3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 
-    3048, 3049, 3051, 3052, 3053, 3054, 3055, 1822, 1839, 937, 
-    2317, 2405, 447, 336, 592, 591, 594, 848, 2688, 1681, 
-    1761, 1768, 1748, 1809, 1762, 2886, 1435, 225, 1716, 1237, 
-    1711, 1710, 1011, 2386, 923, 212, 2388, 1685, 2390, 2399, 
-    1314, 2011, 338, 557, 2418, 2868, 602, 1227, 1493, 1718, 
-    1729, 2763, 10, 321, 438, 562, 749, 2222, 870, 2081, 
-    904, 824, 2005, 2319, 1790, 1278, 646, 1333, 2261, 2080, 
-    3, 7, 6, 1084, 417, 868, 361, 372, 183, 597, 
-    1342, 1886, 593, 1683, 1368, 1185, 374, 378, 333, 1935, 
-    1759, 334, 1766, 1760, 1826, 1724, 2154, 1732, 2258, 2203, 
-    3047, 2387, 2515, 2572, 354, 1692, 624, 137, 1894, 2042, 
-    2263, 2262, 134, 133, 3050, 647, 2, 1189, 335, 1860, 
-    1851, 2395, 92, 90, 1346, 849
-};
-
-constexpr short MarketId::m_toISO[NUMMARKETID] = { NOMARKETID,
-    _21XX, _24DX, _24EQ, _24EX, _3579, _360D, _360M, _360T, _360X, _3DXE, 
-    _4AXE, A2XX, AACA, AAPA, AATS, ABAN, ABFI, ABNA, ABNC, ABSI, 
-    ABUL, ABW0, ABXX, ACCX, ACEX, ACKF, ACXC, ACXL, ADRK, ADVT, 
-    AFDL, AFET, AFEX, AFG0, AFSA, AFSE, AFSI, AFSL, AFSO, AFSX, 
-    AFTS, AGBP, AGO0, AIA0, AILT, AIMX, AIXE, AIXK, AKIS, ALA0, 
-    ALB0, ALDP, ALGO, ALLT, ALPX, ALSI, ALTX, ALXA, ALXB, ALXL, 
-    ALXP, AMLG, AMNL, AMPX, AMTS, AMXO, AND0, ANLP, ANTS, ANZL, 
-    APAW, APCL, APEX, APXL, AQEA, AQED, AQEU, AQSD, AQSE, AQSF, 
-    AQSG, AQSL, AQSN, AQST, AQUA, AQXA, AQXD, AQXE, ARAX, ARCB, 
-    ARCD, ARCE, ARCH, ARCO, ARCX, ARDA, ARE0, AREX, ARG0, ARIA, 
-    ARKX, ARM0, ARTX, ASEF, ASEX, ASM0, ASMT, ASPI, ASPN, ASTR, 
-    ASXB, ASXC, ASXP, ASXT, ASXV, ATAD, ATDF, ATF0, ATFX, ATG0, 
-    ATHL, ATLB, ATLN, ATSA, AURB, AURO, AUS0, AUT0, AUTB, AUTO, 
-    AUTP, AUTX, AVEU, AVXE, AWBX, AWEX, AXIO, AXSI, AZE0, BAAD, 
-    BACE, BACR, BAEP, BAIK, BAIP, BAJD, BAJM, BALT, BAML, BAMP, 
-    BAMX, BANA, BAPA, BAPE, BAPX, BARD, BARK, BARL, BARO, BART, 
-    BARU, BARX, BASE, BASI, BASP, BASX, BATD, BATE, BATF, BATO, 
-    BATP, BATS, BATY, BBIE, BBIS, BBLX, BBOK, BBSF, BBSI, BBSN, 
-    BBSX, BBVA, BBVI, BBVX, BCDX, BCEE, BCFS, BCMA, BCMM, BCRM, 
-    BCSC, BCSE, BCSI, BCSL, BCXE, BDEA, BDI0, BDPL, BDSK, BEAM, 
-    BEBG, BEEX, BEIS, BEL0, BELB, BELF, BEN0, BERA, BERB, BERC, 
-    BES0, BESA, BETA, BETP, BETX, BEUD, BEUE, BEUF, BEUO, BEUP, 
-    BEUT, BFA0, BFEX, BFPT, BFSD, BGCA, BGCB, BGCD, BGCF, BGCI, 
-    BGCJ, BGCM, BGCO, BGD0, BGEM, BGFI, BGFU, BGFX, BGHX, BGLU, 
-    BGR0, BGSG, BGSI, BGUK, BHR0, BHS0, BHSF, BHWA, BIDS, BIH0, 
-    BILT, BILU, BINV, BISI, BIVA, BJSE, BKBF, BKBR, BKDM, BKKT, 
-    BKLF, BKLN, BKSK, BLBB, BLBF, BLBS, BLEQ, BLEV, BLFX, BLIQ, 
-    BLKX, BLM0, BLNK, BLOX, BLPX, BLR0, BLTD, BLTX, BLUE, BLUX, 
-    BLXA, BLZ0, BMCL, BMCM, BMEA, BMEX, BMFA, BMFM, BMFX, BMLB, 
-    BMLI, BMLS, BMLX, BMSI, BMTF, BMTS, BMU0, BNDD, BNDS, BNLD, 
-    BNPA, BNPC, BNPF, BNPH, BNPL, BNPP, BNPS, BNPX, BNSX, BNTW, 
-    BNYC, BOAL, BOAT, BOCF, BOFS, BOL0, BOND, BOSC, BOSD, BOSP, 
-    BOSS, BOTC, BOTE, BOTV, BOVA, BOVM, BPAG, BPAS, BPKO, BPLC, 
-    BPOL, BPSX, BPTE, BPXD, BPXR, BPXX, BRA0, BRAE, BRB0, BRDE, 
-    BRDL, BRDS, BREA, BRED, BRFQ, BRGA, BRIX, BRMF, BRN0, BRNX, 
-    BSAB, BSEX, BSFX, BSGX, BSLB, BSME, BSPL, BSTX, BTAM, BTBS, 
-    BTEA, BTEC, BTEE, BTEQ, BTFE, BTLX, BTN0, BTNL, BTQE, BTQG, 
-    BTRL, BTSP, BTUN, BUKL, BULK, BURG, BURM, BUSA, BUYN, BVCA, 
-    BVMF, BVUK, BVUR, BVUS, BWA0, BXDA, BYXD, BZXD, C2OX, CABK, 
-    CABV, CAES, CAF0, CALH, CAN0, CAND, CANX, CAPA, CAPI, CAPL, 
-    CASI, CAST, CATS, CAVD, CAVE, CAZE, CBAE, CBAL, CBKA, CBKC, 
-    CBKD, CBKE, CBKF, CBKG, CBKS, CBLC, CBLP, CBMS, CBNL, CBOE, 
-    CBSK, CBSX, CBTS, CCEU, CCEX, CCFE, CCFX, CCK0, CCLX, CCML, 
-    CCMS, CCMX, CCO2, CCRM, CCXE, CDED, CDEL, CDNA, CDSI, CDSL, 
-    CECA, CECS, CEDX, CELP, CEPL, CEPU, CESF, CESI, CETI, CETO, 
-    CEUD, CEUE, CEUO, CEUX, CFAU, CFBC, CFHK, CFIC, CFIF, CFIL, 
-    CFIM, CFJP, CFTW, CGCM, CGDB, CGEB, CGEC, CGEE, CGET, CGGD, 
-    CGIT, CGMA, CGMC, CGMD, CGME, CGMG, CGMH, CGMI, CGML, CGMT, 
-    CGMU, CGMX, CGND, CGQD, CGQT, CGTR, CGXS, CHE0, CHEV, CHIA, 
-    CHIC, CHID, CHIE, CHIJ, CHIO, CHIS, CHIV, CHIX, CHIY, CHL0, 
-    CHN0, CIBC, CIBH, CIBP, CICX, CILH, CIMA, CIMB, CIMD, CIME, 
-    CIMV, CIOI, CISD, CITD, CITX, CIV0, CLAU, CLCH, CLHK, CLJP, 
-    CLMX, CLPH, CLST, CLTD, CLVE, CMAP, CMCI, CMCM, CMEC, CMED, 
-    CMEE, CMES, CMET, CMMT, CMR0, CMSF, CMTS, CNOD, CNSI, COAL, 
-    COD0, CODA, COG0, COHR, COK0, COL0, COM0, COMG, COMM, CONC, 
-    CONE, CORE, COTC, CPGX, CPTX, CPV0, CRBX, CRDL, CRED, CREM, 
-    CRI0, CRSX, CRYD, CRYP, CRYX, CSAG, CSAS, CSAU, CSBX, CSCF, 
-    CSCL, CSDA, CSE2, CSEC, CSEU, CSFB, CSGI, CSHK, CSIN, CSJP, 
-    CSLB, CSLP, CSMD, CSOB, CSOT, CSSI, CSSX, CSTO, CSVW, CSZH, 
-    CTCC, CTDD, CTS3, CTSS, CTWO, CUB0, CULV, CURX, CUW0, CXAB, 
-    CXAC, CXAE, CXAF, CXAI, CXAM, CXAN, CXAP, CXAQ, CXAR, CXAV, 
-    CXAW, CXOT, CXR0, CXRT, CYM0, CYP0, CZE0, D2XC, D2XG, DAIW, 
-    DAMP, DAMS, DAPA, DASE, DASH, DASI, DAUK, DAVY, DBAB, DBAG, 
-    DBCR, DBCX, DBDC, DBDX, DBES, DBHK, DBIX, DBLN, DBLX, DBMO, 
-    DBOX, DBRU, DBSE, DBSX, DBVX, DBXT, DCAS, DCSE, DCSX, DDTX, 
-    DDUB, DEAL, DEKA, DEU0, DEXE, DGCX, DHEL, DHLX, DICE, DIFX, 
-    DJI0, DKED, DKFI, DKOB, DKTC, DKWB, DLIS, DMA0, DMAD, DMIL, 
-    DNDK, DNFI, DNIS, DNK0, DNSE, DOM0, DOSE, DOSL, DOTS, DOWE, 
-    DOWG, DOWM, DPAR, DRCT, DRSP, DSMD, DSME, DSTO, DUMX, DUSA, 
-    DUSB, DUSC, DUSD, DVFX, DWFI, DWIN, DWSF, DZA0, DZBK, EACM, 
-    EBHU, EBLX, EBMX, EBON, EBRA, EBSC, EBSD, EBSF, EBSI, EBSM, 
-    EBSN, EBSO, EBSS, EBSX, EBXV, ECAG, ECAL, ECEU, ECGS, ECHO, 
-    ECNL, ECSL, ECU0, ECXE, EDBT, EDDP, EDGA, EDGD, EDGE, EDGL, 
-    EDGO, EDGX, EDRF, EDXM, EEAL, EESE, EESX, EFTP, EGMT, EGSI, 
-    EGY0, EIXE, ELEU, ELIX, ELNO, ELSE, ELUK, ELXE, EM3S, EMBX, 
-    EMCE, EMCH, EMDR, EMIB, EMID, EMIR, EMLD, EMTF, EMTS, ENAX, 
-    ENCL, ENMS, ENSL, ENSX, ENSY, ENTW, ENXB, ENXL, EOTC, EPEX, 
-    EPRD, EPRL, EQCA, EQIE, EQLD, EQOC, EQOD, EQOS, EQSE, EQSL, 
-    EQTA, EQTB, EQTC, EQTD, EQUS, EQWB, ERBX, ERFQ, ERI0, ERIS, 
-    ERST, ESH0, ESLO, ESP0, ESPD, EST0, ESTO, ETFP, ETH0, ETLX, 
-    ETOR, ETPA, ETSC, EUAX, EUCC, EUCH, EUFN, EUOB, EURM, EUSC, 
-    EUSP, EUWA, EUWB, EUWX, EVOL, EWRM, EWSM, EXAA, EXBO, EXCP, 
-    EXDC, EXEU, EXGM, EXIX, EXLP, EXMP, EXOR, EXOT, EXPA, EXPM, 
-    EXSB, EXSD, EXSE, EXSF, EXSH, EXSI, EXSP, EXSY, EXTR, EXVP, 
-    EXYY, FAIR, FAST, FBSI, FCBT, FCME, FGEX, FGML, FGMP, FICO, 
-    FICX, FIED, FIN0, FINC, FINN, FINO, FINR, FINY, FISH, FISU, 
-    FJI0, FLK0, FLTB, FLTR, FLWX, FMTS, FMXS, FMXX, FNCS, FNDF, 
-    FNDK, FNDS, FNEE, FNFI, FNFT, FNFX, FNIS, FNIX, FNLT, FNLV, 
-    FNSE, FNUK, FNXB, FPWB, FRA0, FRAA, FRAB, FRAD, FRAS, FRAU, 
-    FRAV, FRAW, FREI, FREX, FRO0, FRRF, FRTE, FSEF, FSHX, FSM0, 
-    FSME, FTFM, FTFS, FTRM, FTUS, FUSD, FXAL, FXCL, FXCM, FXFM, 
-    FXGB, FXMT, FXNM, FXOP, FXPS, FXRQ, FXRS, FXSM, FXSW, G1XX, 
-    G360, GAB0, GARA, GBOB, GBOT, GBR0, GBSI, GBUL, GBWB, GEMX, 
-    GEO0, GETB, GFAM, GFAU, GFBM, GFBO, GFEX, GFIA, GFIB, GFIC, 
-    GFIF, GFIM, GFIN, GFIR, GFKS, GFOX, GFPO, GFSG, GFSM, GFSO, 
-    GGY0, GHA0, GIB0, GIN0, GIPB, GLBX, GLLC, GLMX, GLOM, GLP0, 
-    GLPS, GLPX, GMB0, GMBG, GMEG, GMEO, GMES, GMEX, GMGD, GMGE, 
-    GMGL, GMNI, GMTF, GMTS, GNB0, GNQ0, GOTC, GOVX, GPBC, GRC0, 
-    GRD0, GREE, GRIF, GRIO, GRL0, GROW, GRSE, GSAL, GSBE, GSBS, 
-    GSBX, GSCI, GSCO, GSEF, GSEI, GSIB, GSIL, GSLO, GSPL, GSPX, 
-    GSSI, GSXC, GSXH, GSXK, GSXL, GSXM, GSXN, GSXT, GTCO, GTM0, 
-    GTSM, GTSX, GTXE, GTXS, GUF0, GUM0, GUY0, GXGF, GXGM, GXGR, 
-    GXMA, HAMA, HAMB, HAML, HAMM, HAMN, HANA, HANB, HANC, HAND, 
-    HANE, HBFR, HBPL, HCER, HCHC, HDAT, HEDE, HEGX, HELA, HEMO, 
-    HESP, HGSP, HKG0, HKME, HMOD, HMTF, HND0, HOTC, HPCO, HPCS, 
-    HPCV, HPCX, HPPO, HPSO, HPSX, HREU, HRFQ, HRSI, HRTF, HRTX, 
-    HRV0, HSBC, HSBT, HSFX, HSTC, HSXA, HSXE, HTI0, HUDX, HUN0, 
-    HUNG, HUPX, HWHE, IATS, IBAL, IBCO, IBEQ, IBER, IBEX, IBGH, 
-    IBIS, IBKR, IBLX, IBSC, IBSI, IBUL, ICAH, ICAP, ICAS, ICAT, 
-    ICBX, ICDX, ICEL, ICEN, ICEO, ICES, ICEU, ICHK, ICKR, ICOR, 
-    ICOT, ICPM, ICPS, ICRO, ICSE, ICSH, ICSU, ICSZ, ICTQ, ICTW, 
-    ICUR, ICUS, ICXL, ICXR, IDN0, IDXM, IEBS, IECE, IECL, IENG, 
-    IEOS, IEPA, IEXA, IEXC, IEXD, IEXG, IFAD, IFBX, IFCA, IFED, 
-    IFEN, IFEU, IFFX, IFLL, IFLO, IFLS, IFLX, IFSG, IFSM, IFUS, 
-    IFUT, IFXA, IFXC, IFXR, IGDL, IIDX, IINX, IKBS, ILCM, IMAG, 
-    IMBD, IMCC, IMCD, IMCE, IMCG, IMCM, IMCO, IMCR, IMCS, IMCT, 
-    IMED, IMEN, IMEQ, IMET, IMEX, IMFD, IMFX, IMGB, IMGI, IMIR, 
-    IMMH, IMMM, IMN0, IMRD, IMSB, IMTF, IMTS, INCA, INCR, IND0, 
-    INFT, INGB, INGE, INGF, INGS, INGU, INGW, INSE, INSR, INTL, 
-    INVE, IOCD, IOED, IOFB, IOFI, IOFX, IOGB, IOGI, IOIR, IOMM, 
-    IOT0, IOTC, IOTF, IPNL, IPSX, IPXP, IPXW, IRL0, IRN0, IRQ0, 
-    ISBA, ISBV, ISDA, ISDX, ISEC, ISEX, ISL0, ISR0, ISSI, ISWA, 
-    ISWB, ISWC, ISWE, ISWN, ISWO, ISWP, ISWQ, ISWR, ISWT, ISWV, 
-    ITA0, ITGI, ITGL, ITSL, ITSM, IUOB, IVWP, IVZX, IXSP, JADX, 
-    JAM0, JASR, JATA, JBSI, JBUL, JEFA, JEFE, JEFS, JEFX, JESI, 
-    JEY0, JISI, JLEQ, JLEU, JLQD, JLSI, JNSI, JNST, JOR0, JPBX, 
-    JPCB, JPEU, JPJX, JPMI, JPMS, JPMX, JPN0, JPSI, JSEB, JSEF, 
-    JSER, JSES, JSJX, JSSI, JYSI, KABU, KAIX, KASH, KAZ0, KBCB, 
-    KBLC, KBLL, KBLM, KBLS, KBLT, KCCP, KDPW, KELR, KEN0, KGZ0, 
-    KHHU, KHM0, KIR0, KLEU, KLSH, KMTS, KMUX, KNA0, KNCM, KNEM, 
-    KNIG, KNLI, KNMX, KOCN, KOME, KOR0, KOTF, KRME, KWT0, LAFD, 
-    LAFL, LAFX, LAKE, LAKX, LAMP, LAO0, LASF, LASP, LATG, LAVA, 
-    LBBW, LBCM, LBCW, LBN0, LBR0, LBUL, LBWL, LBWS, LBY0, LCA0, 
-    LCHC, LCUR, LCXE, LEBV, LEDG, LELE, LESI, LEUE, LEUF, LEVL, 
-    LICA, LIDR, LIE0, LIFI, LIGA, LINX, LIQF, LIQH, LIQU, LISX, 
-    LISZ, LIUH, LIUS, LKA0, LLAT, LMAD, LMAE, LMAF, LMAO, LMAS, 
-    LMAX, LMEC, LMNR, LMNX, LMTS, LNEQ, LNFI, LOOP, LOTC, LOUI, 
-    LOYD, LPPM, LPSF, LQED, LQFI, LSO0, LSSI, LTAA, LTSE, LTU0, 
-    LUX0, LVA0, LXJP, LYNX, M2AE, MABX, MAC0, MACB, MACX, MAEL, 
-    MAF0, MAGM, MAKX, MALM, MALX, MANL, MAQE, MAQH, MAQI, MAQJ, 
-    MAQL, MAQU, MAQX, MAR0, MARF, MASG, MATN, MATX, MAXD, MBCP, 
-    MBPL, MBSI, MBUL, MCAD, MCID, MCO0, MCRY, MCSE, MCUR, MCXR, 
-    MCXS, MCXX, MCZK, MDA0, MDG0, MDIP, MDRV, MDV0, MEAU, MEHK, 
-    MELO, MEMD, MEMM, MEMX, MEPX, MERD, MERF, MERK, MESI, MESQ, 
-    METZ, MEX0, MFGL, MFOX, MFXA, MFXC, MFXR, MHBD, MHBE, MHBL, 
-    MHBP, MHEL, MHEU, MHIP, MHL0, MIBG, MIBL, MICE, MIDC, MIHI, 
-    MISX, MIVX, MIZX, MKAA, MKAP, MKD0, MKTF, MLAX, MLCO, MLER, 
-    MLES, MLEU, MLEX, MLI0, MLIB, MLIX, MLRQ, MLSI, MLT0, MLVE, 
-    MLVX, MLXB, MLXN, MMR0, MNDK, MNE0, MNFI, MNG0, MNIS, MNP0, 
-    MNSE, MOCX, MOON, MOSE, MOTX, MOZ0, MPRL, MRT0, MSAL, MSAX, 
-    MSBI, MSCO, MSCX, MSDM, MSEL, MSEU, MSIP, MSLC, MSLP, MSMS, 
-    MSNT, MSPL, MSR0, MSRP, MSSA, MSSI, MSTC, MSTO, MSTX, MSWP, 
-    MSXB, MSXO, MTAA, MTAH, MTAX, MTCH, MTQ0, MTSA, MTSB, MTSC, 
-    MTSD, MTSF, MTSG, MTSM, MTSO, MTSP, MTSS, MTSW, MTUS, MTXA, 
-    MTXC, MTXM, MTXS, MTXX, MUBE, MUBL, MUBM, MUBP, MUDX, MUFP, 
-    MUNA, MUNB, MUNC, MUND, MUS0, MUSE, MUSN, MUTI, MVCX, MWI0, 
-    MXLM, MXNL, MXOP, MYS0, MYT0, MYTR, N2EX, NABA, NABE, NABL, 
-    NABP, NABU, NAM0, NAMX, NAPA, NASB, NASD, NASN, NASX, NATX, 
-    NAVE, NBFL, NBLX, NBOT, NBXO, NCEL, NCL0, NCME, NCML, NDCM, 
-    NDEX, NDXS, NECD, NEEQ, NEOC, NEOD, NEOE, NEON, NER0, NESI, 
-    NEXD, NEXF, NEXG, NEXL, NEXN, NEXO, NEXS, NEXT, NEXX, NEXY, 
-    NFK0, NFSA, NFSC, NFSD, NGA0, NGXC, NIBC, NIBR, NIC0, NILX, 
-    NIU0, NLAX, NLBX, NLD0, NLPX, NMCE, NMRA, NMRJ, NMSX, NMTF, 
-    NMTS, NNCS, NOCO, NODX, NOED, NOFF, NOFI, NOME, NOOB, NOPS, 
-    NOR0, NORD, NORX, NOSC, NOSI, NOTC, NOWB, NOWX, NPEX, NPGA, 
-    NPL0, NPMS, NRU0, NSME, NSPO, NSSA, NSXB, NTRL, NTUK, NURD, 
-    NURO, NWMS, NWNV, NXBX, NXEU, NXFO, NXJP, NXSE, NXTE, NXUS, 
-    NXVW, NYFX, NYMS, NYMX, NYPC, NYSD, NYSI, NZFX, NZL0, NZXC, 
-    NZXD, NZXM, O360, OAPA, OBGE, OBKL, OCEA, OCFX, OCSI, OCTC, 
-    OCTL, OCTU, OCXE, OCXL, ODDO, ODOC, ODST, ODXE, OFEX, OHVO, 
-    OILX, OLBB, OLLC, OMEL, OMGA, OMIC, OMIP, OMN0, ONEC, ONEP, 
-    ONEX, ONSE, OOTC, OPCO, OPEX, OPMX, OPRA, OPSI, OPTX, OSDS, 
-    OSLC, OSSG, OTCB, OTCD, OTCE, OTCI, OTCM, OTCN, OTCO, OTCQ, 
-    OTCX, OTEU, OTPB, OTPR, OTXB, OTXT, OYLD, PAK0, PAN0, PARK, 
-    PARX, PATF, PAVE, PBGR, PBUL, PCDS, PCN0, PCSE, PDEX, PDQD, 
-    PDQX, PEEL, PEPH, PEPM, PEPQ, PEPW, PEPY, PER0, PERP, PESL, 
-    PEUR, PFSE, PFTQ, PFTS, PFXD, PGSL, PGTP, PHEL, PHL0, PHSI, 
-    PIEU, PINC, PINI, PINL, PINX, PIPE, PIPR, PIRM, PJCX, PKOP, 
-    PLDX, PLPD, PLPO, PLPS, PLPX, PLSX, PLUS, PLW0, PMTS, PMXX, 
-    PNED, PNG0, POEE, POL0, PORT, POSE, POTC, POTL, PPEX, PRI0, 
-    PRK0, PRME, PROS, PRSE, PRT0, PRY0, PSE0, PSGM, PSTO, PSXD, 
-    PTPG, PULX, PUMA, PUMX, PUND, PURE, PVBL, PVMF, PXIL, PYF0, 
-    QAT0, QCEX, QMTF, QMTS, QUNT, QWIK, QWIX, R5FX, RABL, RABO, 
-    RAJA, RBCB, RBCC, RBCE, RBCG, RBCM, RBCS, RBCT, RBEX, RBHU, 
-    RBIV, RBSI, RBSX, RCBX, RCMA, RENC, RESE, RESF, REST, REU0, 
-    REVX, RFBK, RFIM, RFQN, RFQS, RFQU, RICD, RICX, RITS, RJXX, 
-    RLBO, RMMS, RMMX, RMTF, RMTS, ROCO, ROFX, ROSR, ROTC, ROU0, 
-    RPDX, RPWC, RR4G, RRSI, RSEX, RTSI, RTSL, RTSP, RTSX, RTXF, 
-    RULE, RUS0, RUSX, RVSA, RWA0, S360, S3FM, SAGE, SANT, SAU0, 
-    SB1M, SBAR, SBEX, SBIC, SBIJ, SBIL, SBIU, SBIV, SBMF, SBSI, 
-    SCAG, SCLB, SCLE, SCOT, SCXA, SCXF, SCXM, SCXO, SCXS, SDN0, 
-    SEBA, SEBL, SEBS, SEBX, SECC, SECD, SECE, SECF, SEDC, SEDR, 
-    SEDX, SEED, SELC, SEMX, SEN0, SEND, SEOB, SEPE, SEWB, SFCL, 
-    SFMP, SFOX, SGA2, SGAS, SGBX, SGEX, SGMA, SGMT, SGMU, SGMV, 
-    SGMW, SGMX, SGMY, SGMZ, SGOE, SGP0, SGS0, SHAD, SHAR, SHAW, 
-    SHN0, SHSC, SIAB, SIBC, SICS, SIDX, SIFX, SIGA, SIGH, SIGJ, 
-    SIGX, SIMD, SIMV, SISI, SISU, SJM0, SKBB, SKSI, SKYX, SLB0, 
-    SLE0, SLHB, SLKK, SLV0, SLXT, SMBB, SMBC, SMBD, SMBE, SMBG, 
-    SMBP, SMEX, SMFE, SMFF, SMR0, SMTS, SNSI, SNUK, SOHO, SOM0, 
-    SPAD, SPAX, SPBE, SPDK, SPDX, SPEC, SPEU, SPEX, SPFI, SPHR, 
-    SPIM, SPM0, SPNO, SPRZ, SPSD, SPTR, SPTX, SPXE, SQUA, SRB0, 
-    SRPT, SSBI, SSBM, SSBT, SSD0, SSEX, SSFX, SSIL, SSME, SSOB, 
-    SSTX, SSWM, STAL, STAN, STEE, STFL, STFU, STFX, STOX, STP0, 
-    STRM, STRT, STSI, STUA, STUB, STUC, STUD, STUE, STUF, STUH, 
-    STXS, STXX, SUNB, SUNM, SUNO, SUNT, SUR0, SVES, SVEX, SVK0, 
-    SVN0, SVXI, SWAP, SWBI, SWE0, SWEE, SWLT, SWLV, SWZ0, SXM0, 
-    SXSI, SYC0, SYFX, SYNK, SYR0, SZSC, T212, TBEN, TBLA, TBSA, 
-    TBSP, TCA0, TCD0, TCDS, TCME, TCML, TDBL, TDGF, TDON, TDSX, 
-    TDVS, TDXS, TECO, TEEG, TEFD, TEFX, TEGB, TEGI, TEIR, TEMB, 
-    TEMC, TEMF, TEMG, TEMI, TEMM, TEMR, TEOF, TEPF, TEPG, TEPI, 
-    TEPM, TEPR, TEPX, TERA, TERE, TERM, TEUR, TFEX, TFSA, TFSC, 
-    TFSD, TFSE, TFSG, TFSS, TFSU, TFSV, TGAT, TGO0, TGSI, THA0, 
-    THEM, THRD, THRE, TICT, TIRD, TJK0, TKL0, TKM0, TLAB, TLCM, 
-    TLS0, TMCC, TMCY, TMEU, TMEX, TMID, TMTS, TMUK, TMXS, TNLA, 
-    TNLB, TNLK, TNLL, TOCP, TOMD, TOMF, TOMG, TOMX, TON0, TOWR, 
-    TPCD, TPDA, TPDE, TPDR, TPEE, TPEL, TPEO, TPEQ, TPER, TPES, 
-    TPEU, TPFD, TPFR, TPIC, TPID, TPIE, TPIM, TPIO, TPIR, TPIS, 
-    TPLF, TPMF, TPMG, TPRE, TPSB, TPSD, TPSE, TPSG, TPSL, TPSO, 
-    TPSP, TPSV, TPSY, TQEA, TQEB, TQEM, TQEX, TRAI, TRAL, TRAS, 
-    TRAX, TRBX, TRCK, TRCX, TRDC, TRDE, TRDX, TREA, TREO, TREU, 
-    TRFW, TRFX, TRIE, TRNL, TRPX, TRQA, TRQB, TRQC, TRQD, TRQM, 
-    TRQS, TRQX, TRSI, TRU1, TRU2, TRUK, TRUX, TRWB, TRXE, TSAD, 
-    TSAF, TSBF, TSBX, TSCB, TSCD, TSED, TSEF, TSFF, TSFG, TSFI, 
-    TSFX, TSGB, TSGI, TSIG, TSIR, TSMB, TSMC, TSMG, TSMI, TSMM, 
-    TSMR, TSRE, TSUK, TTO0, TUN0, TUOB, TUR0, TUV0, TWEA, TWEM, 
-    TWEO, TWEU, TWGP, TWHK, TWJP, TWJT, TWN0, TWSA, TWSF, TWSG, 
-    TXBA, TXSD, TXSE, TZA0, U360, UBCZ, UBEC, UBIM, UBIN, UBIS, 
-    UBSA, UBSB, UBSC, UBSD, UBSE, UBSF, UBSG, UBSI, UBSL, UBSP, 
-    UBSS, UBST, UBSX, UBSY, UCBA, UCBG, UCDE, UCHU, UCIT, UFEX, 
-    UGA0, UGEN, UICE, UKCA, UKEX, UKGD, UKOR, UKPX, UKR0, UKRE, 
-    ULTX, UMTS, UNGB, URCE, URY0, USA0, USEF, USOB, USWB, USWP, 
-    UTSL, UZB0, VABD, VAGL, VAGM, VALX, VAMS, VAT0, VAVO, VCMO, 
-    VCRS, VCT0, VDRK, VEGA, VEN0, VERT, VFCM, VFEX, VFGB, VFIL, 
-    VFMI, VFSI, VFUK, VFXO, VGB0, VIR0, VIRT, VIUK, VKAB, VLEX, 
-    VMEX, VMFX, VMTS, VNDM, VNM0, VOLA, VONT, VPXB, VRXP, VTBC, 
-    VTEX, VTLS, VTPS, VUBA, VUSA, VUT0, VWAP, VWDA, VWDX, WABR, 
-    WBAH, WBCL, WBDM, WBGF, WBKP, WBLC, WBMA, WBON, WCDE, WCLK, 
-    WDER, WEED, WELN, WELS, WELX, WETP, WFLB, WFLP, WFSE, WGAS, 
-    WIND, WINS, WINX, WIPO, WLF0, WMFS, WMSL, WMSW, WMTF, WMUS, 
-    WOOD, WOPO, WQXL, WSAG, WSBL, WSIL, WSIN, WSM0, WTRS, XA1X, 
-    XABC, XABG, XABJ, XABX, XACD, XACE, XADE, XADF, XADS, XAEX, 
-    XAFR, XAFX, XAIM, XALB, XALG, XALS, XALT, XAMC, XAMM, XAMS, 
-    XAND, XANM, XANS, XANT, XAOM, XAPA, XAPI, XAQS, XARC, XARM, 
-    XASE, XASM, XASX, XATH, XATL, XATS, XATX, XAUK, XAZX, XBAA, 
-    XBAB, XBAH, XBAN, XBAR, XBAV, XBBF, XBBJ, XBBK, XBCC, XBCE, 
-    XBCL, XBCM, XBCV, XBCX, XBDA, XBDV, XBEL, XBER, XBES, XBEY, 
-    XBFO, XBIL, XBIS, XBKF, XBKK, XBLB, XBLK, XBLN, XBMF, XBMK, 
-    XBND, XBNV, XBOG, XBOL, XBOM, XBOS, XBOT, XBOX, XBRA, XBRD, 
-    XBRE, XBRM, XBRN, XBRT, XBRU, XBRV, XBRY, XBSD, XBSE, XBSP, 
-    XBTF, XBTR, XBUD, XBUE, XBUL, XBVC, XBVM, XBVP, XBVR, XBXO, 
-    XCAI, XCAL, XCAN, XCAR, XCAS, XCAY, XCBD, XCBF, XCBO, XCBT, 
-    XCCE, XCCX, XCDE, XCEC, XCEF, XCEG, XCET, XCFE, XCFF, XCGS, 
-    XCHG, XCHI, XCIE, XCIS, XCME, XCNF, XCNQ, XCOL, XCOR, XCRC, 
-    XCRO, XCSC, XCSE, XCSX, XCTS, XCUE, XCUR, XCVD, XCX2, XCXD, 
-    XCYO, XCYS, XDAR, XDBC, XDBV, XDBX, XDCE, XDES, XDEX, XDFB, 
-    XDFM, XDHA, XDLP, XDMI, XDNB, XDPA, XDRF, XDRK, XDSE, XDSM, 
-    XDSX, XDTB, XDUB, XDUS, XDWZ, XEAS, XEBI, XEBS, XECB, XECC, 
-    XECM, XECO, XECS, XEDA, XEDX, XEEE, XEEO, XEER, XEHQ, XEID, 
-    XELX, XEMA, XEMB, XEMD, XEMI, XEMS, XEQT, XEQY, XERE, XERT, 
-    XESM, XETA, XETB, XETC, XETD, XETE, XETF, XETI, XETR, XETS, 
-    XETU, XETV, XETW, XETX, XEUB, XEUC, XEUE, XEUI, XEUM, XEUP, 
-    XEUR, XEUS, XEYE, XFCI, XFCM, XFDA, XFEX, XFFE, XFKA, XFMN, 
-    XFND, XFNO, XFNX, XFOM, XFRA, XFTA, XFTX, XGAI, XGAS, XGAT, 
-    XGCL, XGCX, XGDX, XGEM, XGFI, XGGI, XGHA, XGLO, XGME, XGMX, 
-    XGRM, XGSE, XGSX, XGTG, XGUA, XHAM, XHAN, XHCE, XHEL, XHER, 
-    XHFT, XHIR, XHKF, XHKG, XHNF, XHNX, XHON, XIAB, XIBE, XICB, 
-    XICE, XICX, XIDX, XIEL, XIEX, XIGG, XIHK, XIJP, XIMA, XIMC, 
-    XIME, XIMM, XIMX, XINE, XINS, XINV, XIOM, XIPE, XIPO, XIQS, 
-    XISA, XISE, XISL, XIST, XISX, XJAM, XJAS, XJAX, XJKT, XJNB, 
-    XJPX, XJSE, XJWY, XKAC, XKAR, XKAZ, XKBT, XKCE, XKCM, XKEM, 
-    XKFB, XKFE, XKGT, XKHA, XKHR, XKIE, XKIS, XKKT, XKLS, XKON, 
-    XKOR, XKOS, XKRX, XKSE, XKST, XKUW, XKYO, XLAH, XLAO, XLAT, 
-    XLBM, XLCE, XLCH, XLDN, XLDX, XLFX, XLGT, XLIF, XLIM, XLIS, 
-    XLIT, XLJM, XLJS, XLJU, XLLB, XLME, XLOD, XLOF, XLOM, XLON, 
-    XLQC, XLSM, XLTO, XLUS, XLUX, XMAB, XMAC, XMAD, XMAE, XMAI, 
-    XMAL, XMAN, XMAP, XMAT, XMAU, XMCE, XMDG, XMDS, XMEF, XMER, 
-    XMEV, XMEX, XMFE, XMFX, XMGE, XMIC, XMID, XMIF, XMIL, XMIO, 
-    XMLI, XMLX, XMME, XMNT, XMNX, XMOC, XMOD, XMOL, XMON, XMOO, 
-    XMOS, XMOT, XMPW, XMRV, XMSM, XMSW, XMTB, XMTI, XMTS, XMUN, 
-    XMUS, XMVL, XNAF, XNAI, XNAM, XNAS, XNCD, XNCM, XNCO, XNDQ, 
-    XNDU, XNDX, XNEC, XNEE, XNEP, XNEW, XNFI, XNGM, XNGO, XNGS, 
-    XNII, XNIM, XNKS, XNLI, XNLX, XNMR, XNMS, XNOM, XNOR, XNQL, 
-    XNRG, XNSA, XNSE, XNST, XNXC, XNXD, XNYC, XNYE, XNYF, XNYL, 
-    XNYM, XNYS, XNZE, XOAA, XOAD, XOAM, XOAS, XOBD, XOCH, XODE, 
-    XOFF, XOME, XOPV, XOSA, XOSC, XOSD, XOSE, XOSJ, XOSL, XOSM, 
-    XOST, XOTB, XOTC, XOTP, XPAC, XPAE, XPAL, XPAR, XPBT, XPET, 
-    XPHL, XPHO, XPHS, XPHX, XPIC, XPIN, XPLU, XPMC, XPMS, XPOL, 
-    XPOM, XPOR, XPOS, XPOT, XPOW, XPRA, XPRI, XPRM, XPSE, XPSF, 
-    XPST, XPSX, XPTY, XPUK, XPUS, XPVT, XPXE, XQLX, XQMH, XQOD, 
-    XQTX, XQUI, XRAS, XRBM, XRCB, XREP, XRFQ, XRIO, XRIS, XRMO, 
-    XRMS, XRMZ, XROS, XROT, XROV, XROX, XRPM, XRSP, XRTR, XRUS, 
-    XSAF, XSAM, XSAP, XSAT, XSAU, XSBI, XSBT, XSC1, XSC2, XSC3, 
-    XSCA, XSCE, XSCL, XSCO, XSCU, XSDX, XSEB, XSEC, XSEF, XSES, 
-    XSFA, XSFE, XSGA, XSGB, XSGE, XSGO, XSHE, XSHG, XSIB, XSIC, 
-    XSIM, XSLS, XSME, XSMP, XSOM, XSOP, XSPM, XSPS, XSRM, XSSC, 
-    XSSE, XSTC, XSTE, XSTF, XSTM, XSTO, XSTP, XSTU, XSTV, XSTX, 
-    XSUR, XSVA, XSWA, XSWB, XSWM, XSWO, XSWX, XTAA, XTAD, XTAE, 
-    XTAF, XTAI, XTAL, XTAM, XTAR, XTEH, XTFE, XTFF, XTFN, XTIR, 
-    XTK1, XTK2, XTK3, XTKA, XTKO, XTKS, XTKT, XTLX, XTND, XTNX, 
-    XTOE, XTPE, XTPZ, XTRA, XTRD, XTRN, XTRZ, XTSE, XTSX, XTUC, 
-    XTUN, XTUP, XTUR, XTXD, XTXE, XTXM, XUAX, XUBS, XUGA, XUKR, 
-    XULA, XUMP, XUNI, XUSE, XVAL, XVAR, XVES, XVIA, XVIE, XVLA, 
-    XVPA, XVPB, XVSE, XVTX, XWAP, XWAR, XWBO, XWCE, XWEE, XXSC, 
-    XXX0, XXXX, XYIE, XYKT, XZAG, XZAM, XZAP, XZCE, XZIM, YEM0, 
-    YKNA, YLDX, ZAF0, ZAPA, ZARX, ZBUL, ZBXE, ZERO, ZFXM, ZHEU, 
-    ZKBX, ZMB0, ZOBX, ZODM, ZWE0
-};
+}
 
-constexpr const char * const MarketId::m_codes[NUMMARKETID] = { "NOMARKET", 
-    "21XX", "24DX", "24EQ", "24EX", "3579", "360D", "360M", "360T", "360X", "3DXE", 
-    "4AXE", "A2XX", "AACA", "AAPA", "AATS", "ABAN", "ABFI", "ABNA", "ABNC", "ABSI", 
-    "ABUL", "ABW0", "ABXX", "ACCX", "ACEX", "ACKF", "ACXC", "ACXL", "ADRK", "ADVT", 
-    "AFDL", "AFET", "AFEX", "AFG0", "AFSA", "AFSE", "AFSI", "AFSL", "AFSO", "AFSX", 
-    "AFTS", "AGBP", "AGO0", "AIA0", "AILT", "AIMX", "AIXE", "AIXK", "AKIS", "ALA0", 
-    "ALB0", "ALDP", "ALGO", "ALLT", "ALPX", "ALSI", "ALTX", "ALXA", "ALXB", "ALXL", 
-    "ALXP", "AMLG", "AMNL", "AMPX", "AMTS", "AMXO", "AND0", "ANLP", "ANTS", "ANZL", 
-    "APAW", "APCL", "APEX", "APXL", "AQEA", "AQED", "AQEU", "AQSD", "AQSE", "AQSF", 
-    "AQSG", "AQSL", "AQSN", "AQST", "AQUA", "AQXA", "AQXD", "AQXE", "ARAX", "ARCB", 
-    "ARCD", "ARCE", "ARCH", "ARCO", "ARCX", "ARDA", "ARE0", "AREX", "ARG0", "ARIA", 
-    "ARKX", "ARM0", "ARTX", "ASEF", "ASEX", "ASM0", "ASMT", "ASPI", "ASPN", "ASTR", 
-    "ASXB", "ASXC", "ASXP", "ASXT", "ASXV", "ATAD", "ATDF", "ATF0", "ATFX", "ATG0", 
-    "ATHL", "ATLB", "ATLN", "ATSA", "AURB", "AURO", "AUS0", "AUT0", "AUTB", "AUTO", 
-    "AUTP", "AUTX", "AVEU", "AVXE", "AWBX", "AWEX", "AXIO", "AXSI", "AZE0", "BAAD", 
-    "BACE", "BACR", "BAEP", "BAIK", "BAIP", "BAJD", "BAJM", "BALT", "BAML", "BAMP", 
-    "BAMX", "BANA", "BAPA", "BAPE", "BAPX", "BARD", "BARK", "BARL", "BARO", "BART", 
-    "BARU", "BARX", "BASE", "BASI", "BASP", "BASX", "BATD", "BATE", "BATF", "BATO", 
-    "BATP", "BATS", "BATY", "BBIE", "BBIS", "BBLX", "BBOK", "BBSF", "BBSI", "BBSN", 
-    "BBSX", "BBVA", "BBVI", "BBVX", "BCDX", "BCEE", "BCFS", "BCMA", "BCMM", "BCRM", 
-    "BCSC", "BCSE", "BCSI", "BCSL", "BCXE", "BDEA", "BDI0", "BDPL", "BDSK", "BEAM", 
-    "BEBG", "BEEX", "BEIS", "BEL0", "BELB", "BELF", "BEN0", "BERA", "BERB", "BERC", 
-    "BES0", "BESA", "BETA", "BETP", "BETX", "BEUD", "BEUE", "BEUF", "BEUO", "BEUP", 
-    "BEUT", "BFA0", "BFEX", "BFPT", "BFSD", "BGCA", "BGCB", "BGCD", "BGCF", "BGCI", 
-    "BGCJ", "BGCM", "BGCO", "BGD0", "BGEM", "BGFI", "BGFU", "BGFX", "BGHX", "BGLU", 
-    "BGR0", "BGSG", "BGSI", "BGUK", "BHR0", "BHS0", "BHSF", "BHWA", "BIDS", "BIH0", 
-    "BILT", "BILU", "BINV", "BISI", "BIVA", "BJSE", "BKBF", "BKBR", "BKDM", "BKKT", 
-    "BKLF", "BKLN", "BKSK", "BLBB", "BLBF", "BLBS", "BLEQ", "BLEV", "BLFX", "BLIQ", 
-    "BLKX", "BLM0", "BLNK", "BLOX", "BLPX", "BLR0", "BLTD", "BLTX", "BLUE", "BLUX", 
-    "BLXA", "BLZ0", "BMCL", "BMCM", "BMEA", "BMEX", "BMFA", "BMFM", "BMFX", "BMLB", 
-    "BMLI", "BMLS", "BMLX", "BMSI", "BMTF", "BMTS", "BMU0", "BNDD", "BNDS", "BNLD", 
-    "BNPA", "BNPC", "BNPF", "BNPH", "BNPL", "BNPP", "BNPS", "BNPX", "BNSX", "BNTW", 
-    "BNYC", "BOAL", "BOAT", "BOCF", "BOFS", "BOL0", "BOND", "BOSC", "BOSD", "BOSP", 
-    "BOSS", "BOTC", "BOTE", "BOTV", "BOVA", "BOVM", "BPAG", "BPAS", "BPKO", "BPLC", 
-    "BPOL", "BPSX", "BPTE", "BPXD", "BPXR", "BPXX", "BRA0", "BRAE", "BRB0", "BRDE", 
-    "BRDL", "BRDS", "BREA", "BRED", "BRFQ", "BRGA", "BRIX", "BRMF", "BRN0", "BRNX", 
-    "BSAB", "BSEX", "BSFX", "BSGX", "BSLB", "BSME", "BSPL", "BSTX", "BTAM", "BTBS", 
-    "BTEA", "BTEC", "BTEE", "BTEQ", "BTFE", "BTLX", "BTN0", "BTNL", "BTQE", "BTQG", 
-    "BTRL", "BTSP", "BTUN", "BUKL", "BULK", "BURG", "BURM", "BUSA", "BUYN", "BVCA", 
-    "BVMF", "BVUK", "BVUR", "BVUS", "BWA0", "BXDA", "BYXD", "BZXD", "C2OX", "CABK", 
-    "CABV", "CAES", "CAF0", "CALH", "CAN0", "CAND", "CANX", "CAPA", "CAPI", "CAPL", 
-    "CASI", "CAST", "CATS", "CAVD", "CAVE", "CAZE", "CBAE", "CBAL", "CBKA", "CBKC", 
-    "CBKD", "CBKE", "CBKF", "CBKG", "CBKS", "CBLC", "CBLP", "CBMS", "CBNL", "CBOE", 
-    "CBSK", "CBSX", "CBTS", "CCEU", "CCEX", "CCFE", "CCFX", "CCK0", "CCLX", "CCML", 
-    "CCMS", "CCMX", "CCO2", "CCRM", "CCXE", "CDED", "CDEL", "CDNA", "CDSI", "CDSL", 
-    "CECA", "CECS", "CEDX", "CELP", "CEPL", "CEPU", "CESF", "CESI", "CETI", "CETO", 
-    "CEUD", "CEUE", "CEUO", "CEUX", "CFAU", "CFBC", "CFHK", "CFIC", "CFIF", "CFIL", 
-    "CFIM", "CFJP", "CFTW", "CGCM", "CGDB", "CGEB", "CGEC", "CGEE", "CGET", "CGGD", 
-    "CGIT", "CGMA", "CGMC", "CGMD", "CGME", "CGMG", "CGMH", "CGMI", "CGML", "CGMT", 
-    "CGMU", "CGMX", "CGND", "CGQD", "CGQT", "CGTR", "CGXS", "CHE0", "CHEV", "CHIA", 
-    "CHIC", "CHID", "CHIE", "CHIJ", "CHIO", "CHIS", "CHIV", "CHIX", "CHIY", "CHL0", 
-    "CHN0", "CIBC", "CIBH", "CIBP", "CICX", "CILH", "CIMA", "CIMB", "CIMD", "CIME", 
-    "CIMV", "CIOI", "CISD", "CITD", "CITX", "CIV0", "CLAU", "CLCH", "CLHK", "CLJP", 
-    "CLMX", "CLPH", "CLST", "CLTD", "CLVE", "CMAP", "CMCI", "CMCM", "CMEC", "CMED", 
-    "CMEE", "CMES", "CMET", "CMMT", "CMR0", "CMSF", "CMTS", "CNOD", "CNSI", "COAL", 
-    "COD0", "CODA", "COG0", "COHR", "COK0", "COL0", "COM0", "COMG", "COMM", "CONC", 
-    "CONE", "CORE", "COTC", "CPGX", "CPTX", "CPV0", "CRBX", "CRDL", "CRED", "CREM", 
-    "CRI0", "CRSX", "CRYD", "CRYP", "CRYX", "CSAG", "CSAS", "CSAU", "CSBX", "CSCF", 
-    "CSCL", "CSDA", "CSE2", "CSEC", "CSEU", "CSFB", "CSGI", "CSHK", "CSIN", "CSJP", 
-    "CSLB", "CSLP", "CSMD", "CSOB", "CSOT", "CSSI", "CSSX", "CSTO", "CSVW", "CSZH", 
-    "CTCC", "CTDD", "CTS3", "CTSS", "CTWO", "CUB0", "CULV", "CURX", "CUW0", "CXAB", 
-    "CXAC", "CXAE", "CXAF", "CXAI", "CXAM", "CXAN", "CXAP", "CXAQ", "CXAR", "CXAV", 
-    "CXAW", "CXOT", "CXR0", "CXRT", "CYM0", "CYP0", "CZE0", "D2XC", "D2XG", "DAIW", 
-    "DAMP", "DAMS", "DAPA", "DASE", "DASH", "DASI", "DAUK", "DAVY", "DBAB", "DBAG", 
-    "DBCR", "DBCX", "DBDC", "DBDX", "DBES", "DBHK", "DBIX", "DBLN", "DBLX", "DBMO", 
-    "DBOX", "DBRU", "DBSE", "DBSX", "DBVX", "DBXT", "DCAS", "DCSE", "DCSX", "DDTX", 
-    "DDUB", "DEAL", "DEKA", "DEU0", "DEXE", "DGCX", "DHEL", "DHLX", "DICE", "DIFX", 
-    "DJI0", "DKED", "DKFI", "DKOB", "DKTC", "DKWB", "DLIS", "DMA0", "DMAD", "DMIL", 
-    "DNDK", "DNFI", "DNIS", "DNK0", "DNSE", "DOM0", "DOSE", "DOSL", "DOTS", "DOWE", 
-    "DOWG", "DOWM", "DPAR", "DRCT", "DRSP", "DSMD", "DSME", "DSTO", "DUMX", "DUSA", 
-    "DUSB", "DUSC", "DUSD", "DVFX", "DWFI", "DWIN", "DWSF", "DZA0", "DZBK", "EACM", 
-    "EBHU", "EBLX", "EBMX", "EBON", "EBRA", "EBSC", "EBSD", "EBSF", "EBSI", "EBSM", 
-    "EBSN", "EBSO", "EBSS", "EBSX", "EBXV", "ECAG", "ECAL", "ECEU", "ECGS", "ECHO", 
-    "ECNL", "ECSL", "ECU0", "ECXE", "EDBT", "EDDP", "EDGA", "EDGD", "EDGE", "EDGL", 
-    "EDGO", "EDGX", "EDRF", "EDXM", "EEAL", "EESE", "EESX", "EFTP", "EGMT", "EGSI", 
-    "EGY0", "EIXE", "ELEU", "ELIX", "ELNO", "ELSE", "ELUK", "ELXE", "EM3S", "EMBX", 
-    "EMCE", "EMCH", "EMDR", "EMIB", "EMID", "EMIR", "EMLD", "EMTF", "EMTS", "ENAX", 
-    "ENCL", "ENMS", "ENSL", "ENSX", "ENSY", "ENTW", "ENXB", "ENXL", "EOTC", "EPEX", 
-    "EPRD", "EPRL", "EQCA", "EQIE", "EQLD", "EQOC", "EQOD", "EQOS", "EQSE", "EQSL", 
-    "EQTA", "EQTB", "EQTC", "EQTD", "EQUS", "EQWB", "ERBX", "ERFQ", "ERI0", "ERIS", 
-    "ERST", "ESH0", "ESLO", "ESP0", "ESPD", "EST0", "ESTO", "ETFP", "ETH0", "ETLX", 
-    "ETOR", "ETPA", "ETSC", "EUAX", "EUCC", "EUCH", "EUFN", "EUOB", "EURM", "EUSC", 
-    "EUSP", "EUWA", "EUWB", "EUWX", "EVOL", "EWRM", "EWSM", "EXAA", "EXBO", "EXCP", 
-    "EXDC", "EXEU", "EXGM", "EXIX", "EXLP", "EXMP", "EXOR", "EXOT", "EXPA", "EXPM", 
-    "EXSB", "EXSD", "EXSE", "EXSF", "EXSH", "EXSI", "EXSP", "EXSY", "EXTR", "EXVP", 
-    "EXYY", "FAIR", "FAST", "FBSI", "FCBT", "FCME", "FGEX", "FGML", "FGMP", "FICO", 
-    "FICX", "FIED", "FIN0", "FINC", "FINN", "FINO", "FINR", "FINY", "FISH", "FISU", 
-    "FJI0", "FLK0", "FLTB", "FLTR", "FLWX", "FMTS", "FMXS", "FMXX", "FNCS", "FNDF", 
-    "FNDK", "FNDS", "FNEE", "FNFI", "FNFT", "FNFX", "FNIS", "FNIX", "FNLT", "FNLV", 
-    "FNSE", "FNUK", "FNXB", "FPWB", "FRA0", "FRAA", "FRAB", "FRAD", "FRAS", "FRAU", 
-    "FRAV", "FRAW", "FREI", "FREX", "FRO0", "FRRF", "FRTE", "FSEF", "FSHX", "FSM0", 
-    "FSME", "FTFM", "FTFS", "FTRM", "FTUS", "FUSD", "FXAL", "FXCL", "FXCM", "FXFM", 
-    "FXGB", "FXMT", "FXNM", "FXOP", "FXPS", "FXRQ", "FXRS", "FXSM", "FXSW", "G1XX", 
-    "G360", "GAB0", "GARA", "GBOB", "GBOT", "GBR0", "GBSI", "GBUL", "GBWB", "GEMX", 
-    "GEO0", "GETB", "GFAM", "GFAU", "GFBM", "GFBO", "GFEX", "GFIA", "GFIB", "GFIC", 
-    "GFIF", "GFIM", "GFIN", "GFIR", "GFKS", "GFOX", "GFPO", "GFSG", "GFSM", "GFSO", 
-    "GGY0", "GHA0", "GIB0", "GIN0", "GIPB", "GLBX", "GLLC", "GLMX", "GLOM", "GLP0", 
-    "GLPS", "GLPX", "GMB0", "GMBG", "GMEG", "GMEO", "GMES", "GMEX", "GMGD", "GMGE", 
-    "GMGL", "GMNI", "GMTF", "GMTS", "GNB0", "GNQ0", "GOTC", "GOVX", "GPBC", "GRC0", 
-    "GRD0", "GREE", "GRIF", "GRIO", "GRL0", "GROW", "GRSE", "GSAL", "GSBE", "GSBS", 
-    "GSBX", "GSCI", "GSCO", "GSEF", "GSEI", "GSIB", "GSIL", "GSLO", "GSPL", "GSPX", 
-    "GSSI", "GSXC", "GSXH", "GSXK", "GSXL", "GSXM", "GSXN", "GSXT", "GTCO", "GTM0", 
-    "GTSM", "GTSX", "GTXE", "GTXS", "GUF0", "GUM0", "GUY0", "GXGF", "GXGM", "GXGR", 
-    "GXMA", "HAMA", "HAMB", "HAML", "HAMM", "HAMN", "HANA", "HANB", "HANC", "HAND", 
-    "HANE", "HBFR", "HBPL", "HCER", "HCHC", "HDAT", "HEDE", "HEGX", "HELA", "HEMO", 
-    "HESP", "HGSP", "HKG0", "HKME", "HMOD", "HMTF", "HND0", "HOTC", "HPCO", "HPCS", 
-    "HPCV", "HPCX", "HPPO", "HPSO", "HPSX", "HREU", "HRFQ", "HRSI", "HRTF", "HRTX", 
-    "HRV0", "HSBC", "HSBT", "HSFX", "HSTC", "HSXA", "HSXE", "HTI0", "HUDX", "HUN0", 
-    "HUNG", "HUPX", "HWHE", "IATS", "IBAL", "IBCO", "IBEQ", "IBER", "IBEX", "IBGH", 
-    "IBIS", "IBKR", "IBLX", "IBSC", "IBSI", "IBUL", "ICAH", "ICAP", "ICAS", "ICAT", 
-    "ICBX", "ICDX", "ICEL", "ICEN", "ICEO", "ICES", "ICEU", "ICHK", "ICKR", "ICOR", 
-    "ICOT", "ICPM", "ICPS", "ICRO", "ICSE", "ICSH", "ICSU", "ICSZ", "ICTQ", "ICTW", 
-    "ICUR", "ICUS", "ICXL", "ICXR", "IDN0", "IDXM", "IEBS", "IECE", "IECL", "IENG", 
-    "IEOS", "IEPA", "IEXA", "IEXC", "IEXD", "IEXG", "IFAD", "IFBX", "IFCA", "IFED", 
-    "IFEN", "IFEU", "IFFX", "IFLL", "IFLO", "IFLS", "IFLX", "IFSG", "IFSM", "IFUS", 
-    "IFUT", "IFXA", "IFXC", "IFXR", "IGDL", "IIDX", "IINX", "IKBS", "ILCM", "IMAG", 
-    "IMBD", "IMCC", "IMCD", "IMCE", "IMCG", "IMCM", "IMCO", "IMCR", "IMCS", "IMCT", 
-    "IMED", "IMEN", "IMEQ", "IMET", "IMEX", "IMFD", "IMFX", "IMGB", "IMGI", "IMIR", 
-    "IMMH", "IMMM", "IMN0", "IMRD", "IMSB", "IMTF", "IMTS", "INCA", "INCR", "IND0", 
-    "INFT", "INGB", "INGE", "INGF", "INGS", "INGU", "INGW", "INSE", "INSR", "INTL", 
-    "INVE", "IOCD", "IOED", "IOFB", "IOFI", "IOFX", "IOGB", "IOGI", "IOIR", "IOMM", 
-    "IOT0", "IOTC", "IOTF", "IPNL", "IPSX", "IPXP", "IPXW", "IRL0", "IRN0", "IRQ0", 
-    "ISBA", "ISBV", "ISDA", "ISDX", "ISEC", "ISEX", "ISL0", "ISR0", "ISSI", "ISWA", 
-    "ISWB", "ISWC", "ISWE", "ISWN", "ISWO", "ISWP", "ISWQ", "ISWR", "ISWT", "ISWV", 
-    "ITA0", "ITGI", "ITGL", "ITSL", "ITSM", "IUOB", "IVWP", "IVZX", "IXSP", "JADX", 
-    "JAM0", "JASR", "JATA", "JBSI", "JBUL", "JEFA", "JEFE", "JEFS", "JEFX", "JESI", 
-    "JEY0", "JISI", "JLEQ", "JLEU", "JLQD", "JLSI", "JNSI", "JNST", "JOR0", "JPBX", 
-    "JPCB", "JPEU", "JPJX", "JPMI", "JPMS", "JPMX", "JPN0", "JPSI", "JSEB", "JSEF", 
-    "JSER", "JSES", "JSJX", "JSSI", "JYSI", "KABU", "KAIX", "KASH", "KAZ0", "KBCB", 
-    "KBLC", "KBLL", "KBLM", "KBLS", "KBLT", "KCCP", "KDPW", "KELR", "KEN0", "KGZ0", 
-    "KHHU", "KHM0", "KIR0", "KLEU", "KLSH", "KMTS", "KMUX", "KNA0", "KNCM", "KNEM", 
-    "KNIG", "KNLI", "KNMX", "KOCN", "KOME", "KOR0", "KOTF", "KRME", "KWT0", "LAFD", 
-    "LAFL", "LAFX", "LAKE", "LAKX", "LAMP", "LAO0", "LASF", "LASP", "LATG", "LAVA", 
-    "LBBW", "LBCM", "LBCW", "LBN0", "LBR0", "LBUL", "LBWL", "LBWS", "LBY0", "LCA0", 
-    "LCHC", "LCUR", "LCXE", "LEBV", "LEDG", "LELE", "LESI", "LEUE", "LEUF", "LEVL", 
-    "LICA", "LIDR", "LIE0", "LIFI", "LIGA", "LINX", "LIQF", "LIQH", "LIQU", "LISX", 
-    "LISZ", "LIUH", "LIUS", "LKA0", "LLAT", "LMAD", "LMAE", "LMAF", "LMAO", "LMAS", 
-    "LMAX", "LMEC", "LMNR", "LMNX", "LMTS", "LNEQ", "LNFI", "LOOP", "LOTC", "LOUI", 
-    "LOYD", "LPPM", "LPSF", "LQED", "LQFI", "LSO0", "LSSI", "LTAA", "LTSE", "LTU0", 
-    "LUX0", "LVA0", "LXJP", "LYNX", "M2AE", "MABX", "MAC0", "MACB", "MACX", "MAEL", 
-    "MAF0", "MAGM", "MAKX", "MALM", "MALX", "MANL", "MAQE", "MAQH", "MAQI", "MAQJ", 
-    "MAQL", "MAQU", "MAQX", "MAR0", "MARF", "MASG", "MATN", "MATX", "MAXD", "MBCP", 
-    "MBPL", "MBSI", "MBUL", "MCAD", "MCID", "MCO0", "MCRY", "MCSE", "MCUR", "MCXR", 
-    "MCXS", "MCXX", "MCZK", "MDA0", "MDG0", "MDIP", "MDRV", "MDV0", "MEAU", "MEHK", 
-    "MELO", "MEMD", "MEMM", "MEMX", "MEPX", "MERD", "MERF", "MERK", "MESI", "MESQ", 
-    "METZ", "MEX0", "MFGL", "MFOX", "MFXA", "MFXC", "MFXR", "MHBD", "MHBE", "MHBL", 
-    "MHBP", "MHEL", "MHEU", "MHIP", "MHL0", "MIBG", "MIBL", "MICE", "MIDC", "MIHI", 
-    "MISX", "MIVX", "MIZX", "MKAA", "MKAP", "MKD0", "MKTF", "MLAX", "MLCO", "MLER", 
-    "MLES", "MLEU", "MLEX", "MLI0", "MLIB", "MLIX", "MLRQ", "MLSI", "MLT0", "MLVE", 
-    "MLVX", "MLXB", "MLXN", "MMR0", "MNDK", "MNE0", "MNFI", "MNG0", "MNIS", "MNP0", 
-    "MNSE", "MOCX", "MOON", "MOSE", "MOTX", "MOZ0", "MPRL", "MRT0", "MSAL", "MSAX", 
-    "MSBI", "MSCO", "MSCX", "MSDM", "MSEL", "MSEU", "MSIP", "MSLC", "MSLP", "MSMS", 
-    "MSNT", "MSPL", "MSR0", "MSRP", "MSSA", "MSSI", "MSTC", "MSTO", "MSTX", "MSWP", 
-    "MSXB", "MSXO", "MTAA", "MTAH", "MTAX", "MTCH", "MTQ0", "MTSA", "MTSB", "MTSC", 
-    "MTSD", "MTSF", "MTSG", "MTSM", "MTSO", "MTSP", "MTSS", "MTSW", "MTUS", "MTXA", 
-    "MTXC", "MTXM", "MTXS", "MTXX", "MUBE", "MUBL", "MUBM", "MUBP", "MUDX", "MUFP", 
-    "MUNA", "MUNB", "MUNC", "MUND", "MUS0", "MUSE", "MUSN", "MUTI", "MVCX", "MWI0", 
-    "MXLM", "MXNL", "MXOP", "MYS0", "MYT0", "MYTR", "N2EX", "NABA", "NABE", "NABL", 
-    "NABP", "NABU", "NAM0", "NAMX", "NAPA", "NASB", "NASD", "NASN", "NASX", "NATX", 
-    "NAVE", "NBFL", "NBLX", "NBOT", "NBXO", "NCEL", "NCL0", "NCME", "NCML", "NDCM", 
-    "NDEX", "NDXS", "NECD", "NEEQ", "NEOC", "NEOD", "NEOE", "NEON", "NER0", "NESI", 
-    "NEXD", "NEXF", "NEXG", "NEXL", "NEXN", "NEXO", "NEXS", "NEXT", "NEXX", "NEXY", 
-    "NFK0", "NFSA", "NFSC", "NFSD", "NGA0", "NGXC", "NIBC", "NIBR", "NIC0", "NILX", 
-    "NIU0", "NLAX", "NLBX", "NLD0", "NLPX", "NMCE", "NMRA", "NMRJ", "NMSX", "NMTF", 
-    "NMTS", "NNCS", "NOCO", "NODX", "NOED", "NOFF", "NOFI", "NOME", "NOOB", "NOPS", 
-    "NOR0", "NORD", "NORX", "NOSC", "NOSI", "NOTC", "NOWB", "NOWX", "NPEX", "NPGA", 
-    "NPL0", "NPMS", "NRU0", "NSME", "NSPO", "NSSA", "NSXB", "NTRL", "NTUK", "NURD", 
-    "NURO", "NWMS", "NWNV", "NXBX", "NXEU", "NXFO", "NXJP", "NXSE", "NXTE", "NXUS", 
-    "NXVW", "NYFX", "NYMS", "NYMX", "NYPC", "NYSD", "NYSI", "NZFX", "NZL0", "NZXC", 
-    "NZXD", "NZXM", "O360", "OAPA", "OBGE", "OBKL", "OCEA", "OCFX", "OCSI", "OCTC", 
-    "OCTL", "OCTU", "OCXE", "OCXL", "ODDO", "ODOC", "ODST", "ODXE", "OFEX", "OHVO", 
-    "OILX", "OLBB", "OLLC", "OMEL", "OMGA", "OMIC", "OMIP", "OMN0", "ONEC", "ONEP", 
-    "ONEX", "ONSE", "OOTC", "OPCO", "OPEX", "OPMX", "OPRA", "OPSI", "OPTX", "OSDS", 
-    "OSLC", "OSSG", "OTCB", "OTCD", "OTCE", "OTCI", "OTCM", "OTCN", "OTCO", "OTCQ", 
-    "OTCX", "OTEU", "OTPB", "OTPR", "OTXB", "OTXT", "OYLD", "PAK0", "PAN0", "PARK", 
-    "PARX", "PATF", "PAVE", "PBGR", "PBUL", "PCDS", "PCN0", "PCSE", "PDEX", "PDQD", 
-    "PDQX", "PEEL", "PEPH", "PEPM", "PEPQ", "PEPW", "PEPY", "PER0", "PERP", "PESL", 
-    "PEUR", "PFSE", "PFTQ", "PFTS", "PFXD", "PGSL", "PGTP", "PHEL", "PHL0", "PHSI", 
-    "PIEU", "PINC", "PINI", "PINL", "PINX", "PIPE", "PIPR", "PIRM", "PJCX", "PKOP", 
-    "PLDX", "PLPD", "PLPO", "PLPS", "PLPX", "PLSX", "PLUS", "PLW0", "PMTS", "PMXX", 
-    "PNED", "PNG0", "POEE", "POL0", "PORT", "POSE", "POTC", "POTL", "PPEX", "PRI0", 
-    "PRK0", "PRME", "PROS", "PRSE", "PRT0", "PRY0", "PSE0", "PSGM", "PSTO", "PSXD", 
-    "PTPG", "PULX", "PUMA", "PUMX", "PUND", "PURE", "PVBL", "PVMF", "PXIL", "PYF0", 
-    "QAT0", "QCEX", "QMTF", "QMTS", "QUNT", "QWIK", "QWIX", "R5FX", "RABL", "RABO", 
-    "RAJA", "RBCB", "RBCC", "RBCE", "RBCG", "RBCM", "RBCS", "RBCT", "RBEX", "RBHU", 
-    "RBIV", "RBSI", "RBSX", "RCBX", "RCMA", "RENC", "RESE", "RESF", "REST", "REU0", 
-    "REVX", "RFBK", "RFIM", "RFQN", "RFQS", "RFQU", "RICD", "RICX", "RITS", "RJXX", 
-    "RLBO", "RMMS", "RMMX", "RMTF", "RMTS", "ROCO", "ROFX", "ROSR", "ROTC", "ROU0", 
-    "RPDX", "RPWC", "RR4G", "RRSI", "RSEX", "RTSI", "RTSL", "RTSP", "RTSX", "RTXF", 
-    "RULE", "RUS0", "RUSX", "RVSA", "RWA0", "S360", "S3FM", "SAGE", "SANT", "SAU0", 
-    "SB1M", "SBAR", "SBEX", "SBIC", "SBIJ", "SBIL", "SBIU", "SBIV", "SBMF", "SBSI", 
-    "SCAG", "SCLB", "SCLE", "SCOT", "SCXA", "SCXF", "SCXM", "SCXO", "SCXS", "SDN0", 
-    "SEBA", "SEBL", "SEBS", "SEBX", "SECC", "SECD", "SECE", "SECF", "SEDC", "SEDR", 
-    "SEDX", "SEED", "SELC", "SEMX", "SEN0", "SEND", "SEOB", "SEPE", "SEWB", "SFCL", 
-    "SFMP", "SFOX", "SGA2", "SGAS", "SGBX", "SGEX", "SGMA", "SGMT", "SGMU", "SGMV", 
-    "SGMW", "SGMX", "SGMY", "SGMZ", "SGOE", "SGP0", "SGS0", "SHAD", "SHAR", "SHAW", 
-    "SHN0", "SHSC", "SIAB", "SIBC", "SICS", "SIDX", "SIFX", "SIGA", "SIGH", "SIGJ", 
-    "SIGX", "SIMD", "SIMV", "SISI", "SISU", "SJM0", "SKBB", "SKSI", "SKYX", "SLB0", 
-    "SLE0", "SLHB", "SLKK", "SLV0", "SLXT", "SMBB", "SMBC", "SMBD", "SMBE", "SMBG", 
-    "SMBP", "SMEX", "SMFE", "SMFF", "SMR0", "SMTS", "SNSI", "SNUK", "SOHO", "SOM0", 
-    "SPAD", "SPAX", "SPBE", "SPDK", "SPDX", "SPEC", "SPEU", "SPEX", "SPFI", "SPHR", 
-    "SPIM", "SPM0", "SPNO", "SPRZ", "SPSD", "SPTR", "SPTX", "SPXE", "SQUA", "SRB0", 
-    "SRPT", "SSBI", "SSBM", "SSBT", "SSD0", "SSEX", "SSFX", "SSIL", "SSME", "SSOB", 
-    "SSTX", "SSWM", "STAL", "STAN", "STEE", "STFL", "STFU", "STFX", "STOX", "STP0", 
-    "STRM", "STRT", "STSI", "STUA", "STUB", "STUC", "STUD", "STUE", "STUF", "STUH", 
-    "STXS", "STXX", "SUNB", "SUNM", "SUNO", "SUNT", "SUR0", "SVES", "SVEX", "SVK0", 
-    "SVN0", "SVXI", "SWAP", "SWBI", "SWE0", "SWEE", "SWLT", "SWLV", "SWZ0", "SXM0", 
-    "SXSI", "SYC0", "SYFX", "SYNK", "SYR0", "SZSC", "T212", "TBEN", "TBLA", "TBSA", 
-    "TBSP", "TCA0", "TCD0", "TCDS", "TCME", "TCML", "TDBL", "TDGF", "TDON", "TDSX", 
-    "TDVS", "TDXS", "TECO", "TEEG", "TEFD", "TEFX", "TEGB", "TEGI", "TEIR", "TEMB", 
-    "TEMC", "TEMF", "TEMG", "TEMI", "TEMM", "TEMR", "TEOF", "TEPF", "TEPG", "TEPI", 
-    "TEPM", "TEPR", "TEPX", "TERA", "TERE", "TERM", "TEUR", "TFEX", "TFSA", "TFSC", 
-    "TFSD", "TFSE", "TFSG", "TFSS", "TFSU", "TFSV", "TGAT", "TGO0", "TGSI", "THA0", 
-    "THEM", "THRD", "THRE", "TICT", "TIRD", "TJK0", "TKL0", "TKM0", "TLAB", "TLCM", 
-    "TLS0", "TMCC", "TMCY", "TMEU", "TMEX", "TMID", "TMTS", "TMUK", "TMXS", "TNLA", 
-    "TNLB", "TNLK", "TNLL", "TOCP", "TOMD", "TOMF", "TOMG", "TOMX", "TON0", "TOWR", 
-    "TPCD", "TPDA", "TPDE", "TPDR", "TPEE", "TPEL", "TPEO", "TPEQ", "TPER", "TPES", 
-    "TPEU", "TPFD", "TPFR", "TPIC", "TPID", "TPIE", "TPIM", "TPIO", "TPIR", "TPIS", 
-    "TPLF", "TPMF", "TPMG", "TPRE", "TPSB", "TPSD", "TPSE", "TPSG", "TPSL", "TPSO", 
-    "TPSP", "TPSV", "TPSY", "TQEA", "TQEB", "TQEM", "TQEX", "TRAI", "TRAL", "TRAS", 
-    "TRAX", "TRBX", "TRCK", "TRCX", "TRDC", "TRDE", "TRDX", "TREA", "TREO", "TREU", 
-    "TRFW", "TRFX", "TRIE", "TRNL", "TRPX", "TRQA", "TRQB", "TRQC", "TRQD", "TRQM", 
-    "TRQS", "TRQX", "TRSI", "TRU1", "TRU2", "TRUK", "TRUX", "TRWB", "TRXE", "TSAD", 
-    "TSAF", "TSBF", "TSBX", "TSCB", "TSCD", "TSED", "TSEF", "TSFF", "TSFG", "TSFI", 
-    "TSFX", "TSGB", "TSGI", "TSIG", "TSIR", "TSMB", "TSMC", "TSMG", "TSMI", "TSMM", 
-    "TSMR", "TSRE", "TSUK", "TTO0", "TUN0", "TUOB", "TUR0", "TUV0", "TWEA", "TWEM", 
-    "TWEO", "TWEU", "TWGP", "TWHK", "TWJP", "TWJT", "TWN0", "TWSA", "TWSF", "TWSG", 
-    "TXBA", "TXSD", "TXSE", "TZA0", "U360", "UBCZ", "UBEC", "UBIM", "UBIN", "UBIS", 
-    "UBSA", "UBSB", "UBSC", "UBSD", "UBSE", "UBSF", "UBSG", "UBSI", "UBSL", "UBSP", 
-    "UBSS", "UBST", "UBSX", "UBSY", "UCBA", "UCBG", "UCDE", "UCHU", "UCIT", "UFEX", 
-    "UGA0", "UGEN", "UICE", "UKCA", "UKEX", "UKGD", "UKOR", "UKPX", "UKR0", "UKRE", 
-    "ULTX", "UMTS", "UNGB", "URCE", "URY0", "USA0", "USEF", "USOB", "USWB", "USWP", 
-    "UTSL", "UZB0", "VABD", "VAGL", "VAGM", "VALX", "VAMS", "VAT0", "VAVO", "VCMO", 
-    "VCRS", "VCT0", "VDRK", "VEGA", "VEN0", "VERT", "VFCM", "VFEX", "VFGB", "VFIL", 
-    "VFMI", "VFSI", "VFUK", "VFXO", "VGB0", "VIR0", "VIRT", "VIUK", "VKAB", "VLEX", 
-    "VMEX", "VMFX", "VMTS", "VNDM", "VNM0", "VOLA", "VONT", "VPXB", "VRXP", "VTBC", 
-    "VTEX", "VTLS", "VTPS", "VUBA", "VUSA", "VUT0", "VWAP", "VWDA", "VWDX", "WABR", 
-    "WBAH", "WBCL", "WBDM", "WBGF", "WBKP", "WBLC", "WBMA", "WBON", "WCDE", "WCLK", 
-    "WDER", "WEED", "WELN", "WELS", "WELX", "WETP", "WFLB", "WFLP", "WFSE", "WGAS", 
-    "WIND", "WINS", "WINX", "WIPO", "WLF0", "WMFS", "WMSL", "WMSW", "WMTF", "WMUS", 
-    "WOOD", "WOPO", "WQXL", "WSAG", "WSBL", "WSIL", "WSIN", "WSM0", "WTRS", "XA1X", 
-    "XABC", "XABG", "XABJ", "XABX", "XACD", "XACE", "XADE", "XADF", "XADS", "XAEX", 
-    "XAFR", "XAFX", "XAIM", "XALB", "XALG", "XALS", "XALT", "XAMC", "XAMM", "XAMS", 
-    "XAND", "XANM", "XANS", "XANT", "XAOM", "XAPA", "XAPI", "XAQS", "XARC", "XARM", 
-    "XASE", "XASM", "XASX", "XATH", "XATL", "XATS", "XATX", "XAUK", "XAZX", "XBAA", 
-    "XBAB", "XBAH", "XBAN", "XBAR", "XBAV", "XBBF", "XBBJ", "XBBK", "XBCC", "XBCE", 
-    "XBCL", "XBCM", "XBCV", "XBCX", "XBDA", "XBDV", "XBEL", "XBER", "XBES", "XBEY", 
-    "XBFO", "XBIL", "XBIS", "XBKF", "XBKK", "XBLB", "XBLK", "XBLN", "XBMF", "XBMK", 
-    "XBND", "XBNV", "XBOG", "XBOL", "XBOM", "XBOS", "XBOT", "XBOX", "XBRA", "XBRD", 
-    "XBRE", "XBRM", "XBRN", "XBRT", "XBRU", "XBRV", "XBRY", "XBSD", "XBSE", "XBSP", 
-    "XBTF", "XBTR", "XBUD", "XBUE", "XBUL", "XBVC", "XBVM", "XBVP", "XBVR", "XBXO", 
-    "XCAI", "XCAL", "XCAN", "XCAR", "XCAS", "XCAY", "XCBD", "XCBF", "XCBO", "XCBT", 
-    "XCCE", "XCCX", "XCDE", "XCEC", "XCEF", "XCEG", "XCET", "XCFE", "XCFF", "XCGS", 
-    "XCHG", "XCHI", "XCIE", "XCIS", "XCME", "XCNF", "XCNQ", "XCOL", "XCOR", "XCRC", 
-    "XCRO", "XCSC", "XCSE", "XCSX", "XCTS", "XCUE", "XCUR", "XCVD", "XCX2", "XCXD", 
-    "XCYO", "XCYS", "XDAR", "XDBC", "XDBV", "XDBX", "XDCE", "XDES", "XDEX", "XDFB", 
-    "XDFM", "XDHA", "XDLP", "XDMI", "XDNB", "XDPA", "XDRF", "XDRK", "XDSE", "XDSM", 
-    "XDSX", "XDTB", "XDUB", "XDUS", "XDWZ", "XEAS", "XEBI", "XEBS", "XECB", "XECC", 
-    "XECM", "XECO", "XECS", "XEDA", "XEDX", "XEEE", "XEEO", "XEER", "XEHQ", "XEID", 
-    "XELX", "XEMA", "XEMB", "XEMD", "XEMI", "XEMS", "XEQT", "XEQY", "XERE", "XERT", 
-    "XESM", "XETA", "XETB", "XETC", "XETD", "XETE", "XETF", "XETI", "XETR", "XETS", 
-    "XETU", "XETV", "XETW", "XETX", "XEUB", "XEUC", "XEUE", "XEUI", "XEUM", "XEUP", 
-    "XEUR", "XEUS", "XEYE", "XFCI", "XFCM", "XFDA", "XFEX", "XFFE", "XFKA", "XFMN", 
-    "XFND", "XFNO", "XFNX", "XFOM", "XFRA", "XFTA", "XFTX", "XGAI", "XGAS", "XGAT", 
-    "XGCL", "XGCX", "XGDX", "XGEM", "XGFI", "XGGI", "XGHA", "XGLO", "XGME", "XGMX", 
-    "XGRM", "XGSE", "XGSX", "XGTG", "XGUA", "XHAM", "XHAN", "XHCE", "XHEL", "XHER", 
-    "XHFT", "XHIR", "XHKF", "XHKG", "XHNF", "XHNX", "XHON", "XIAB", "XIBE", "XICB", 
-    "XICE", "XICX", "XIDX", "XIEL", "XIEX", "XIGG", "XIHK", "XIJP", "XIMA", "XIMC", 
-    "XIME", "XIMM", "XIMX", "XINE", "XINS", "XINV", "XIOM", "XIPE", "XIPO", "XIQS", 
-    "XISA", "XISE", "XISL", "XIST", "XISX", "XJAM", "XJAS", "XJAX", "XJKT", "XJNB", 
-    "XJPX", "XJSE", "XJWY", "XKAC", "XKAR", "XKAZ", "XKBT", "XKCE", "XKCM", "XKEM", 
-    "XKFB", "XKFE", "XKGT", "XKHA", "XKHR", "XKIE", "XKIS", "XKKT", "XKLS", "XKON", 
-    "XKOR", "XKOS", "XKRX", "XKSE", "XKST", "XKUW", "XKYO", "XLAH", "XLAO", "XLAT", 
-    "XLBM", "XLCE", "XLCH", "XLDN", "XLDX", "XLFX", "XLGT", "XLIF", "XLIM", "XLIS", 
-    "XLIT", "XLJM", "XLJS", "XLJU", "XLLB", "XLME", "XLOD", "XLOF", "XLOM", "XLON", 
-    "XLQC", "XLSM", "XLTO", "XLUS", "XLUX", "XMAB", "XMAC", "XMAD", "XMAE", "XMAI", 
-    "XMAL", "XMAN", "XMAP", "XMAT", "XMAU", "XMCE", "XMDG", "XMDS", "XMEF", "XMER", 
-    "XMEV", "XMEX", "XMFE", "XMFX", "XMGE", "XMIC", "XMID", "XMIF", "XMIL", "XMIO", 
-    "XMLI", "XMLX", "XMME", "XMNT", "XMNX", "XMOC", "XMOD", "XMOL", "XMON", "XMOO", 
-    "XMOS", "XMOT", "XMPW", "XMRV", "XMSM", "XMSW", "XMTB", "XMTI", "XMTS", "XMUN", 
-    "XMUS", "XMVL", "XNAF", "XNAI", "XNAM", "XNAS", "XNCD", "XNCM", "XNCO", "XNDQ", 
-    "XNDU", "XNDX", "XNEC", "XNEE", "XNEP", "XNEW", "XNFI", "XNGM", "XNGO", "XNGS", 
-    "XNII", "XNIM", "XNKS", "XNLI", "XNLX", "XNMR", "XNMS", "XNOM", "XNOR", "XNQL", 
-    "XNRG", "XNSA", "XNSE", "XNST", "XNXC", "XNXD", "XNYC", "XNYE", "XNYF", "XNYL", 
-    "XNYM", "XNYS", "XNZE", "XOAA", "XOAD", "XOAM", "XOAS", "XOBD", "XOCH", "XODE", 
-    "XOFF", "XOME", "XOPV", "XOSA", "XOSC", "XOSD", "XOSE", "XOSJ", "XOSL", "XOSM", 
-    "XOST", "XOTB", "XOTC", "XOTP", "XPAC", "XPAE", "XPAL", "XPAR", "XPBT", "XPET", 
-    "XPHL", "XPHO", "XPHS", "XPHX", "XPIC", "XPIN", "XPLU", "XPMC", "XPMS", "XPOL", 
-    "XPOM", "XPOR", "XPOS", "XPOT", "XPOW", "XPRA", "XPRI", "XPRM", "XPSE", "XPSF", 
-    "XPST", "XPSX", "XPTY", "XPUK", "XPUS", "XPVT", "XPXE", "XQLX", "XQMH", "XQOD", 
-    "XQTX", "XQUI", "XRAS", "XRBM", "XRCB", "XREP", "XRFQ", "XRIO", "XRIS", "XRMO", 
-    "XRMS", "XRMZ", "XROS", "XROT", "XROV", "XROX", "XRPM", "XRSP", "XRTR", "XRUS", 
-    "XSAF", "XSAM", "XSAP", "XSAT", "XSAU", "XSBI", "XSBT", "XSC1", "XSC2", "XSC3", 
-    "XSCA", "XSCE", "XSCL", "XSCO", "XSCU", "XSDX", "XSEB", "XSEC", "XSEF", "XSES", 
-    "XSFA", "XSFE", "XSGA", "XSGB", "XSGE", "XSGO", "XSHE", "XSHG", "XSIB", "XSIC", 
-    "XSIM", "XSLS", "XSME", "XSMP", "XSOM", "XSOP", "XSPM", "XSPS", "XSRM", "XSSC", 
-    "XSSE", "XSTC", "XSTE", "XSTF", "XSTM", "XSTO", "XSTP", "XSTU", "XSTV", "XSTX", 
-    "XSUR", "XSVA", "XSWA", "XSWB", "XSWM", "XSWO", "XSWX", "XTAA", "XTAD", "XTAE", 
-    "XTAF", "XTAI", "XTAL", "XTAM", "XTAR", "XTEH", "XTFE", "XTFF", "XTFN", "XTIR", 
-    "XTK1", "XTK2", "XTK3", "XTKA", "XTKO", "XTKS", "XTKT", "XTLX", "XTND", "XTNX", 
-    "XTOE", "XTPE", "XTPZ", "XTRA", "XTRD", "XTRN", "XTRZ", "XTSE", "XTSX", "XTUC", 
-    "XTUN", "XTUP", "XTUR", "XTXD", "XTXE", "XTXM", "XUAX", "XUBS", "XUGA", "XUKR", 
-    "XULA", "XUMP", "XUNI", "XUSE", "XVAL", "XVAR", "XVES", "XVIA", "XVIE", "XVLA", 
-    "XVPA", "XVPB", "XVSE", "XVTX", "XWAP", "XWAR", "XWBO", "XWCE", "XWEE", "XXSC", 
-    "XXX0", "XXXX", "XYIE", "XYKT", "XZAG", "XZAM", "XZAP", "XZCE", "XZIM", "YEM0", 
-    "YKNA", "YLDX", "ZAF0", "ZAPA", "ZARX", "ZBUL", "ZBXE", "ZERO", "ZFXM", "ZHEU", 
-    "ZKBX", "ZMB0", "ZOBX", "ZODM", "ZWE0"
-};
 
-constexpr const char * const MarketId::m_fullNames[NUMMARKETID] = { "No Market (Unlisted)",
-    "21X", "24X NATIONAL EXCHANGE - DARK", "24X NATIONAL EXCHANGE LLC", "24 EXCHANGE", "SSY FUTURES LTD - FREIGHT SCREEN", "360X DLT - MTF", "360X MTF", "360T", "360X", "3DXE", 
-    "CTSE NOMINEES", "A2X", "CREDIT AGRICOLE CIB", "ATHENS EXCHANGE - APA", "ASSENT ATS", "ABANCA", "ALPHA BANK", "ABN AMRO BANK NV", "ABN AMRO CLEARING BANK", "ALM. BRAND BANK", 
-    "BULGARIAN STOCK EXCHANGE - ALTERNATIVE MARKET", "General purpose market for Aruba", "VENOMEX LIMITED (EX. YOSHI MARKETS)", "ACCX", "ACE DERIVATIVES AND COMMODITY EXCHANGE LTD", "KCG ACKNOWLEDGE FI", "ACX CLEARING CORPORATION LTD.", "ACX", "ALPHA DRK", "ADVISE TECHNOLOGIES - APA TRANSPARENCY REPORTING", 
-    "ABIDE FINANCIAL DRSP LIMITED APA", "AGRICULTURAL FUTURES EXCHANGE OF THAILAND", "AFRINEX LIMITED", "General purpose market for Afghanistan", "AFS - OTF", "AFS E-VENUES B.V.", "AFS - OTF - INTEREST RATE DERIVATIVES", "AFS - OTF - STRUCTURED PRODUCTS", "AFS - OTF - BONDS", "AFS - OTF - FX FORWARDS", 
-    "ACCESS FINTECH", "A AND G BANCA PRIVADA SAU", "General purpose market for Angola", "General purpose market for Anguilla", "ARRACO IRELAND LTD", "LONDON STOCK EXCHANGE - AIM MTF", "AIXECUTE", "ASTANA INTERNATIONAL EXCHANGE LTD", "AKIS - BANCO BPM", "General purpose market for Aland Islands", 
-    "General purpose market for Albania", "NYSE ALTERNEXT DARK", "BLOX", "ALLT - OTF", "ALPHAX US", "AKTIESELSKABET ARBEJDERNES LANDSBANK", "JSE ALTERNATE EXCHANGE", "EURONEXT - ALTERNEXT AMSTERDAM", "EURONEXT GROWTH BRUSSELS", "EURONEXT GROWTH LISBON", 
-    "EURONEXT GROWTH PARIS", "AMERICAN LEDGER ATS", "AMMAN STOCK EXCHANGE - NON-LISTED SECURITIES MARKET", "ASSET MATCH PRIVATE EXCHANGE", "MTS NETHERLANDS", "NYSE AMERICAN OPTIONS", "General purpose market for Andorra", "AUSTRALIA AND NEW ZEALAND BANKING GROUP LIMITED", "ABBEY NATIONAL TREASURY SERVICES PLC", "AUSTRALIA AND NEW ZEALAND BANKING GROUP LIMITED - SYSTEMATIC INTERNALISER", 
-    "WIENER BOERSE AG - APA", "ASIA PACIFIC CLEAR", "ASIA PACIFIC EXCHANGE", "SYDNEY STOCK EXCHANGE LIMITED", "AQUIS EXCHANGE EUROPE AUCTION ON DEMAND (AOD)", "AQUIS EXCHANGE EUROPE NON DISPLAY ORDER BOOK (NDOB)", "AQUIS EXCHANGE EUROPE", "AQSE MAIN MARKET (NON-EQUITY)", "AQUIS STOCK EXCHANGE", "AQSE GROWTH MARKET (NON-EQUITY)", 
-    "AQSE GROWTH MARKET (EQUITY)", "AQSE MAIN MARKET (EQUITY)", "AQSE TRADING (NON-EQUITY)", "AQSE TRADING (EQUITY)", "AQUA EQUITIES L.P.", "AQUIS EXCHANGE PLC AUCTION ON DEMAND (AOD)", "AQUIS EXCHANGE PLC AMP NON DISPLAY ORDER BOOK", "AQUIS EXCHANGE PLC", "ARRACO GLOBAL MARKETS LTD", "ARCHAX EUROPE - BONDS", 
-    "ARCA DARK", "ARCHAX EUROPE - MTF (MADRID)", "ARCHAX", "NYSE ARCA OPTIONS", "NYSE ARCA", "ARCHAX - DIGITAL ASSETS", "General purpose market for United Arab Emirates", "AREX - AUTOMATED RECEIVABLES EXCHANGE", "General purpose market for Argentina", "ARIAN TRADING FACILITY", 
-    "ARKONIS", "General purpose market for Armenia", "ARTEX GLOBAL MARKETS AG", "AEGIS SWAP EXECUTION FACILITY", "ATHENS STOCK EXCHANGE", "General purpose market for American Samoa", "INTELLIGENTCROSS ASPEN MAKER/TAKER", "INTELLIGENTCROSS ASPEN INVERTED", "INTELLIGENTCROSS ASPEN INTELLIGENT BID/OFFER", "CLEARCORP DEALING SYSTEMS INDIA LIMITED - ASTROID", 
-    "ASX BOOKBUILD", "ASX - CENTRE POINT", "ASX - PUREMATCH", "ASX TRADEMATCH", "ASX - VOLUMEMATCH", "ATADEL FUNDS", "AUTOMATED TRADING DESK FINANCIAL SERVICES, LLC", "General purpose market for French Southern Territories", "ATFUND MTF", "General purpose market for Antigua and Barbuda", 
-    "ATHLOS CAPITAL INVESTMENT SERVICES LTD", "BRAEMAR SECURITIES LTD", "ATONLINE LIMITED", "ALPHA VENTURE PLUS", "AUREL", "AUREL - OTF", "General purpose market for Australia", "General purpose market for Austria", "AUTILLA - BASE METALS", "AUTOBAHN FX", 
-    "AUTILLA - PRECIOUS METALS", "AUTILLA", "AQUIS EXCHANGE EUROPE - AQUIS VWAP MATCH (AVM)", "AQUIS EXCHANGE LIMITED - AQUIS VWAP MATCH (AVM)", "AUSTRALIAN WHEAT BOARD", "AUSTRALIAN WOOL EXCHANGE", "AXIOLOGY", "ALEXANDRIA PANKKIIRILIIKE OYJ", "General purpose market for Azerbaijan", "BAADER BANK", 
-    "BOLSA DE CEREALES DE BUENOS AIRES", "BANK OF AMERICA SECURITIES - CENTRAL RISK", "BANK OF AMERICA MERRILL LYNCH EQUITY SWAP - EXTERNAL PRICE SOURCE", "BAIKAL", "BANK OF AMERICA MERRILL LYNCH EQUITY SWAP - INTERNAL PRICE SOURCE", "BANK OF AMERICA MERRILL LYNCH - JAPAN INSTINCT X", "BARBADOS STOCK EXCHANGE - JUNIOR MARKET", "THE BALTIC EXCHANGE", "BANK OF AMERICA - MERRILL LYNCH INSTINCT X ATS", "MERR POOL XLN", 
-    "BANK OF AMERICA - MERRILL LYNCH GCX", "BANK OF AMERICA, NATIONAL ASSOCIATION", "BLOOMBERG - APA", "BLOOMBERG DATA REPORTING SERVICES B.V. - APA", "BALTPOOL", "BARCLAYS FX - TRADING", "CBOE EUROPE - REGULATED MARKET DARK BOOK", "BARCLAYS LIQUID MARKETS", "CBOE EUROPE - REGULATED MARKET OFF BOOK", "CBOE EUROPE - REGULATED MARKET INTEGRATED BOOK", 
-    "CBOE EUROPE - REGULATED MARKET DARK BOOK (NL)", "BARCLAYS ATS", "BANK OF AMERICA MERRILL LYNCH - SWAP EXECUTIONS", "BANK OF AMERICA, NATIONAL ASSOCIATION - LONDON BRANCH OFFICE - SYSTEMATIC INTERNALISER", "BANK OF AMERICA SECURITIES EQUITY SWAP - SYNTHETIC PRICE SOURCE", "BANK OF AMERICA MERRILL LYNCH - SIMPLEX BLAST X", "CBOE EUROPE - BXE DARK ORDER BOOK", "CBOE EUROPE - BXE ORDER BOOKS", "CBOE EUROPE - BXE OFF-BOOK", "CBOE BZX OPTIONS EXCHANGE", 
-    "CBOE EUROPE - BXE PERIODIC", "CBOE BZX U.S. EQUITIES EXCHANGE", "CBOE BYX U.S. EQUITIES EXCHANGE", "BARCLAYS BANK IRELAND PLC", "BARCLAYS BANK IRELAND PLC - SYSTEMATIC INTERNALISER", "BONDBLOX EXCHANGE", "BARCLAYS SINGLE DEALER PLATFORM", "BLOOMBERG SEF LLC", "BARCLAYS BANK PLC - SYSTEMATIC INTERNALISER", "BLOOMBERG SEF LLC - SECURITY-BASED SWAP EXECUTION FACILITY (SBSEF)", 
-    "BB SECURITIES LTD", "BANCO BILBAO VIZCAYA ARGENTARIA S.A", "BITSTAMP GLOBAL", "BANCO BILBAO VIZCAYA ARGENTARIA S.A. - UK", "BARCLAYS DIRECT EX ATS", "BANQUE ET CAISSE D'EPARGNE DE L'ETAT, LUXEMBOURG - BCEE", "BOLSA DE COMERCIO DE SANTA FE", "BANCA MARCH S.A.", "BOLSA DE CEREAIS E MERCADORIAS DE MARINGÁ", "CBOE EUROPE REGULATED MARKETS", 
-    "BROKERCREDITSERVICE (CYPRUS) LIMITED", "BELARUS CURRENCY AND STOCK EXCHANGE", "BARCLAYS CAPITAL SECURITIES LIMITED - SYSTEMATIC INTERNALISER", "BARCLAYS CAPITAL SECURITIES LIMITED", "CBOE EUROPE EQUITIES", "BAYERNLB - IDEAL FX", "General purpose market for Burundi", "BANQUE DEGROOF PETERCAM LUXEMBOURG S.A.", "DSK BANK EAD", "MTS ASSOCIATED MARKETS", 
-    "BULGARIAN ENERGY TRADING PLATFORM", "BOND ELECTRONIC EXCHANGE", "BANCA ETICA", "General purpose market for Belgium", "BELFIUS BANK NV/SA", "BELFIUS BANK NV/SA FIXED INCOME", "General purpose market for Benin", "BOERSE BERLIN - REGULIERTER MARKT", "BOERSE BERLIN - FREIVERKEHR", "BOERSE BERLIN - BERLIN SECOND REGULATED MARKET", 
-    "General purpose market for Bonaire, Saint Eustatius and Saba", "BITSTAMP EUROPE", "BETA MARKET", "BLOOMBERG TRADEBOOK JAPAN LIMITED", "BET OTC BILAT COMMODITY DERIVATIVES", "CBOE EUROPE - BXE DARK ORDER BOOK (NL)", "CBOE EUROPE - BXE ORDER BOOKS (NL)", "CBOE EUROPE - BXE OFF-BOOK (NL)", "CBOE EUROPE - REGULATED MARKET OFF BOOK (NL)", "CBOE EUROPE - DXE PERIODIC (NL)", 
-    "CBOE EUROPE - REGULATED MARKET INTEGRATED BOOK (NL)", "General purpose market for Burkina Faso", "BAHRAIN FINANCIAL EXCHANGE", "BANCO FINANTIA S.A.", "BITSTAMP DERIVATIVES EXCHANGE", "BGC PARTNERS (AUSTRALIA) PTY LTD", "BGC BROKERS LP - TRAYPORT", "BGC DERIVATIVE MARKETS L.P.", "BGC FINANCIAL INC", "BGC BROKERS LP", 
-    "BGC SHOKEN KAISHA LTD – ETP", "BGC BROKERS LP - MTF", "BGC BROKERS LP - OTF", "General purpose market for Bangladesh", "BORSA ITALIANA GLOBAL EQUITY MARKET", "BERENBERG FIXED INCOME", "BERENBERG FIXED INCOME UK", "BERENBERG FX", "BALKAN GAS HUB EAD", "BGL BNP PARIBAS", 
-    "General purpose market for Bulgaria", "BGC PARTNERS SINGAPORE RMO", "BERENBERG", "BERENBERG UK", "General purpose market for Bahrain", "General purpose market for Bahamas", "CBOE SEF, LLC", "BANK HANDLOWY W WARSZAWIE S.A.", "BIDS TRADING L.P.", "General purpose market for Bosnia and Herzegovina", 
-    "OFF-EXCHANGE TRANSACTIONS - LISTED AND UNLISTED INSTRUMENTS", "BANQUE INTERNATIONALE A LUXEMBOURG S.A.", "BOND INVEST", "GOLDMAN SACHS INTERNATIONAL BANK - SYSTEMATIC INTERNALISER", "BOLSA INSTITUCIONAL DE VALORES", "BEIJING STOCK EXCHANGE", "BNY MELLON S.A./N.V. - BRUSSELS BRANCH - SYSTEMATIC INTERNALISER", "BNY MELLON S.A./N.V. - BRUSSELS BRANCH", "BNY MELLON MARKETS EUROPE LIMITED", "BAKKT", 
-    "THE BANK OF NEW YORK MELLON", "THE BANK OF NEW YORK MELLON - LONDON BRANCH", "BKS BANK AG", "BAYERNLB", "BANJA LUKA STOCK EXCHANGE - FREE MARKET", "BAYERNLB - BONDS MARKET", "BAYERNLB - EQUITIES MARKET", "BLOCK EVENT", "BAYERNLB - FX DERIVATIVES MARKET", "BAYERNLB - LIQP BONDS MARKET", 
-    "INSTINET BLOCKCROSS ATS", "General purpose market for Saint Barthelemy", "BLINK MTF", "BLOCKMATCH UK DARK", "BELGIAN POWER EXCHANGE", "General purpose market for Belarus", "BLOOMBERG TRADEBOOK LLC", "BALTEX - FREIGHT DERIVATIVES MARKET", "PRO SECURITIES ATS", "BANQUE DE LUXEMBOURG", 
-    "INSTINET BLX (AU)", "General purpose market for Belize", "BME CLEARING S.A.", "BMO CAPITAL MARKETS LIMITED", "BME - APA", "BME - BOLSAS Y MERCADOS ESPANOLES", "BMFMS-ATS", "DERIVATIVES REGULATED MARKET - BMFMS", "SIBIU MONETARY- FINANCIAL AND COMMODITIES EXCHANGE", "BANK OF MONTREAL - LONDON BRANCH", 
-    "BANK OF AMERICA MERRILL LYNCH INTERNATIONAL BANK DESIGNATED ACTIVITY COMPANY", "BANK OF AMERICA MERRILL LYNCH INTERNATIONAL BANK DESIGNATED ACTIVITY COMPANY - SYSTEMATIC INTERNALISER", "BANK OF AMERICA MERRILL LYNCH INTERNATIONAL BANK DESIGNATED ACTIVITY COMPANY", "BANK OF AMERICA MERRILL LYNCH INTERNATIONAL BANK DESIGNATED ACTIVITY COMPANY", "BLOOMBERG TRADING FACILITY LIMITED", "MTS BELGIUM", "General purpose market for Bermuda", "TRADEWEB DIRECT LLC", "BONDS.COM, INC.", "BANCA NAZIONALE DEL LAVORO SPA", 
-    "BNP PARIBAS ARBITRAGE SNC", "BNPP CORTEX ATS", "BNP PARIBAS FORTIS SA/NV", "BNPP CORTEX EQUITIES", "BNP PARIBAS SA LONDON BRANCH", "BANK BGZ BNP PARIBAS S.A.", "BNP PARIBAS SA", "BNP PARIBAS ALTERNATIVE TRADING SYSTEM", "THE BANK OF NOVA SCOTIA", "BLOCKMATCH UK NT", 
-    "CONVERGEX", "BANK OF AMERICA, NATIONAL ASSOCIATION - LONDON BRANCH OFFICE", "CINNOBER BOAT", "BANK OF CHINA LIMITED - FRANKFURT BRANCH", "BANK OF SCOTLAND PLC", "General purpose market for Bolivia", "BONDVISION ITALIA", "BONDSCAPE", "NASDAQ OMX BX DARK", "WARSAW STOCK EXCHANGE/BONDS/CATALYST/BONDSPOT/MTF", 
-    "BRUCE ATS", "OFF EXCHANGE IDENTIFIER FOR OTC TRADES REPORTED TO CBOE EUROPE", "BOTSWANA STOCK EXCHANGE - EXCHANGE TRADED FUNDS (ETF)", "BOTSWANA STOCK EXCHANGE - VENTURE CAPITAL", "BOLSA DE CORREDORES - BOLSA DE VALORES", "BOLSA DE VALORES MINAS-ESPÍRITO SANTO-BRASÍLIA", "BANK PICTET AND CIE (EUROPE) AG", "BANCA PASSADORE", "PKO BANK POLSKI S.A.", "BARCLAYS BANK PLC", 
-    "BLOOMBERG BPOOL", "BNP PARIBAS SECURITIES SERVICES", "BITSTAMP ASIA PTE. LTD.", "BPX MARKETS LIMITED - DEBT INSTRUMENTS", "BPX MARKETS LIMITED - REPO", "BPX MARKETS LIMITED", "General purpose market for Brazil", "BRAEMAR SECURITIES LTD - OTF", "General purpose market for Barbados", "BRD - GROUPE SOCIETE GENERALE S.A.", 
-    "BRD - GROUPE SOCIETE GENERALE S.A. - LIQUIDITY PROVIDER", "BRD - GROUPE SOCIETE GENERALE S.A. - SYSTEMATIC INTERNALISER", "BANCA REALE", "BRED BANQUE POPULAIRE", "BLOCKMATCH UK SELECT", "BRYAN GARNIER AND CO LIMITED", "BRAZILIAN ENERGY EXCHANGE", "ROMANIAN COMMODITIES EXCHANGE - BRM-SMT", "General purpose market for Brunei Darussalam", "BERNSTEIN CROSS (BERN-X)", 
-    "BANCO DE SABADELL, S.A.", "BAKU STOCK EXCHANGE", "BAYERNLB - FX HANDEL", "INTELLIGENTCROSS - BSGX", "BANCO SANTANDER, LONDON BRANCH", "BSE SME", "BNP PARIBAS SECURITIES SERVICES LONDON BRANCH", "BOSTON SECURITY TOKEN EXCHANGE LLC", "CME AMSTERDAM B.V.", "BLOOMBERG TRADEBOOK SINGAPORE PTE LTD", 
-    "BROKERTEC AMERICAS LLC - CHICAGO", "BROKERTEC AMERICAS LLC", "BROKERTEC EUROPE LIMITED - ALL MARKETS", "BROKERTEC AMERICAS LLC - RFQ PLATFORM", "BLOOMBERG TRADING FACILITY B.V.", "BTL OTC BILAT COMMODITY DERIVATIVES", "General purpose market for Bhutan", "BITNOMIAL", "CME AMSTERDAM B.V. - RFQ TRADING PROTOCOL", "BROKERTEC EUROPE LIMITED - RFQ TRADING PROTOCOL", 
-    "BANCA TRANSILVANIA S.A.", "BITSTAMP LTD", "TUNIS STOCK EXCHANGE (BOURSE DE TUNIS) - BONDS MARKET", "BITSTAMP UK LTD", "NASDAQ COMMODITIES - BULK COMMODITY", "BURGUNDY NORDIC MTF", "BURGUNDY REGULATED MARKET", "BITSTAMP USA, INC.", "LCH LTD - BUY IN", "CARACAS STOCK EXCHANGE", 
-    "B3 S.A. - BRASIL BOLSA BALCAO", "BONDVISION UK", "BOLSA ELECTRONICA DE VALORES DEL URUGUAY", "BONDVISION US", "General purpose market for Botswana", "BX DIGITAL", "CBOE BYX U.S. EQUITIES EXCHANGE DARK", "CBOE BZX U.S. EQUITIES EXCHANGE DARK", "CBOE C2 OPTIONS EXCHANGE", "CAIXABANK", 
-    "CME AMSTERDAM B.V. - APA", "CREDIT SUISSE AES CROSSFINDER", "General purpose market for Central African Republic", "CLSA AMERICAS - LIQUIDITY HUB", "General purpose market for Canada", "CANDEAL.CA INC", "CANNEX FINANCIAL EXCHANGE LTS", "CBOE EUROPE - APA (NL)", "CAPI - OTF", "CREDIT AGRICOLE BANK POLSKA S.A.", 
-    "CARNEGIE INVESTMENT BANK AB", "FORECASTEX, LLC", "CATS", "CAVENDISH MARKETS B.V.", "CAVEAT EMPTOR", "THE CAZENOVE MTF", "COMMONWEALTH BANK OF AUSTRALIA (EUROPE) N.V.", "COMMONWEALTH BANK OF AUSTRALIA - LONDON BRANCH", "COMMERZBANK AG", "COMMERZBANK COMMODITY DERIVATIVES", 
-    "COMMERZBANK EQUITY DERIVATIVES", "COMMERZBANK EQUITY", "COMMERZBANK COMMANDER", "COMMERZBANK FIXED INCOME", "COMMERZBANK INTEREST RATE SWAPS", "CITIBLOC", "CREDITEX BROKERAGE LLP", "CBM SARB", "CITIBANK N.A. LONDON", "CBOE FX NDFS", 
-    "CESKOSLOVENSKA OBCHODNA BANKA, A.S.", "CBOE STOCK EXCHANGE", "CME SWAPS MARKETS (CBOT)", "CITADEL CONNECT EUROPE", "CASPY COMMODITY EXCHANGE", "CHICAGO CLIMATE FUTURES EXCHANGE", "CHINA FINANCIAL FUTURES EXCHANGE", "General purpose market for Cocos Islands", "FINESTI S.A.", "CONTINENTAL CAPITAL MARKETS LIMITED - OTF", 
-    "CONTINENTAL CAPITAL MARKETS S.A.", "CARTAX", "CANTORCO2E.COM LIMITED", "CBOE EUROPE REGULATED MARKETS (NL)", "CBOE EUROPE EQUITIES - EUROPEAN EQUITIES (NL)", "CITADEL SECURITIES", "CITADEL SECURITIES ATS", "NORTH AMERICAN DERIVATIVES EXCHANGE, INC.", "CREDIT SUISSE (DEUTSCHLAND) AG", "CLEARCORP DEALING SYSTEMS (INDIA) LTD.", 
-    "CECABANK", "CME SWAPS MARKETS (COMEX)", "CBOE EUROPE DERIVATIVES", "ČESKOSLOVENSKÁ OBCHODNÍ BANKA, A.S. - OTHER LIQUIDITY PROVIDER (OLP)", "CITIBANK EUROPE PLC", "CITIBANK EUROPE PLC - LONDON BRANCH", "RESURETY MARKETS", "ČESKOSLOVENSKÁ OBCHODNÍ BANKA, A.S. - SYSTEMATIC INTERNALISER", "CETIP S.A. - MERCADOS ORGANIZADOS", "BONDSPOT S.A.", 
-    "CBOE EUROPE - DXE DARK ORDER BOOK (NL)", "CBOE EUROPE - CXE ORDER BOOKS (NL)", "CBOE EUROPE - DXE OFF-BOOK (NL)", "CBOE EUROPE - DXE ORDER BOOKS (NL)", "CROSSFINDER AUSTRALIA", "CHINA FOREIGN EXCHANGE TRADE SYSTEM - SHANGHAI - HONG KONG BOND CONNECT", "CROSSFINDER HONG KONG", "CHINAFICC", "CREDIT FINANCIER INVEST (CFI) LTD", "CANTOR FITZGERALD IRELAND LIMITED", 
-    "CBOE FIXED INCOME MARKETS, LLC", "CROSSFINDER JAPAN", "CROSSFINDER TAIWAN", "CASSA DI COMPENSAZIONE E GARANZIA SPA - COLLATERALIZED MONEY MARKET GUARANTEE SERVICE", "CASSA DI COMPENSAZIONE E GARANZIA SPA - BONDS CCP SERVICE", "CASSA DI COMPENSAZIONE E GARANZIA SPA - EURO BONDS CCP SERVICE", "CITIGROUP GLOBAL MARKETS EUROPE AG - EMEA LIQUIDITY HUB", "CITI MATCH DE CONTRA LIQUIDITY", "CITIGROUP GLOBAL MARKETS EUROPE AG - EMEA TRADING", "CASSA DI COMPENSAZIONE E GARANZIA SPA - CCP AGRICULTURAL COMMODITY DERIVATIVES", 
-    "CASSA DI COMPENSAZIONE E GARANZIA SPA", "CITI MATCH AUSTRALIA", "CITIGROUP GLOBAL MARKETS LIMITED - EMEA LIQUIDITY HUB", "CITIGROUP GLOBAL MARKETS EUROPE AG", "CITI MATCH - GB", "CITIGROUP GLOBAL MARKETS EUROPE AG - LONDON BRANCH", "CITI MATCH - HK", "CITIGROUP GLOBAL MARKETS", "CITIGROUP GLOBAL MARKETS LIMITED", "CITIGROUP GLOBAL MARKETS LIMITED - EMEA TRADING", 
-    "CITI MATCH GB CONTRA LIQUIDITY", "CITI MEXICO RPI (RETAIL PRICE IMPROVEMENT)", "CASSA DI COMPENSAZIONE E GARANZIA SPA - CCP ENERGY DERIVATIVES", "CASSA DI COMPENSAZIONE E GARANZIA SPA - CCP EQUITY DERIVATIVES", "CASSA DI COMPENSAZIONE E GARANZIA SPA - EQUITY CCP SERVICE", "CASSA DI COMPENSAZIONE E GARANZIA SPA - TRIPARTY REPO CCP SERVICE", "ONECHRONOS", "General purpose market for Switzerland", "CA CHEUVREUX", "CBOE AUSTRALIA", 
-    "CHI-X CANADA ATS", "CBOE EUROPE - CXE DARK ORDER BOOK", "CHI-EAST", "CBOE JAPAN - ALPHA", "CBOE EUROPE - CXE OFF-BOOK", "CBOE JAPAN - SELECT", "CBOE JAPAN - MATCH", "CBOE EUROPE - CXE ORDER BOOKS", "BATS CHI-X EUROPE LIMITED - CHI-CLEAR", "General purpose market for Chile", 
-    "General purpose market for China", "CANADIAN IMPERIAL BANK OF COMMERCE", "CIB BANK", "CIBC WORLD MARKETS PLC", "CITI CROSS", "LIQUIDITY HUB JAPAN", "CIMD S.V. S.A. - APPROVED PUBLICATION ARRANGEMENT", "CIMD S.V. S.A. - OTF FOR BONDS", "CIMD S.V. S.A. - OTF", "CIMD S.V. S.A. - OTF FOR ENERGY DERIVATIVES", 
-    "CIMD S.V. S.A. - OTF FOR DERIVATIVES", "CIOI", "NYSE NATIONAL, INC. - DARK", "CITI DARK", "CITI MATCH - JP", "General purpose market for Ivory Coast", "CLSA AUSTRALIA - DARK", "LCH LTD - CROSS NETTING", "CLSA HONG KONG - DARK", "CLSA JAPAN - DARK", 
-    "CLIMEX", "CLSA PHILIPPINES - DARK", "CLEAR STREET", "EEX ASIA PTE. LTD.", "VERTO MTF", "CAPI - APPROVED PUBLICATION ARRANGEMENT", "CREDIT INDUSTRIEL ET COMMERCIAL", "CMC MARKETS UK PLC", "CME CLEARING EUROPE", "CME EUROPE - DERIVATIVES", 
-    "CME EUROPE", "CME SWAPS MARKETS (CME)", "CLEAR MARKETS JAPAN, INC.", "CLEAR MARKETS EUROPE LIMITED", "General purpose market for Cameroon", "CLEAR MARKETS NORTH AMERICA, INC.", "EUROCREDIT MTS", "SGX CURRENCYNODE", "CARNEGIE AS", "LA COTE ALPHA", 
-    "General purpose market for Democratic Republic of the Congo", "CODA MARKETS - MICRO AND BLOCK", "General purpose market for Republic of the Congo", "COMHAR CAPITAL MARKETS, LLC", "General purpose market for Cook Islands", "General purpose market for Colombia", "General purpose market for Comoros", "COMMERG LTD.", "COMMERG", "CONCORDE SECURITIES LTD.", 
-    "CBOE OPTIONS EXCHANGE", "CITIGROUP AGENCY OPTION AND EQUITIES ROUTING ENGINE", "BMO CAPITAL MARKETS - CAD OTC TRADES", "CLEARPOOL EXECUTION SERVICES, LLC", "CAPTIN", "General purpose market for Cape Verde", "CLIMATE TRUST", "COREDEAL MTS", "CREDIT SUISSE (US)", "CREDEM BANCA", 
-    "General purpose market for Costa Rica", "CROSSX TECHNOLOGIES LTD", "CRYEX - FX AND DIGITAL CURRENCIES", "CRYPTO FACILITIES", "CRYEX", "CREDIT SUISSE AG", "CESKA SPORITELNA, A.S.", "CREDIT SUISSE EQUITIES (AUSTRALIA) LIMITED", "CREDIT SUISSE AES EUROPE BENCHMARK CROSS", "CREDIT SUISSE AES CROSSFINDER EUROPE", 
-    "CREDIT SUISSE CLOSEX", "CREDIT SUISSE AKTIENGESELLSCHAFT", "CANADIAN SECURITIES EXCHANGE - CSE2", "CITADEL SECURITIES FI", "CREDIT SUISSE (EUROPE)", "CREDIT SUISSE (EUROPE)", "CITADEL SECURITIES FI - EUROPE", "CREDIT SUISSE SECURITIES (HONG KONG) LIMITED", "CREDIT SUISSE INTERNATIONAL", "CREDIT SUISSE EQUITIES (JAPAN) LIMITED", 
-    "CREDIT SUISSE AG - LONDON BRANCH", "CREDIT SUISSE LIGHT POOL", "CREDIT SUISSE BANK (EUROPE), S.A.", "ČESKOSLOVENSKÁ OBCHODNÍ BANKA, A.S.", "CREDIT SUISSE AG - OHS", "CREDIT SUISSE INTERNATIONAL - SYSTEMATIC INTERNALISER", "CHINA STAINLESS STEEL EXCHANGE", "NASDAQ CLEARING AB", "CREDIT SUISSE VWAPX", "CREDIT SUISSE (CH)", 
-    "CLEARTOKEN CCP LIMITED", "CLEARTOKEN DEPOSITORY LTD", "CAPE TOWN STOCK EXCHANGE", "CLEARTOKEN CSD LIMITED", "CBOE C2 OPTIONS EXCHANGE", "General purpose market for Cuba", "CULVERT CAPITAL LLC", "CUREX FX", "General purpose market for Curacao", "CBOE AUSTRALIA - BIDS BLOCK TRADE VENUE", 
-    "CBOE AUSTRALIA - LIMIT VENUE", "CBOE AUSTRALIA - ETFS", "CBOE AUSTRALIA MARKET PEG (FARPOINT) VENUE", "CBOE AUSTRALIA - BIDS PRICE IMPROVEMENT VENUE", "CBOE AUSTRALIA MOC", "CBOE AUSTRALIA PRIMARY PEG (NEARPOINT) VENUE", "CBOE AUSTRALIA MID-POINT VENUE", "CBOE AUSTRALIA - QUOTED MANAGED FUNDS", "CBOE AUSTRALIA - TRANSFERABLE CUSTODY RECEIPT MARKET", "CBOE AUSTRALIA VWAP", 
-    "CBOE AUSTRALIA - WARRANTS", "CREDITEX BROKERAGE LLP - OTF", "General purpose market for Christmas Island", "CREDITEX BROKERAGE LLP - MTF", "General purpose market for Cayman Islands", "General purpose market for Cyprus", "General purpose market for Czech Republic", "D2X – CRYPTO DERIVATIVES", "D2X MARKET", "DAIWA CAPITAL MARKETS EUROPE LIMITED", 
-    "GXG MARKETS A/S", "EURONEXT AMSTERDAM – DARK BOOK FACILITY", "DEUTSCHE BOERSE AG - APA SERVICE", "DASE", "DASH ATS", "DANSKE BANK A/S", "DANSKE BANK A/S - LONDON BRANCH", "J AND E DAVY - IRISH GOVERNMENT BOND", "DEUTSCHE BANK SECURITIES INC.", "DEUTSCHE BANK AG", 
-    "DEUTSCHE BANK - CENTRAL RISK BOOK", "DEUTSCHE BANK - CLOSE CROSS", "DEUTSCHE BANK - DIRECT CAPITAL ACCESS", "DEUTSCHE BOERSE DIGITAL EXCHANGE", "DEUTSCHE BANK AG - SYSTEMATIC INTERNALISER", "DEUTSCHE BANK HONG KONG ATS", "DEUTSCHE BANK AG - LONDON", "DEUTSCHE BANK AG - LONDON", "DEUTSCHE BANK LUXEMBOURG S.A.", "DEUTSCHE BANK - MANUAL OTC", 
-    "DEUTSCHE BANK OFF EXCHANGE TRADING", "EURONEXT BRUSSELS – DARK BOOK FACILITY", "DEUTSCHE BANK - SUPERX EU", "DEUTSCHE BANK SUPER X", "DBV-X", "DBX", "CASABLANCA STOCK EXCHANGE – DERIVATIVES", "NASDAQ COPENHAGEN A/S - NORDIC@MID", "DUTCH CARIBBEAN SECURITIES EXCHANGE", "DEAL DONE TRADING", 
-    "EURONEXT DUBLIN– DARK BOOK FACILITY", "DCX (DERIVATIVES CURRENCY EXCHANGE)", "DEKABANK DEUTSCHE GIROZENTRALE", "General purpose market for Germany", "DEX LIMITED", "DUBAI GOLD AND COMMODITIES EXCHANGE DMCC", "NASDAQ HELSINKI LTD - NORDIC@MID", "DEUTSCHE HOLDINGS (LUXEMBOURG) S.A R.L.", "NASDAQ ICELAND HF. - NORDIC@MID", "NASDAQ DUBAI", 
-    "General purpose market for Djibouti", "NASDAQ STOCKHOLM AB - DANISH EQ DERIVATIVES", "NASDAQ STOCKHOLM AB - DANISH FI DERIVATIVES", "NASDAQ STOCKHOLM AB - OTC DKK WB EQ DERIVATIVES", "DANSK OTC", "NASDAQ STOCKHOLM AB - DKK WB EQ DERIVATIVES", "EURONEXT LISBON – DARK BOOK FACILITY", "General purpose market for Dominica", "BOLSA DE MADRID - DARK MIDPOINT", "BORSA ITALIANA - DARK BOOK FACILITY", 
-    "FIRST NORTH DENMARK - NORDIC@MID", "FIRST NORTH FINLAND - NORDIC@MID", "FIRST NORTH ICELAND - NORDIC@MID", "General purpose market for Denmark", "FIRST NORTH SWEDEN - NORDIC@MID", "General purpose market for Dominican Republic", "FIRST NORTH SWEDEN - NORWAY NORDIC@MID", "EURONEXT OSLO – DARK BOOK FACILITY", "SWISS DOTS BY CATS", "DOWGATE EURO GOVERNMENT BONDS", 
-    "DOWGATE", "DOWGATE - MTF (MADRID)", "EURONEXT PARIS – DARK BOOK FACILITY", "DAIWA DRECT", "EURONEXT UK - REPORTING SERVICES", "QATAR STOCK EXCHANGE", "FIRST NORTH DENMARK -SME GROWTH MARKET", "NASDAQ STOCKHOLM AB - NORDIC@MID", "GULF MERCANTILE EXCHANGE", "BOERSE DUESSELDORF - REGULIERTER MARKT", 
-    "BOERSE DUESSELDORF - FREIVERKEHR", "BOERSE DUESSELDORF - QUOTRIX - REGULIERTER MARKT", "BOERSE DUESSELDORF - QUOTRIX MTF", "DIGITAL VEGA", "DEALERWEB FIXED INCOME", "DRIVEWEALTH INSTITUTIONAL LLC", "DW SEF LLC", "General purpose market for Algeria", "DZ BANK", "MTS REPO - AGENCY CASH MANAGEMENT", 
-    "ERSTE BANK HUNGARY ZRT.", "BLOCKMATCH EUROPE DARK", "EBM - MTF", "NASDAQ STOCKHOLM AB - EUR FI DERIVATIVES", "BRATISLAVA STOCK EXCHANGE - MTF", "EBS MARKET- CLOB - FOR THE TRADING OF SPOT FX, PRECIOUS METALS AND OTHER FX PRODUCTS", "EBS MTF - RFQ - FOR THE TRADING OF FX PRODUCTS", "EBS MTF - FX PRODUCTS - RFQ SEGMENT", "EBS MTF - RFQ - FOR ASSET MANAGERS TRADING FX PRODUCTS", "EBS MTF - CLOB - FOR THE TRADING OF FX PRODUCTS", 
-    "EBS MTF", "EBS UK MTF - TAILORED ORDER BOOKS", "EBS SERVICE COMPANY LIMITED - ALL MARKETS", "EBS MTF", "LEVEL ATS - VWAP CROSS", "EUREX CLEARING AG", "EUREX CLEARING ASIA PTE. LTD.", "TRADECHO EU APA", "EUREX CLEARING AG - SME", "LONDON STOCK EXCHANGE - APA", 
-    "REFINITIV TRANSACTION SERVICES LIMITED - FX SPOT ECN", "ENTERPRISE COMMODITY SERVICES LIMITED", "General purpose market for Ecuador", "EUROPEAN CLIMATE EXCHANGE", "EURONEXT DUBLIN - TRADED BONDS", "CBOE EDGX U.S. EQUITIES EXCHANGE DARK", "CBOE EDGA U.S. EQUITIES EXCHANGE", "CBOE EDGA U.S. EQUITIES EXCHANGE DARK", "BATS DIRECT EDGE", "GLOBAL EXCHANGE MARKET - TRADED BONDS", 
-    "CBOE EDGX OPTIONS EXCHANGE", "CBOE EDGX U.S. EQUITIES EXCHANGE", "EDMOND DE ROTHSCHILD (FRANCE)", "EDX MARKETS", "EUREX EXCHANGE ASIA PTE. LTD.", "EAST EUROPEAN STOCK EXCHANGE", "EQUITY EXPRESS SECURITIES EXCHANGE (EESE)", "ENERGIEFINANZ TRADING PLATFORM", "EG MARKET TECHNOLOGIES", "ERSTE GROUP BANK AG", 
-    "General purpose market for Egypt", "AQUIS EXCHANGE PLC AQUIS - EIX INFRASTRUCTURE BOND MARKET", "NASDAQ OSLO ASA - EUROPEAN POWER AND GAS DERIVATIVES", "ELIXIUM", "NASDAQ OSLO ASA - NORDIC POWER DERIVATIVES AND EUROPEAN UNION ALLOWANCES", "NASDAQ OSLO ASA - SWEDISH ELECTRICITY CERTIFICATE", "NASDAQ COMMODITIES - GBP POWER/ENERGY", "ELIXIUM S.A.", "EURO MTF 3S", "EMERGING MARKETS BOND EXCHANGE LIMITED", 
-    "ROMANIAN COMMODITIES EXCHANGE - OTF", "FINACOR EMATCH", "E-MID - E-MIDER MARKET", "E-MID - BANCA D'ITALIA SHARES TRADING MARKET", "E-MID", "E-MID REPO", "MIAX EMERALD, LLC", "EURO MTF", "EBM", "ATHENS EXCHANGE ALTERNATIVE MARKET", 
-    "ENCLEAR", "EURONEXT MARKETS SINGAPORE PTE. LTD.", "ENGNSOL - OMP", "SEB ENSKILDA", "EURONEXT SYNAPSE", "BLOCKMATCH EUROPE NT", "EURONEXT - EASY NEXT", "EURONEXT ACCESS LISBON", "E-OTC", "EPEX SPOT SE", 
-    "MIAX PEARL EQUITIES EXCHANGE DARK", "MIAX PEARL EQUITIES", "EQUILEND CANADA CORP.", "EQUILEND LIMITED", "EQUILEND EUROPE LIMITED", "EQUOS SPOT", "EQUOS DERIVATIVES", "EQUOS", "EQUILEND LIMITED - SWAPS", "EQUILEND EUROPE LIMITED - SWAPS", 
-    "BOERSE BERLIN EQUIDUCT TRADING - REGULIERTER MARKT", "BOERSE BERLIN EQUIDUCT TRADING - BERLIN SECOND REGULATED MARKET", "BOERSE BERLIN EQUIDUCT TRADING - FREIVERKEHR", "BOERSE BERLIN EQUIDUCT TRADING - OTC", "EQUILEND LLC", "BX WORLDCAPS", "EUROBANK", "BLOCKMATCH EUROPE SELECT", "General purpose market for Eritrea", "CBOE DIGITAL EXCHANGE", 
-    "ERSTE BEFEKTETESI ZRT", "General purpose market for Western Sahara", "ENGNSOL", "General purpose market for Spain", "NASDAQ OMX ESPEED", "General purpose market for Estonia", "NASDAQ STOCKHOLM AB - NORWAY ETF", "ELECTRONIC ETF, ETC/ETN AND OPEN-END FUNDS MARKET", "General purpose market for Ethiopia", "EUROTLX", 
-    "ETORO EU", "ENERGY TRADING PLATFORM AMSTERDAM", "ETS EURASIAN TRADING SYSTEM COMMODITY EXCHANGE", "ATHENS EXCHANGE EUAS MARKET", "CITADEL CONNECT EUROPE - EU", "EUREX ZURICH", "EURO-FINANCE AD", "NASDAQ STOCKHOLM AB - OTC EUR WB EQ DERIVATIVES", "EUREX REPO MARKET", "EUREX CH SECLEND MARKET", 
-    "EUREX OTC SPOT MARKET", "EUWAX AG", "NASDAQ STOCKHOLM AB - EUR WB EQ DERIVATIVES", "EUWAX", "EVOLUTION MARKETS", "TURKISH MERCANTILE EXCHANGE - ELECTRONIC WAREHOUSE RECEIPT MARKET", "EUROPEAN WHOLESALE SECURITIES MARKET", "WIENER BOERSE AG, AUSTRIAN ENERGY EXCHANGE", "EXANE BNP PARIBAS - BID-OFFER CROSSING", "EXANE BNP PARIBAS - CLOSING PRICE", 
-    "EXANE BNP PARIBAS - DIRECT CAPITAL ACCESS", "EXANE BNP PARIBAS", "EURONEXT GROWTH MILAN", "ELECTRONX", "EXANE BNP PARIBAS - LIQUIDITY PROVISION", "EXANE BNP PARIBAS - MID POINT", "EXANE BNP PARIBAS - CHILD ORDER CROSSING", "EXOTIX CAPITAL - OTF", "EXPANDI MARKET", "EXPERT MARKET", 
-    "EXANE DERIVATIVES CORPORATE BONDS", "EXANE DERIVATIVES OTC DERIVATIVES", "EXANE BNP PARIBAS - SYSTEMATIC INTERNALISER", "EXANE DERIVATIVES OTHER BONDS", "EXANE DERIVATIVES SHARES", "EXANE BNP PARIBAS - GB", "EXANE DERIVATIVES STRUCTURED PRODUCTS", "EXANE DERIVATIVES", "ENERGY EXCHANGE ISTANBUL", "EXANE BNP PARIBAS - VOLUME PROFILE CROSSING", 
-    "EXANE DERIVATIVES CONVERTIBLES", "CANTOR SPREADFAIR", "EURONEXT FX", "FINECO BANK", "CHICAGO BOARD OF TRADE (FLOOR)", "CHICAGO MERCANTILE EXCHANGE (FLOOR)", "KAASUPORSSI - FINNISH GAS EXCHANGE", "FINSTREET GLOBAL MARKETS", "FINSTREET GLOBAL MARKETS - PRIVATE MARKET", "FINANCIALCONTENT", 
-    "FINANCIAL INFORMATION CONTRIBUTORS EXCHANGE", "NASDAQ STOCKHOLM AB - FINNISH EQ DERIVATIVES", "General purpose market for Finland", "FINRA/NASDAQ TRF CHICAGO (TRADE REPORTING FACILITY)", "FINRA/NASDAQ TRF CARTERET (TRADE REPORTING FACILITY)", "FINRA ORF (TRADE REPORTING FACILITY)", "FINRA", "FINRA/NYSE TRF (TRADE REPORTING FACILITY)", "FISH POOL ASA", "FREIGHT INVESTOR SERVICES LIMITED", 
-    "General purpose market for Fiji", "General purpose market for Falkland Islands", "FLOW TRADERS B.V. BONDS", "FLOW TRADERS - SYSTEMATIC INTERNALISER", "FLOW TRADERS", "MTS FRANCE SAS", "FMX SECURITIES", "FMX EXECUTION, LLC", "FENICS - US TREASURIES", "FMX NON-DELIVERABLE FORWARDS", 
-    "FIRST NORTH DENMARK", "INFRONT FUNDS MARKET", "FIRST NORTH ESTONIA", "FIRST NORTH FINLAND", "FENICS FUTURES", "FENICS FX ECN", "FIRST NORTH ICELAND", "GFI SECURITIES LLC - FENICS DELTA X", "FIRST NORTH LITHUANIA", "FIRST NORTH LATVIA", 
-    "FIRST NORTH SWEDEN", "FINANTIA UK LIMITED", "FENICS INVITATIONS", "FIRSTPLACE WIENER BOERSE", "General purpose market for France", "BOERSE FRANKFURT - REGULIERTER MARKT", "BOERSE FRANKFURT - FREIVERKEHR", "DEUTSCHE BOERSE MID-POINT CROSS", "BOERSE FRANKFURT - SCALE", "BOERSE FRANKFURT - REGULIERTERMARKT - OFF-BOOK", 
-    "BOERSE FRANKFURT - FREIVERKEHR - OFF-BOOK", "BOERSE FRANKFURT - SCALE - OFF-BOOK", "NASDAQ COMMODITIES - FREIGHT COMMODITY", "COINBASE DERIVATIVES", "General purpose market for Faroe Islands", "FONDS DES RENTES / RENTENFONDS", "FORTE - OTF", "FTSEF LLC", "FISHEX", "General purpose market for Federated States of Micronesia", 
-    "FIRST NORTH FINLAND - SME GROWTH MARKET", "42 FINANCIAL SERVICES - MTF", "42 FINANCIAL SERVICES", "TURKISH MERCANTILE EXCHANGE - FUTURES MARKET", "FLOW TRADERS U.S LLC", "FTX US DERIVATIVES", "FXALL", "CLEARCORP DEALING SYSTEMS INDIA LIMITED - FX-CLEAR", "FXCM", "FINANCIAL AND RISK TRANSACTIONS SERVICES IRELAND LIMITED - FORWARDS MATCHING", 
-    "FXCM - MTF", "FXMARKETSPACE LIMITED", "REFINITIV MATCHING NDFS SEF", "TRADITION-NEX OTF", "REFINITIV SEF REQUEST FOR STREAM", "FINANCIAL AND RISK TRANSACTIONS SERVICES IRELAND LIMITED - FXALL RFQ MTF", "FINANCIAL AND RISK TRANSACTIONS SERVICES IRELAND LIMITED - FXALL RFS MTF", "REFINITIV MATCHING NDFS SINGAPORE", "CLEARCORP DEALING SYSTEMS INDIA LIMITED - FX-SWAP", "G1 EXECUTION SERVICES", 
-    "G360", "General purpose market for Gabon", "COINGARAGE", "NASDAQ STOCKHOLM AB - OTC GBP WB EQ DERIVATIVES", "BOURSE AFRICA LIMITED", "General purpose market for United Kingdom", "GOODBODY STOCKBROKERS UC", "BULGARIAN STOCK EXCHANGE - SME GROWTH MARKET BEAM", "NASDAQ STOCKHOLM AB - GBP WB EQ DERIVATIVES", "GEMMA (GILT EDGED MARKET MAKERS’ASSOCIATION)", 
-    "General purpose market for Georgia", "LITHUANIAN NATURAL GAS EXCHANGE", "GFI SECURITIES LLC - ALL MARKETS", "GFI AUSTRALIA PTY LTD", "GFI BROKERS - MTF", "GFI BROKERS - OTF", "GUANGZHOU FUTURES EXCHANGE", "GFI AUCTIONMATCH", "GFI BROKERS", "GFI SECURITIES LTD", 
-    "GFI FOREXMATCH", "GFI MARKETMATCH", "GFI ENERGYMATCH", "GFI RATESMATCH", "GARANTUM FONDKOMMISSION AB", "GLOBAL FUTURES AND OPTIONS LTD", "GFI PARIS - OTF", "GFI SINGAPORE RMO", "GFI SECURITIES LTD - MTF", "GFI SECURITIES LTD - OTF", 
-    "General purpose market for Guernsey", "General purpose market for Ghana", "General purpose market for Gibraltar", "General purpose market for Guinea", "GOLDMAN SACHS INTERNATIONAL PARIS BRANCH", "FX SPOT+", "GATE US LLC", "GLMX", "GLOMAX EXCHANGE LTD", "General purpose market for Guadeloupe", 
-    "ESSEX RADEZ, LLC", "ACS EXECUTION SERVICES, LLC", "General purpose market for Gambia", "MTF SOFIA - GROWTH MARKET", "GMEX EXCHANGE", "GRIFFIN MARKETS EUROPE - OTF", "GRIFFIN MARKETS EUROPE", "GREENMARKET EXCHANGE", "GMG DUBAI LIMITED", "GMG EUROPE B.V.", 
-    "GMG BROKERS LIMITED", "ISE GEMINI EXCHANGE", "GALAXY", "MTS GERMANY", "General purpose market for Guinea-Bissau", "General purpose market for Equatorial Guinea", "GLOBAL OTC", "GOVEX", "GPB-FINANCIAL SERVICES LTD", "General purpose market for Greece", 
-    "General purpose market for Grenada", "THE GREEN EXCHANGE", "GRIFFIN MARKETS LIMITED", "GRIFFIN MARKETS LIMITED - OTF", "General purpose market for Greenland", "BME GROWTH MARKET", "THE GREEN STOCK EXCHANGE - ACB IMPACT MARKETS", "GOLDMAN SACHS (ASIA) LLC", "GOLDMAN SACHS BANK EUROPE SE", "GFI SWAPS EXCHANGE, LLC - SECURITY BASED SWAPS", 
-    "GOLDMAN SACHS INTERNATIONAL - SIGMA BCN", "THE GUYANA ASSOCIATION OF SECURITIES COMPANIES AND INTERMEDIARIES INC.", "GOLDMAN SACHS AND CO.", "GFI SWAPS EXCHANGE, LLC", "GOLDMAN SACHS BANK EUROPE SE - SYSTEMATIC INTERNALISER", "GOLDMAN SACHS INTERNATIONAL BANK", "GOLDMAN SACHS INTERNATIONAL", "GALLARDO SECURITIES LIMITED", "GS PRINCIPAL LIQUIDITY ASIA", "GOLDMAN SACHS INTERNATIONAL PARIS BRANCH - SYSTEMATIC INTERNALISER", 
-    "GOLDMAN SACHS INTERNATIONAL - SYSTEMATIC INTERNALISER", "GSX CHINA", "GSX HONG KONG", "GSX KOREA", "THE GIBRALTAR STOCK EXCHANGE", "GSX MICRO", "GSX NATURAL", "GSX TAIWAN", "KCG AMERICAS LLC", "General purpose market for Guatemala", 
-    "GTS SECURITIES", "GTSX", "GTX ECN", "GTX SEF, LLC", "General purpose market for French Guiana", "General purpose market for Guam", "General purpose market for Guyana", "GXG MTF FIRST QUOTE", "GXG MTF", "GXG MARKETS A/S", 
-    "GX MARKETCENTER", "BOERSE HAMBURG - REGULIERTER MARKT", "BOERSE HAMBURG - FREIVERKEHR", "BOERSE HAMBURG - LANG AND SCHWARZ EXCHANGE", "BOERSE HAMBURG - LANG AND SCHWARZ EXCHANGE - REGULIERTER MARKT", "BOERSE HAMBURG - LANG AND SCHWARZ EXCHANGE - FREIVERKEHR", "BOERSE HANNOVER - REGULIERTER MARKT", "BOERSE HANNOVER - FREIVERKEHR", "BOERSE HANNOVER - REGULIERTER MARKT - ELECTRONIC TRADING", "BOERSE HANNOVER - FREIVERKEHR - ELECTRONIC TRADING", 
-    "BOERSE HANNOVER - ELECTRONIC TRADING", "HSBC CONTINENTAL EUROPE", "HSBC BANK POLSKA S.A.", "VORVEL CERTIFICATES", "ICE CLEAR NETHERLANDS B.V.", "ELECTRONIC SECONDARY SECURITIES MARKET (HDAT)", "HENEX FINANCIAL ENERGY MARKET - DERIVATIVES MARKET", "NADEX", "HELABA", "HENEX S.A.", 
-    "HENEX ELECTRICITY SPOT MARKET", "HENEX GAS SPOT MARKET", "General purpose market for Hong Kong", "HONG KONG MERCANTILE EXCHANGE", "VORVEL EQUITY AUCTION", "VORVEL BONDS", "General purpose market for Honduras", "HELLENIC EXCHANGE OTC MARKET", "HPC ETRADING", "HPC ENERGY TRADING", 
-    "HPC SA - VOICE OTF", "HPC SA", "POTAMUS TRADING LLC", "HPC OTF - UK ETRADING PLATFORM", "HPC OTF", "HRTEU LIMITED", "VORVEL RFQ", "HUDSON RIVER TRADING - SYSTEMATIC INTERNALISER", "HUDSON RIVER TRADING (HRT)", "HUDSON RIVER TRADING", 
-    "General purpose market for Croatia", "HSBC", "HSBC TRINKAUS AND BURKHARDT AG", "CBOE FX", "HANOI STOCK EXCHANGE", "HSBC-X HONG KONG", "HSBC-X UNITED KINGDOM", "General purpose market for Haiti", "HUNGARIAN DERIVATIVE ENERGY EXCHANGE", "General purpose market for Hungary", 
-    "MTS HUNGARY", "HUNGARIAN POWER EXCHANGE", "HWH ENERGIMEGLING", "IBKR ATS", "ICE BENCHMARK ADMINISTRATION", "INTERACTIVE BROKERS CORP", "INVEST BANCA - IBIS EQUITY", "IBERCAJA BANCO SA", "INDEPENDENT BULGARIAN ENERGY EXCHANGE", "IBERIAN GAS HUB", 
-    "INVEST BANCA", "INTERACTIVE BROKERS LLC", "INSTINET BLX", "ICE BONDS SECURITIES CORPORATION", "INTERACTIVE BROKERS", "BULGARIAN STOCK EXCHANGE - INTERNATIONAL INSTRUMENTS", "TRAYPORT", "ICAP EUROPE", "ICAP ENERGY AS", "ICAP HYDE TANKER DERIVATIVES LIMITED", 
-    "INSTINET CBX (US)", "INDONESIA COMMODITY AND DERIVATIVES EXCHANGE", "ISLAND ECN LTD, THE", "ICAP ENERGY", "ICAP ENERGY - OTF", "ICE SWAP TRADE LLC", "INTERCONTINENTAL EXCHANGE - ICE FUTURES EUROPE", "NOMURA ICE - HK", "NOMURA ICE - KR", "ICAP EU - OTF - REGISTRATION", 
-    "ICAP EU - OTF", "TP ICAP UK MTF", "ICAP SINGAPORE RMO", "INSTINET VWAP CROSS", "ICAP SECURITIES", "NOMURA ICE - SH", "ICAP SEF (US) LLC.", "NOMURA ICE - SZ", "ICAP TRUEQUOTE", "NOMURA ICE - TW", 
-    "CURRENEX IRELAND MTF", "ICE FUTURES U.S. INC", "INDIAN COMMODITY EXCHANGE LTD", "CURRENEX IRELAND MTF - RFQ", "General purpose market for Indonesia", "IDX MARKETS, LLC", "EBS MTF - RFQ - FX PRODUCTS FOR ASSET MANAGERS", "ICAP ENERGY LTD OTF - EUROPEAN COMMODITIES AND ENERGY DERIVATIVES", "TP ICAP E. AND C. OTF – ICAP COMMODITIES AND ENERGY DERIVATIVES", "INFOENGINE OTC", 
-    "IBKR EOS ATS", "INTERCONTINENTAL EXCHANGE", "IEX DAP LLC", "INVESTORS EXCHANGE - DAX FACILITY", "INVESTORS EXCHANGE - DARK", "INVESTORS EXCHANGE", "ICE FUTURES ABU DHABI", "IRAN FARA BOURSE", "ICE FUTURES CANADA", "ICE FUTURES U.S. ENERGY DIVISION", 
-    "ICE FUTURES EUROPE - OIL AND REFINED PRODUCTS DIVISION", "ICE FUTURES EUROPE", "INFRONT FX MARKET", "ICE FUTURES EUROPE - FINANCIAL PRODUCTS DIVISION", "ICE FUTURES EUROPE - EQUITY PRODUCTS DIVISION", "SWAPXECUTE", "ICE FUTURES EUROPE - AGRICULTURAL PRODUCTS DIVISION", "ICE FUTURES SINGAPORE", "INSTITUTIONAL FINANCIAL SECURITIES MARKET", "ICE FUTURES U.S.", 
-    "ICE FUTURES EUROPE - EUROPEAN UTILITIES DIVISION", "FX CONNECT IRELAND MTF - ALLOCATIONS", "FX CONNECT IRELAND MTF", "FX CONNECT IRELAND MTF - RFQ", "ICAP GLOBAL DERIVATIVES LIMITED", "INSTINET IDX", "INDIA INTERNATIONAL EXCHANGE (IFSC) LIMITED", "IKB DEUTSCHE INDUSTRIEBANK AG", "LOUIS CAPITAL MARKETS UK", "ICE MARKETS AGRICULTURE", 
-    "ICE MARKETS BONDS", "ICE CREDIT TRADE", "ICAP MTF - CREDIT DERIVATIVES", "TP ICAP UK MTF - CASH EQUITY", "CREDITEX LLC", "ICAP MTF - COMMODITIES", "ICE ENDEX OTF FUTURES", "ICE MARKETS CREDIT", "IMC FINANCIAL MARKETS", "IMC", 
-    "TP ICAP UK MTF - EQUITY DERIVATIVES", "ICE MARKETS ENERGY", "ICE MARKETS EQUITY", "TP ICAP UK MTF - EXCHANGE TRADED PRODUCTS", "IRAN MERCANTILE EXCHANGE", "TP ICAP UK MTF - FX DERIVATIVES", "ICE MARKETS FOREIGN EXCHANGE", "TP ICAP UK MTF - GOVERNMENT BONDS EXCLUDING GILTS", "TP ICAP UK MTF - GILTS", "ICE MARKETS RATES", 
-    "IMMH - INTESA SANPAOLO", "TP ICAP UK MTF - MONEY MARKET INSTRUMENTS", "General purpose market for Isle of Man", "TP ICAP UK MTF - INTEREST RATE DERIVATIVES", "TP ICAP UK MTF - CORPORATE BONDS AND SECURITIES DEBT", "INTEGRAL MTF", "MTS IRELAND", "INSTINET DESK CROSS", "INTELLIGENTCROSS", "General purpose market for India", 
-    "INFRONT MARKETS", "ING BANK NV", "ING BANK NV - SPRINTERS", "ING BANK NV - FOREIGN EXCHANGE", "ING BANK NV - EQUITY", "ING BANK NV - LONDON BRANCH", "ING BANK SLASKI SA", "NSE IFSC LIMITED", "INTELLIGENTCROSS - ALPS", "STONEX FINANCIAL INC.", 
-    "INVESTEC BANK PLC", "ICAP UK OTF - CREDIT DERIVATIVES", "ICAP UK OTF - EQUITY DERIVATIVES", "ICAP SECURITIES OTF - BUTLER FX DERIVATIVES", "ICAP UK OTF - CORPORATE BONDS AND SECURITISED DEBT", "ICAP UK OTF - FX DERIVATIVES", "ICAP UK OTF - GOVERNMENT BONDS EXCLUDING UK GILTS", "ICAP UK OTF - GOVERNMENT BONDS - UK GILTS", "ICAP UK OTF - INTEREST RATE DERIVATIVES", "ICAP UK OTF - MONEY MARKET INSTRUMENTS", 
-    "General purpose market for British Indian Ocean Territory", "INSTINET EUROPE LIMITED OTC", "ICAP UK OTF", "ISWAP EURO MTF", "IPSX", "IPSX PRIME", "IPSX WHOLESALE", "General purpose market for Ireland", "General purpose market for Iran", "General purpose market for Iraq", 
-    "BANCA DI ASTI", "BIVER BANCA", "ISDAFIX", "ICAP SECURITIES AND DERIVATIVES EXCHANGE LIMITED", "FIRST NORTH ICELAND", "INTER-CONNECTED STOCK EXCHANGE OF INDIA LTD", "General purpose market for Iceland", "General purpose market for Israel", "ICBC STANDARD BANK", "ISWAP UK MTF", 
-    "ISWAP UK MTF - TRADE REGISTRATION", "ISWAP UK MTF ORDER BOOK", "ICAP GLOBAL DERIVATIVES LIMITED - ELECTRONIC", "ISWAP EURO MTF - TRADE REGISTRATION", "ISWAP EURO MTF - ORDERBOOK", "ISWAP EURO MTF", "ISWAP EURO MTF - SEF", "ISWAP UK MTF TARGETED STREAMING/RFQ", "ISWAP EURO MTF - TARGETED STREAMING / RFQ", "ICAP GLOBAL DERIVATIVES LIMITED - VOICE", 
-    "General purpose market for Italy", "POSIT", "POSIT MTF", "INTERNATIONAL TRADING SYSTEM (ITS)", "AIM ITALIA - MERCATO ALTERNATIVO DEL CAPITALE", "ICAP UK OTF - ORDERBOOK", "INTELLIGENTCROSS - VWAP CROSS", "INVESCO CANADA PTF TRADES", "INTERNATIONAL STOCK EXCHANGE SAINT-PETERSBOURG", "JOINT ASIAN DERIVATIVES EXCHANGE", 
-    "General purpose market for Jamaica", "JAPANCROSSING", "JASDAQ TACHIAIGAI (OFF-FLOOR MARKET)", "JYSKE BANK", "BULGARIAN STOCK EXCHANGE - INTERNATIONAL MTF", "JEFFERIES ASIA", "JEFFERIES EUROPE", "JEFFERIES INTERNATIONAL - SYSTEMATIC INTERNALISER", "JETX", "JEFFERIES EUROPE - SYSTEMATIC INTERNALISER", 
-    "General purpose market for Jersey", "JEFFERIES INTERNATIONAL", "JUMP TRADING - US EQUITY PLATFORM", "JUMP TRADING EU EQUITY PLATFORM", "JUMP TRADING - MULTI-ASSET PLATFORM", "JUMP TRADING", "JANE STREET NETHERLANDS B.V.", "JANE STREET CAPITAL, LLC", "General purpose market for Jordan", "JPBX", 
-    "JPMORGAN CHASE BANK N.A. LONDON BRANCH", "J.P. MORGAN SE", "JPJENKINS", "JP MORGAN - JPMI MARKET", "JPMS, LLC", "JPMX", "General purpose market for Japan", "J.P. MORGAN SECURITIES PLC", "JSE BOND ELECTRONIC TRADING PLATFORM", "JAVELIN SEF, LLC", 
-    "JSE REPO MARKET", "JANE STREET EXECUTION SERVICES LLC", "JANE STREET JX", "JANE STREET FINANCIAL LTD", "DEN JYSKE SPAREKASSE", "KABU.COM PTS", "CBOE JAPAN - KAI-X", "DOWGATE APPA", "General purpose market for Kazakhstan", "KBC BANK NV GROUP MARKETS", 
-    "QUINTET PRIVATE BANK (EUROPE) S.A. - EURO COMMERCIAL PAPERS", "QUINTET PRIVATE BANK (EUROPE) S.A.", "KYTE BROKING LIMITED", "QUINTET PRIVATE BANK (EUROPE) S.A. - STRUCTURED PRODUCTS", "QUINTET PRIVATE BANK (EUROPE) S.A. - FX TREASURY DERIVATIVES", "KELER CCP", "KDPW_CCP", "KELER", "General purpose market for Kenya", "General purpose market for Kyrgyzstan", 
-    "K AND H BANK ZRT", "General purpose market for Cambodia", "General purpose market for Kiribati", "KNIGHT LINK EUROPE", "KALSHIEX LLC", "EUROMTS LINKERS MARKET", "ZURCHER KANTONALBANK - EKMU-X", "General purpose market for Saint Kitts and Nevis", "KNIGHT CAPITAL MARKETS LLC", "KNIGHT EQUITY MARKETS LP", 
-    "KNIGHT", "KNIGHT LINK", "KNIGHT MATCH ATS", "KOREA ECN SECURITIES CO. LTD (ATS)", "KOMERCNI BANKA, A.S.", "General purpose market for South Korea", "OTFLINK", "PAYWARD MENA HOLDINGS LTD.", "General purpose market for Kuwait", "FLOW DARK", 
-    "LAVAFLOW ECN", "LAVAFX", "RBC CAPITAL MARKETS LLC - HOSTED POOL", "RBC CAPITAL MARKETS LLC - TRAJECTORY CROSS", "LAMPOST CAPITAL", "General purpose market for Laos", "LATAM SEF", "LAN AND SPAR BANK A/S", "GFI SECURITIES LLC - CREDITMATCH (LATG)", "LAVA TRADING (CITI)", 
-    "LBBW - LANDESBANK BADEN-WUERTTEMBERG", "LLOYDS BANK CORPORATE MARKETS", "LLOYDS BANK CORPORATE MARKETS WERTPAPIERHANDELSBANK GMBH", "General purpose market for Lebanon", "General purpose market for Liberia", "BULGARIAN STOCK EXCHANGE - SBL", "LBBW - LANDESBANK BADEN-WUERTTEMBERG - LIQUIDITY PROVIDER", "LBBW - LANDESBANK BADEN-WUERTTEMBERG - SYSTEMATIC INTERNALISER", "General purpose market for Libya", "General purpose market for Saint Lucia", 
-    "LCH.CLEARNET", "CURRENEX LDFX", "LCX", "LEDGEREDGE B.V.", "LEDGER X LLC", "LEDGEREDGE", "LEDGEREDGE SECURITIES INC.", "LIQUIDNET EU LIMITED EQUITY MTF", "LIQUIDNET EU LIMITED FIXED INCOME MTF", "LEVEL ATS", 
-    "LIQUIDNET CANADA ATS", "PT LSEG - CLEARED IDR MATCHING", "General purpose market for Liechtenstein", "LIQUIDNET, INC. FIXED INCOME ATS", "LIGA BANK EG", "LINX", "TP ICAP UK MTF - LIQUIDNET CORPORATE BONDS AND SECURITIES DEBT", "LIQUIDNET H20", "TP ICAP UK MTF - LIQUIDNET CASH EQUITY", "CBOE EUROPE - LIS SERVICE", 
-    "CBOE EUROPE - LIS SERVICE (NL)", "LIQUIDNET, INC. H2O ATS", "LIQUIDNET, INC.", "General purpose market for Sri Lanka", "LIECHTENSTEINISCHE LANDESBANK (OSTERREICH) AG", "LMAX - DERIVATIVES", "LMAX - EQUITIES", "LMAX - FX AND CASH-SETTLED DERIVATIVES", "LMAX - INDICES/RATES/COMMODITIES", "LMAX EXCHANGE SINGAPORE - NDFS", 
-    "LMAX", "LME CLEAR", "LUMINOR BANK AS", "LUMINEX TRADING AND ANALYTICS LLC - ATS", "EUROGLOBALMTS", "TP ICAP EU - MTF - LIQUIDNET EU EQUITY", "TP ICAP EU - MTF - LIQUIDNET EU FIXED INCOME", "LOOPFX", "OTC MARKET", "LOUIS CAPITAL MARKETS UK LLP", 
-    "LLOYDS BANK", "LONDON PLATINUM AND PALLADIUM MARKET", "LPSFX LLC", "LIQUIDITYEDGE", "CITI LIQUIFI", "General purpose market for Lesotho", "LANG AND SCHWARZ TRADE CENTER", "LUMINEX TRADING AND ANALYTICS LLC", "LONG-TERM STOCK EXCHANGE, INC.", "General purpose market for Lithuania", 
-    "General purpose market for Luxembourg", "General purpose market for Latvia", "BARCLAYS LX JAPAN", "LYNX ATS", "M2 LIMITED", "BME MTF EQUITY (IIC AND ECR SEGMENTS)", "General purpose market for Macao", "MACQUARIE AUSTRALIA BLOCK CROSSING", "MERCATO ALTERNATIVO DEL CAPITALE", "MARKETAXESS EUROPE LIMITED", 
-    "General purpose market for Saint Martin", "MAGMA ATS", "MAKOR SECURITIES LONDON LTD", "MARKETAXESS SINGAPORE PTE LIMITED - LIVE MARKETS", "MALDIVES STOCK EXCHANGE", "MARKETAXESS NL B.V.", "MACQUARIE BANK EUROPE DESIGNATED ACTIVITY COMPANY", "MACQUARIE INTERNAL MARKETS (HONG KONG)", "MACQUARIE BANK INTERNATIONAL LIMITED", "MACQUARIE INTERNAL MARKETS (JAPAN)", 
-    "MACQUARIE CAPITAL EUROPE LIMITED", "MACQUARIE BANK LIMITED, LONDON BRANCH", "MACQUARIE INTERNAL MARKETS (AUSTRALIA)", "General purpose market for Morocco", "MERCADO ALTERNATIVO DE RENTA FIJA (MARF)", "MARKETAXESS SINGAPORE PTE LIMITED", "CBOE CANADA - MATCHNOW", "MATRIX LIMITED", "MAX MARKETS LIMITED", "MILLENNIUM BCP", 
-    "MBANK S.A.", "MORGAN STANLEY BANK INTERNATIONAL LIMITED - SYSTEMATIC INTERNALISER", "MTF SOFIA", "MTS CASH DOMESTIC - MTF", "MACQUARIE CAPITAL (IRELAND)", "General purpose market for Monaco", "ISE MERCURY, LLC", "NASDAQ COPENHAGEN A/S - AUCTION ON DEMAND", "CURRENEX MTF", "CURRENEX MTF - RFQ", 
-    "CURRENEX MTF - STREAMING", "METROPOLITAN STOCK EXCHANGE OF INDIA LIMITED", "MTS CZECH REPUBLIC", "General purpose market for Moldova", "General purpose market for Madagascar", "MEDIP (MTS PORTUGAL SGMR, SA)", "MIBGAS - DERIVATIVES", "General purpose market for Maldives", "MACQUARIE EXECUTION (AU)", "MACQUARIE EXECUTION (HK)", 
-    "NASDAQ MIDPOINT-ELO (M-ELO)", "MEMX LLC DARK", "MEMX LLC RETAIL MIDPOINT", "MEMX LLC EQUITIES", "MONTENEGRIN POWER EXCHANGE", "MERKUR MARKET - DARK POOL", "MERCADO ELECTRONICO DE RENTA FIJA", "EURONEXT GROWTH - OSLO", "MORGAN STANLEY EUROPE S.E. - SYSTEMATIC INTERNALISER", "ACE MARKET", 
-    "MET ZURICH", "General purpose market for Mexico", "MF GLOBAL ENERGY MTF", "EURONEXT - MERCADO DE FUTUROS E OPÇÕES", "FX CONNECT - MTF - ALLOCATIONS", "FX CONNECT - MTF", "FX CONNECT - MTF - RFQ", "MIZUHO BANK, LTD. DUESSELDORF BRANCH", "MIZUHO BANK EUROPE N.V.", "MIZUHO BANK, LTD. LONDON BRANCH", 
-    "MIZUHO BANK LTD. - PARIS BRANCH", "NASDAQ HELSINKI LTD - AUCTION ON DEMAND", "MIZUHO SECURITIES EUROPE", "MIZUHO INTERNATIONAL", "General purpose market for Marshall Islands", "MERCADO ORGANIZADO DEL GAS", "MITSUBISHI UFJ INVESTOR SERVICES AND BANKING", "NASDAQ ICELAND HF. - AUCTION ON DEMAND", "MIDCHAINS", "MIAMI INTERNATIONAL HOLDINGS, INC.", 
-    "MOSCOW EXCHANGE - ALL MARKETS", "EURONEXT MIV MILAN", "MIZUHO INTERNAL CROSSING", "MARKETAXESS ATS", "MERITKAPITAL", "General purpose market for North Macedonia", "MARKET SECURITIES (FRANCE) SA", "BANK OF AMERICA - MERRILL LYNCH AUCTION CROSS", "BANK OF AMERICA - MERRILL LYNCH OTC", "BOFA SECURITIES EUROPE - RFQ", 
-    "BOFA SECURITIES EUROPE - SYSTEMATIC INTERNALISER", "BANK OF AMERICA - MERRILL LYNCH OTC - EUROPE", "BOFA SECURITIES EUROPE", "General purpose market for Mali", "MERRILL LYNCH INTERNATIONAL BANK DESIGNATED ACTIVITY COMPANY", "MERRILL LYNCH INTERNATIONAL", "MERRILL LYNCH INTERNATIONAL - RFQ", "MERRILL LYNCH INTERNATIONAL - SYSTEMATIC INTERNALISER", "General purpose market for Malta", "BANK OF AMERICA - MERRILL LYNCH VWAP CROSS - EUROPE", 
-    "BANK OF AMERICA - MERRILL LYNCH VWAP CROSS", "EURONEXT ACCESS BRUSSELS", "BANK OF AMERICA - MERRILL LYNCH INSTINCT X - EUROPE", "General purpose market for Myanmar", "FIRST NORTH DENMARK - AUCTION ON DEMAND", "General purpose market for Montenegro", "FIRST NORTH FINLAND - AUCTION ON DEMAND", "General purpose market for Mongolia", "FIRST NORTH ICELAND - AUCTION ON DEMAND", "General purpose market for Northern Mariana Islands", 
-    "FIRST NORTH SWEDEN - AUCTION ON DEMAND", "MOC CROSS", "MOON", "FIRST NORTH SWEDEN - NORWAY AUCTION ON DEMAND", "ELECTRONIC BOND MARKET", "General purpose market for Mozambique", "MIAX PEARL, LLC", "General purpose market for Mauritania", "MORGAN STANLEY AUSTRALIA SECURITIES LIMITED", "MORGAN STANLEY MTF - PERIODIC AUCTION", 
-    "MORGAN STANLEY BANK INTERNATIONAL LIMITED", "MORGAN STANLEY AND CO. LLC", "MORGAN STANLEY MTF - CONTINUOUS CROSS DARK", "MICHAEL/STROM DOM MAKLERSKI SPOLKA AKCYJNA", "MAREX SPECTRON EUROPE LIMITED - OTF", "MORGAN STANLEY EUROPE S.E.", "MORGAN STANLEY AND CO. INTERNATIONAL PLC", "MS LONG CROSS", "MORGAN STANLEY AUTOMATED LIQUIDITY PROVISION", "MORGAN STANLEY MUFG SECURITIES CO., LTD", 
-    "MORGAN STANLEY MTF - NEGOTIATED TRADE", "MS POOL", "General purpose market for Montserrat", "MS RPOOL", "MAREX SPECTRON - OTF", "MORGAN STANLEY AND CO. INTERNATIONAL PLC - SYSTEMATIC INTERNALISER", "MS TRAJECTORY CROSSING ATS", "NASDAQ STOCKHOLM AB - AUCTION ON DEMAND", "MS TRAJECTORY CROSS", "MTS INTERDEALER SWAPS MARKET", 
-    "MUSCAT STOCK EXCHANGE - BOOK BUILDING", "MUSCAT STOCK EXCHANGE – NON-LISTED INSTRUMENTS", "EURONEXT MILAN", "BORSA ITALIANA - TRADING AFTER HOURS", "MTAX", "BONDMATCH", "General purpose market for Martinique", "MTS AUSTRIA", "MTS BONDS.COM", "MTS ITALIA", 
-    "MTS DENMARK", "MTS FINLAND", "MTS GREECE", "MTS CORPORATE MARKET", "MTS S.P.A.", "MTS POLAND", "MTS INTERDEALER SWAPS MARKET", "MTS SWAP MARKET", "MTS MARKETS INTERNATIONAL INC.", "MARKETAXESS CANADA COMPANY", 
-    "MARKETAXESS CORPORATION SINGLE-NAME CDS CENTRAL LIMIT ORDER", "MARKETAXESS CORPORATION MID-X TRADING SYSTEM", "MARKETAXESS SEF CORPORATION", "MARKETAXESS CORPORATION", "MUFG BANK (EUROPE) N.V.", "MUFG BANK, LTD. - LONDON BRANCH", "MUFG BANK, LTD. - MILANO BRANCH", "MUFG BANK, LTD. - PARIS BRANCH", "MITSUBISHI DIAMOND CROSSING", "MARIANA UFP LLP", 
-    "BOERSE MUENCHEN - REGULIERTER MARKT", "BOERSE MUENCHEN - FREIVERKEHR", "BOERSE MUENCHEN - GETTEX - REGULIERTER MARKT", "BOERSE MUENCHEN - GETTEX - FREIVERKEHR", "General purpose market for Mauritius", "MUFG SECURITIES EMEA PLC", "MUFG SECURITIES (EUROPE) N.V -", "MITSUBISHI UFJ TRUST INTERNATIONAL LIMITED", "MERCADO DE VALORES DE CORDOBA S.A.", "General purpose market for Malawi", 
-    "MARKETAXESS EUROPE LIMITED - LIVE MARKETS", "MARKETAXESS NL B.V. - LIVE MARKETS", "MEMX LLC OPTIONS", "General purpose market for Malaysia", "General purpose market for Mayotte", "MYTREASURY", "N2EX", "NATIONAL AUSTRALIA BANK - FX DERIVATIVES AND FIXED INCOME SECURITIES", "NAB EUROPE LIMITED", "NATIONAL AUSTRALIA BANK", 
-    "NATIONAL AUSTRALIA BANK EUROPE S.A.", "NAB EUROPE LIMITED - FIXED INCOME SECURITIES", "General purpose market for Namibia", "NATIONAL MERCANTILE EXCHANGE", "NASDAQ STOCKHOLM AB - APA SERVICE", "NASDAQ BALTIC", "NSDQ DARK", "NASDAQ OMX DERIVATIVES MARKETS", "NASD OTC MARKET", "NATIXIS", 
-    "NAVESIS-MTF", "NATIONAL BANK FINANCIAL INC.", "NOBLE EXCHANGE", "NATIONAL BOARD OF TRADE LIMITED", "NASDAQ OMX BX OPTIONS", "PAKISTAN MERCANTILE EXCHANGE", "General purpose market for New Caledonia", "SMBC NIKKO CAPITAL MARKETS EUROPE GMBH", "SMBC NIKKO CAPITAL MARKETS LIMITED", "ICE ENDEX UK OCM GAS SPOT", 
-    "ICE ENDEX FUTURES", "ICE ENDEX EUROPEAN GAS SPOT", "NSX DARK", "NATIONAL EQUITIES EXCHANGE AND QUOTATIONS", "NEO CONNECT", "CBOE CANADA - NEO-D (DARK)", "CBOE CANADA - NEO-L (MARKET BY ORDER)", "CBOE CANADA - NEO-N (MARKET BY PRICE)", "General purpose market for Niger", "NOMURA FINANCIAL PRODUCTS EUROPE GMBH", 
-    "AQSE MAIN MARKET (NON-EQUITY)", "AQSE GROWTH MARKET (NON-EQUITY)", "AQSE GROWTH MARKET (EQUITY)", "AQSE MAIN MARKET (EQUITY)", "AQSE TRADING (NON-EQUITY)", "NOREXECO ASA", "OSTTRA SEF", "AQSE TRADING (EQUITY)", "AQUIS STOCK EXCHANGE", "EBS MTF - RFQ - FOR CORPORATES TRADING FX PRODUCTS", 
-    "General purpose market for Norfolk Island", "FIDELITY CROSSSTREAM", "NATIONAL FINANCIAL SERVICES, LLC", "FIDELITY DARK", "General purpose market for Nigeria", "NATURAL GAS EXCHANGE", "NIBC", "NORWEGIAN INTER BANK OFFERED RATE", "General purpose market for Nicaragua", "NILE STOCK EXCHANGE", 
-    "General purpose market for Niue", "CLEARPOOL EXECUTION SERVICES, LLC - NATURAL LIQUIDITY ALLIANCE", "NORDDEUTSCHE LANDESBANK - GIROZENTRALE", "General purpose market for Netherlands", "APX POWER NL", "NATIONAL MULTI-COMMODITY EXCHANGE OF INDIA", "NOMURA SECURITIES INTERNATIONAL", "NOMURA SECURITIES CO LTD", "NOMURA - EXTERNAL CROSSING PLATFORM", "NORDIC MTF", 
-    "NEW EUROMTS", "REGIONAL EXCHANGE CENTRE - MICEX VOLGA REGION", "NASDAQ STOCKHOLM AB - COMMODITIES", "NODAL EXCHANGE", "NASDAQ STOCKHOLM AB - NORWEGIAN EQ DERIVATIVES", "NOMURA OTC TRADES", "NASDAQ STOCKHOLM AB - NORWEGIAN FI DERIVATIVES", "NASDAQ OMX EUROPE", "NASDAQ STOCKHOLM AB - OTC NOK WB EQ DERIVATIVES", "NORD POOL SPOT AS", 
-    "General purpose market for Norway", "HSH NORDBANK", "NASDAQ OSLO ASA", "NOS CLEARING ASA", "NOMURA INTERNATIONAL PLC", "EURONEXT NOTC", "NASDAQ STOCKHOLM AB - NOK WB EQ DERIVATIVES", "NOW CP - NEU CP", "NPEX", "GASPOINT NORDIC A/S", 
-    "General purpose market for Nepal", "NASDAQ PRIVATE MARKET - SECONDMARKET", "General purpose market for Nauru", "NORDIC SME", "NASDAQ SPOT AB", "NOBLE SECURITIES S.A.", "BENDIGO STOCK EXCHANGE LIMITED", "INTELLIGENTCROSS - NATURAL LIQUIDITY CROSS", "NATIXIS LONDON BRANCH", "NASDAQ EUROPE (NURO) DARK", 
-    "NASDAQ OMX EUROPE", "NATWEST MARKETS PLC", "NATWEST MARKETS NV", "BLOCKMATCH JAPAN", "NX", "NX FUTURES", "NX JAPAN", "NX SELECT JAPAN", "NEXTRADE", "NX ATS - CROSSING PLATFORM", 
-    "NX VWAP", "MILLENNIUM", "CME SWAPS MARKETS (NYMEX)", "NYMEX EUROPE LTD.", "NEW YORK PORTFOLIO CLEARING", "NYSE DARK", "NYKREDIT BANK", "ASX - NEW ZEALAND FUTURES AND OPTIONS", "General purpose market for New Zealand", "NZX CENTRAL", 
-    "NZX DERIVATIVES - FUTURES AND OPTIONS MARKET", "NZX DARK", "360T US-OTC", "OSLO BORS - APA", "OB GROUP ENERGY LIMITED", "OBERBANK AG", "BLUE OCEAN ALTERNATIVE TRADING SYSTEM", "ONECHRONOS FX", "SOVA CAPITAL", "OCTAURA - COLLATERALIZED LOAN OBLIGATION (CLO)", 
-    "OCTAURA - LOANS", "OCTAURA - ATS", "ONECHRONOS MARKETS EUROPE", "ONECHRONOS MARKETS UK", "ODDO BHF", "ODDO CONTREPARTIE", "OSAKA DIGITAL EXCHANGE - START", "ODX - OSAKA DIGITAL EXCHANGE", "OFEX", "OHV OTF", 
-    "OILX", "OLDENBURGISCHE LANDESBANK AG FX HANDEL", "OTCEX LLC", "OMI POLO ESPANOL S.A. (OMIE)", "OMEGA ATS", "THE IBERIAN ENERGY CLEARING HOUSE", "OMIP - POLO PORTUGUES, S.G.M.R., S.A. / OMIP DERIVATIVES MARKET", "General purpose market for Oman", "CITI-ONE", "ONE TRADING EXCHANGE - PERPETUALS", 
-    "ONE TRADING EXCHANGE", "FIRST NORTH SWEDEN - NORWAY", "OTHER OTC", "OP CORPORATE BANK PLC", "PEX-PRIVATE EXCHANGE", "OPTIMX MARKETS, INC", "OPTIONS PRICE REPORTING AUTHORITY", "OPTIVER V.O.F.", "OPTAXE MTF", "OSL DIGITAL SECURITIES EXCHANGE", 
-    "SIX X-CLEAR AG", "OSL SG EXCHANGES", "OTCQB MARKETPLACE", "OTCD", "OTCEX", "OTC LINK NQB IDQS (INTER-DEALER QUOTATION SYSTEM)", "OTC LINK ATS - OTC MARKETS", "OTC LINK ECN", "OTC OVERNIGHT", "OTCQX MARKETPLACE", 
-    "OTC EXCHANGE OF INDIA", "OTCX EU MTF", "OTP BANK NYRT", "OTP BANK ROMANIA SA", "BERNER KANTONALBANK OTC-X", "OTCX TRADING LIMITED UK MTF", "OPENYIELD ATS", "General purpose market for Pakistan", "General purpose market for Panama", "PARKER POLAND SP. ZO.O.", 
-    "PARFX", "PATRIA FINANCE A.S.", "ALTERNATIVE PLATFORM FOR SPANISH SECURITIES", "PIRAEUS BANK", "BULGARIAN STOCK EXCHANGE - APA", "TULLETT PREBON PLC - PREBON CDS", "General purpose market for Pitcairn", "NASDAQ COPENHAGEN A/S - PURESTREAM", "PHILIPPINE DEALING AND EXCHANGE CORP", "CODA MARKETS ATS DARK", 
-    "CODA MARKETS", "PEEL HUNT LLP UK", "PEPINS - MTF - HALF-YEAR", "PEPINS - MTF - MONTH", "PEPINS - MTF - QUARTER", "PEPINS - MTF", "PEPINS - MTF - YEAR", "General purpose market for Peru", "PERPETUAL MARKETS - PERP", "PAYWARD EUROPE SOLUTIONS LIMITED (KRAKEN)", 
-    "FIRST NORTH FINLAND - PURESTREAM", "FIRST NORTH SWEDEN - PURESTREAM", "PFTS QUOTE DRIVEN", "PFTS STOCK EXCHANGE", "PARNDF", "PAYWARD GLOBAL SOLUTIONS LIMITED (KRAKEN) - IE", "PAYWARD GLOBAL TRADING (KRAKEN)", "NASDAQ HELSINKI - PURESTREAM", "General purpose market for Philippines", "PEEL HUNT SYSTEMATIC INTERNALISER", 
-    "ARITAS FINANCIAL LTD", "OTC PINK CURRENT", "OTC PINK NO INFORMATION", "OTC PINK LIMITED", "OTC PINK MARKETPLACE", "ARITAS SECURITIES LLC", "PIPER SANDLER AND CO.", "PIRUM", "PIPER SANDLER AND CO. - ATS", "BANK POLSKA KASA OPIEKI S.A.", 
-    "PLUS DERIVATIVES EXCHANGE", "WARSAW STOCK EXCHANGE/POLISH POWER EXCHANGE/REGULATED MARKET", "WARSAW STOCK EXCHANGE/COMMODITIES/POLISH POWER - EXCHANGE/ORGANIZED TRADING FACILITIES", "WARSAW STOCK EXCHANGE/COMMODITIES/POLISH POWER EXCHANGE/SPOT", "WARSAW STOCK EXCHANGE/COMMODITIES/POLISH POWER EXCHANGE/ENERGY MARKET", "PLUS STOCK EXCHANGE", "BOERSE MUENCHEN - FREIVERKHER - PLUS - EUROPE", "General purpose market for Palau", "MTS PORTUGAL SGMR, SA", "PERPETUAL MARKETS - MAIN", 
-    "NASDAQ STOCKHOLM AB - PAN-NORDIC EQ DERIVATIVES", "General purpose market for Papua New Guinea", "WARSAW STOCK EXCHANGE/ENERGY MARKET/POEE", "General purpose market for Poland", "MTS PORTUGAL", "PORTFOLIO STOCK EXCHANGE", "PACIFIC OTC", "PO TRADE LIQUIDITY", "PROPERTY PARTNER EXCHANGE", "General purpose market for Puerto Rico", 
-    "General purpose market for North Korea", "MTS PRIME", "PROSPECTS", "PRAGMA ATS", "General purpose market for Portugal", "General purpose market for Paraguay", "General purpose market for Palestinian Occupied Territory", "OTC GREY MARKET", "NASDAQ STOCKHOLM AB - PURESTREAM", "NASDAQ PSX", 
-    "POLISH TRADING POINT", "INSTINET BLOCKCROSS ATS", "PUMA CAPITAL, LLC", "PUMA CAPITAL, LLC - OPTIONS", "PUNDION LLC", "CANADIAN SECURITIES EXCHANGE - PURE", "PROVABLE MARKETS", "TP ICAP E. AND C. OTF –  PVM COMMODITIES AND ENERGY DERIVATIVES", "POWER EXCHANGE INDIA LTD.", "General purpose market for French Polynesia", 
-    "General purpose market for Qatar", "QCX, LLC", "QUOTE MTF", "MTS QUASI GOVERNMENT", "INFRONT QUANT", "QWICKROUTE", "Q-WIXX PLATFORM", "R5FX LIMITED", "RABOBANK INTERNATIONAL UK", "RABOBANK", 
-    "RAYMOND JAMES", "RBC INVESTOR SERVICES BANK S.A.", "RBC - PARIS BRANCH", "RBC EUROPE LIMITED", "RBC CAPITAL MARKETS (EUROPE) GMBH", "RBC - ROYAL BANK OF CANADA", "RBC CAPITAL MARKETS LLC", "RBC INVESTOR SERVICES TRUST", "RAILBIRD EXCHANGE", "RAIFFEISEN BANK (HUNGARY)", 
-    "RAIFFEISEN BANK INTERNATIONAL AG", "RBC INVESTOR SERVICES BANK S.A. - SYSTEMATIC INTERNALISER", "RBS CROSS", "INSTINET RETAIL CBX", "RBC CAPITAL MARKETS ARBITRAGE S.A.", "RENAISSANCE SECURITIES (CYPRUS) LIMITED", "EBS MTF - RESET", "EBS MTF - RESET SEGMENT", "OSTTRA SEF MTF - RESET - RISK MITIGATION SERVICES", "General purpose market for Reunion", 
-    "REVOLUT X", "RAIFFEISENBANK, AS.", "REAL FORTUNE INVESTMENT L.L.C", "MARKETAXESS NL B.V. - RFQ HUB", "MARKETAXESS SINGAPORE PTE LIMITED - RFQ - HUB", "MARKETAXESS EUROPE LIMITED - RFQ - HUB", "RIVERCROSS DARK", "RIVERCROSS", "REFINITIV - FORWARDS MATCHING", "LEVEL ATS - RAYMOND JAMES AND ASSOCIATES X", 
-    "RAIFFEISENLANDESBANK OBERÖSTERREICH", "RMB MORGAN STANLEY", "RMB MORGAN STANLEY - INVENTORY MANAGER", "REFINITIV MTF", "MTS ISRAEL", "TAIPEI EXCHANGE", "ROSARIO FUTURE EXCHANGE", "SIX REPO AG", "RWANDA OTC MARKET", "General purpose market for Romania", 
-    "MOSCOW ENERGY EXCHANGE", "WARSAW STOCK EXCHANGE/BONDS/CATALYST/BONDSPOT/REGULATED MARKET", "ROUTE4GAS", "RAIFFEISEN BANK S.A. (ROMANIA)", "RWANDA STOCK EXCHANGE", "RBC INVESTOR SERVICES TRUST - SYSTEMATIC INTERNALISER", "REFINITIV TRANSACTIONS SERVICES LIMITED", "REFINITIV TRANSACTION SERVICES PTE. LTD", "MOSCOW EXCHANGE - DERIVATIVES MARKET", "RTX FINTECH AND RESEARCH", 
-    "RULEMATCH", "General purpose market for Russian Federation", "NON-PROFIT PARTNERSHIP FOR THE DEVELOPMENT OF FINANCIAL MARKET RTS", "RAIFFEISENVERBAND SALZBURG", "General purpose market for Rwanda", "S360", "SOCIETY3 FUNDERSMART", "SAGETRADER", "BANCO SANTANDER S.A.", "General purpose market for Saudi Arabia", 
-    "SPAREBANK 1 MARKETS", "BOLSA DE BARCELONA RENTA FIJA", "SCOTIABANK", "JAPANNEXT - XROSSNET", "JAPANNEXT - J - MARKET", "BOLSA DE BILBAO RENTA FIJA", "JAPANNEXT - U - MARKET", "JAPANNEXT - VWAP CROSSING", "SPOT REGULATED MARKET - BMFMS", "SYDBANK A/S", 
-    "STANDARD CHARTERED BANK AG", "SCALABLE CAPITAL", "BME SCALEUP", "SCOTTISH STOCK EXCHANGE", "SEED DIGITAL SECURITIES MARKET", "SEED FUTURES", "SEED DIGITAL COMMODITIES MARKET", "ZERO HASH LLC", "SEED SEF", "General purpose market for Sudan", 
-    "STIFEL EUROPE BANK AG", "SEB LITHUANIA", "SEB", "SEB - LIQUIDITY POOL", "SECDEX CLEARING LIMITED", "SECDEX DEPOSITORY LIMITED", "SECDEX EXCHANGE LIMITED", "SECFINEX", "SECDEX DIGITAL CUSTODIAN LIMITED", "SEEDRS - SECONDARY MARKET", 
-    "SECURITISED DERIVATIVES MARKET", "NASDAQ STOCKHOLM AB - SWEDISH EQ DERIVATIVES", "SISTEMA ESPECIAL DE LIQUIDACAO E CUSTODIA DE TITULOS PUBLICOS", "SEMOPX", "General purpose market for Senegal", "SEND - SISTEMA ELECTRONICO DE NEGOCIACION DE DEUDA", "NASDAQ STOCKHOLM AB - OTC SEK WB EQ DERIVATIVES", "STOCK EXCHANGE PERSPECTIVA", "NASDAQ STOCKHOLM AB - SEK WB EQ DERIVATIVES", "SWISSCANTO FUNDS CENTRE LIMITED", 
-    "FIS SECURITIES FINANCE MATCHING PLATFORM", "SFOX", "SG AMERICAS SECURITIES, LLC - SECOND VENUE", "SG AMERICAS SECURITIES, LLC", "SIGMA X2 - BENCHMARK CROSS", "SHANGHAI GOLD EXCHANGE", "GOLDMAN SACH MTF", "SIGMA X2", "SIGMA X EUROPE NON-DISPLAYED BOOK", "SIGMA X EUROPE AUCTION BOOK", 
-    "SIGMA X EUROPE NEGOTIATED TRADE", "SIGMA X MTF NON-DISPLAYED BOOK", "SIGMA X MTF - AUCTION BOOK", "SIGMA X MTF - NEGOTIATED TRADE", "SG OPTION EUROPE", "General purpose market for Singapore", "General purpose market for South Georgia and the South Sandwich Islands", "D.E. SHAW DARK", "ASSET MATCH", "D.E. SHAW", 
-    "General purpose market for Saint Helena, Ascension and Tristan da Cunha", "STOCK EXCHANGE OF HONG KONG LIMITED - SHANGHAI - HONG KONG STOCK CONNECT", "ALIOR BANK", "SIB CYPRUS LTD", "CREDIT SUISSE SECURITIES (EUROPE) LIMITED", "SCOTIABANK (IRELAND) DESIGNATED ACTIVITY COMPANY", "SIEGE FX LIMITED", "SIGMA X AUSTRALIA", "SIGMA X HONG KONG", "SIGMA X JAPAN", 
-    "SIGMA X CANADA", "CREDIT SUISSE BANK (EUROPE), S.A. - SYSTEMATIC INTERNALISER", "SIM VENTURE SECURITIES EXCHANGE", "SUSQUEHANNA INTERNATIONAL SECURITIES LIMITED", "SUSQUEHANNA INTERNATIONAL SECURITIES LIMITED - LONDON BRANCH", "General purpose market for Svalbard and Jan Mayen", "SKB BANKA D.D. LJUBLJANA", "SPAREKASSEN KRONJYLLAND", "SKYTRA", "General purpose market for Solomon Islands", 
-    "General purpose market for Sierra Leone", "SALZBURGER LANDES-HYPOTHEKENBANK", "MTS SLOVAKIA", "General purpose market for El Salvador", "SL-X - SECURITIES LENDING MTF", "SUMITOMO MITSUI BANKING CORPORATION - BRUSSELS BRANCH", "SMBC NIKKO SNET DARKPOOL", "SUMITOMO MITSUI BANKING CORPORATION - DUESSELDORF BRANCH", "SUMITOMO MITSUI BANKING CORPORATION EUROPE LIMITED", "SUMITOMO MITSUI BANKING CORPORATION - LONDON BRANCH", 
-    "SUMITOMO MITSUI BANKING CORPORATION EUROPE LIMITED - PARIS BRANCH", "SINGAPORE MERCANTILE EXCHANGE PTE LTD", "SMALL EXCHANGE, INC - DESIGNATED CONTRACT MARKET", "SMBC BANK EU AG", "General purpose market for San Marino", "MTS SPAIN", "SPAR NORD BANK", "SANTANDER UK", "TWO SIGMA SECURITIES, LLC", "General purpose market for Somalia", 
-    "SPAD TRADING", "SPECTRAXE", "SPB EXCHANGE - ALL MARKETS", "SPOTLIGHT STOCK MARKET DENMARK", "SPREADEX", "MAREX SPECTRON INTERNATIONAL LIMITED OTF", "SPOTLIGHT STOCK MARKET EUROPE", "SPECTRUM MARKETS", "SPOTLIGHT STOCK MARKET FINLAND", "MIAX SAPPHIRE, LLC", 
-    "ST. PETERSBURG INTERNATIONAL MERCANTILE EXCHANGE", "General purpose market for Saint Pierre and Miquelon", "SPOTLIGHT STOCK MARKET NORWAY", "SPREADZERO", "SPOTLIGHT STOCK MARKET ETP", "SPAREBANK 1 SMN", "SPOT FX", "SPX", "SQUARE GLOBAL - OTF", "General purpose market for Serbia", 
-    "SPEEDROUTE LLC", "STATE STREET BANK INTERNATIONAL GMBH", "STATE STREET BANK INTERNATIONAL FX", "STATE STREET BANK AND TRUST COMPANY", "General purpose market for South Sudan", "SOCIAL STOCK EXCHANGE", "STATE STREET BANK AND TRUST FX", "STATE STREET BANK INTERNATIONAL FX - LONDON BRANCH", "FIRST NORTH SWEDEN - SME GROWTH MARKET", "BONDVISION EUROPE MTF", 
-    "E-EXCHANGE", "SSW MARKET MAKING", "SCHNEIDER OTF", "STANDARD CHARTERED", "NASDAQ COMMODITIES - STEEL COMMODITY", "STIFEL NICOLAUS EUROPE LIMITED", "STIFEL, NICOLAUS AND COMPANY, INCORPORATED", "STIFEL, NICOLAUS AND COMPANY, INCORPORATED", "STOXX LIMITED", "General purpose market for Sao Tome and Principe", 
-    "PURESTREAM", "PRAGUE STOCK EXCHANGE - START (MTF)", "SUN TRADING INTERNATIONAL", "BOERSE STUTTGART - REGULIERTER MARKT", "BOERSE STUTTGART - FREIVERKEHR", "BOERSE STUTTGART - REGULIERTER MARKT - TECHNICAL PLATFORM 2", "BOERSE STUTTGART - FREIVERKEHR - TECHNICAL PLATFORM 2", "BOERSE STUTTGART - REGULIERTER MARKT - TECHNICAL PLATFORM 3", "BOERSE STUTTGART - FREIVERKEHR - TECHNICAL PLATFORM 3", "BOERSE STUTTGART - FREIVERKEHR - TECHNICAL PLATFORM 4", 
-    "STX FIXED INCOME", "BIT2ME SECURITY TOKENS EXCHANGE - STX", "SUNRISE BROKERS", "SUNRISE - MTF", "SUNRISE - OTF", "SUN TRADING LLC", "General purpose market for Suriname", "SVENSKA HANDELSBANKEN AB", "SVENSKA HANDELSBANKEN AB - SVEX", "General purpose market for Slovakia", 
-    "General purpose market for Slovenia", "SAINT VINCENT AND THE GRENADINES SECURITIES EXCHANGE", "SWAPSTREAM", "SWEDBANK", "General purpose market for Sweden", "SWEDBANK ESTONIA", "SWEDBANK LITHUANIA", "SWEDBANK LATVIA", "General purpose market for Swaziland", "General purpose market for Sint Maarten", 
-    "SAXO BANK A/S", "General purpose market for Seychelles", "SYNOPTION", "SYNKRONY EXCHANGE", "General purpose market for Syria", "STOCK EXCHANGE OF HONG KONG LIMITED - SHENZHEN - HONG KONG STOCK CONNECT", "TRADING 212 LIMITED", "TULLETT PREBON PLC - TP ENERGY", "TULLETT PREBON PLC - TP TRADEBLADE", "WARSAW STOCK EXCHANGE/BONDS/TREASURY BOND/BONDSPOT/B2C MARKET/MTF", 
-    "WARSAW STOCK EXCHANGE/BONDS/BONDSPOT/TREASURY BOND MARKET", "General purpose market for Turks and Caicos Islands", "General purpose market for Chad", "TRADITION OTF", "TFS CME DIRECT", "TIDE CM", "TORONTO DOMINION BANK - LONDON BRANCH", "TD SECURITIES", "TRADITION PARIS - TSAF", "INTELLIGENTCROSS - TDSX", 
-    "TRADEVILLE", "TAURUS TDX", "TP ICAP E AND C OTF - COMMODITY AND ENERGY DERIVATIVES", "TULLETT PREBON SECURITIES - OTF - EUROPEAN GOVERNMENT BONDS", "TULLETT PREBON EUROPE - MTF - FX DERIVATIVES", "TULLETT PREBON EUROPE - OTF - FX DERIVATIVES", "TULLETT PREBON EUROPE - OTF - GOVERNMENT BONDS EXCLUDING UK GILTS", "TULLETT PREBON EUROPE - OTF - GOVERNMENT BONDS - UK GILTS", "TULLETT PREBON EUROPE - OTF - INTEREST RATE DERIVATIVES", "TULLETT PREBON EUROPE - MTF - GOVERNMENT BONDS EXCLUDING UK GILTS", 
-    "TULLETT PREBON EUROPE - MTF - COMMODITIES AND ENERGY DERIVATIVES", "TULLETT PREBON EUROPE - MTF - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON EUROPE - MTF - GOVERNMENT BONDS - UK GILTS", "TULLETT PREBON EUROPE - MTF - MONEY MARKETS", "TULLETT PREBON EUROPE - OTF - MONEY MARKET INSTRUMENTS", "TULLETT PREBON EUROPE - MTF - REPOS", "TULLETT PREBON EUROPE - OTF - PREBON FX DERIVATIVES", "TULLETT PREBON EUROPE - OTF - PARIS - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON EUROPE - OTF - PARIS - GOVERNMENT BONDS - EXCLUDING GILTS", "TULLETT PREBON EUROPE - OTF - PARIS - INTEREST RATE DERIVATIVES", 
-    "TULLETT PREBON EUROPE - OTF - PARIS - MONEY MARKET INSTRUMENTS", "TULLETT PREBON EUROPE - OTF - PARIS - REPOS", "TULLETT PREBON EUROPE - OTF - PARIS - FX DERIVATIVES", "RADIAL-X", "TULLETT PREBON EUROPE - OTF - REPOS", "TP ICAP FX HUB", "TRADITION ESPANA OTF", "THAILAND FUTURES EXCHANGE", "TFS GREEN AUSTRALIAN GREEN MARKETS", "TFS GREEN CARBON CREDIT GLOBAL MARKETS", 
-    "T.F.S. DERIVATIVES HK LIMITED", "TFS GREEN EUROPEAN GREEN MARKETS", "TRADITION ENERGY", "TFS VARIANCE SWAPS SYSTEM", "TFS GREEN UNITED STATES GREEN MARKETS", "VOLBROKER", "TRADEGATE EXCHANGE", "General purpose market for Togo", "TRADEGATE AG - SYSTEMATIC INTERNALISER", "General purpose market for Thailand", 
-    "THEMIS TRADING LLC", "THIRD MARKET CORPORATION", "REFINITIV US SEF LLC", "TOTAN ICAP CO. LTD", "TULLETT PREBON EUROPE - MTF - INTEREST RATE DERIVATIVES", "General purpose market for Tajikistan", "General purpose market for Tokelau", "General purpose market for Turkmenistan", "TRADINGLAB", "LOUIS CAPITAL MARKETS EU", 
-    "General purpose market for East Timor", "ICE TMC", "TRADING 212 MARKETS LIMITED", "TRUMID EU MTF", "TURKISH MERCANTILE EXCHANGE", "TRUMID ATS", "EUROBENCHMARK TRES. BILLS", "TRUMID UK MTF", "TMX SELECT", "EURONEXT - TRADED BUT NOT LISTED AMSTERDAM", 
-    "EURONEXT - TRADING FACILITY BRUSSELS", "EURONEXT BLOCKS", "EURONEXT - TRADING FACILITY LONDON", "TORA CROSSPOINT", "TOM MTF DERIVATIVES MARKET", "TULLETT PREBON EUROPE - OTF - MADRID - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON EUROPE - OTF - MADRID - GOVERNMENT BONDS - EXCLUDING GILTS", "TOM MTF CASH MARKETS", "General purpose market for Tonga", "TOWER RESEARCH CAPITAL EUROPE", 
-    "TULLETT PREBON PLC - TP CREDITDEAL", "TP ICAP - UK - DIGITAL ASSETS - SPOT", "TULLETT PREBON SECURITIES - FRANKFURT - OTF", "TP ICAP EU - MTF - DERIVATIVES REGISTRATION", "TP ICAP EU - MTF - EQUITY AND ETF", "TULLETT PREBON (EUROPE) LIMITED", "TP ICAP E AND C OTF", "TULLETT PREBON PLC - TP EQUITYTRADE", "TULLETT PREBON EU OTF - REGISTRATION", "TULLETT PREBON EUROPE - OTF - MADRID", 
-    "TULLETT PREBON EU OTF", "TULLETT PREBON PLC - TP FORWARDDEAL", "TULLETT PREBON EUROPE - OTF - PARIS", "TP ICAP EU - MTF", "TP ICAP - UK - DIGITAL ASSETS", "THE PROPERTY INVESTMENT EXCHANGE", "THE PROPERTY INVESTMENT MARKET", "TP ICAP EU - MTF - ORDERBOOK", "TP ICAP EU - MTF - REGISTRATION", "TULLETT PREBON - INSTITUTIONAL SERVICES - OTF", 
-    "TULLETT PREBON - INSTITUTIONAL SERVICES - LIQUIDITY CHAIN - OTF - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON - INSTITUTIONAL SERVICES - MIREXA - OTF - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON - INSTITUTIONAL SERVICES - MIREXA - OTF - GOVERNMENT BONDS", "TULLETT PREBON PLC - TP REPO", "TP ICAP SEF", "TULLETT PREBON PLC - TP SWAPDEAL", "TP SEF, INC.", "TP ICAP RMO", "TULLETT PREBON SECURITIES - MTF", "TP UK OTF", 
-    "TULLETT PREBON PLC - TP SPOTDEAL", "TPSEF, INC - VOICE", "TULLETT PREBON - INSTITUTIONAL SERVICES - TPSYNREX - OTF - CORPORATE BONDS AND SECURITISED DEBT", "TURQUOISE EUROPE - PERIODIC AUCTIONS ORDER BOOK", "TURQUOISE EUROPE - NYLON CASH ORDER BOOK", "TURQUOISE EUROPE - DARK", "TURQUOISE EUROPE - LIT ORDER BOOK", "TRAIANA INC", "REFINITIV TRANSACTIONS SERVICES LIMITED - FXALL RFQ", "TRADITION ASIA LIMITED", 
-    "MARKETAXESS POST-TRADE LIMITED - APA", "TRADE REPUBLIC BANK", "TRACK ECN", "TOWER RESEARCH CAPITAL TRCX", "TFS CURRENCIES PTE LTD", "TRADITION", "TRAD-X", "TRADEWEB EUROPE LIMITED - APA", "TRADEWEB EUROPE LIMITED - OTF", "TRADEWEB EUROPE LIMITED", 
-    "REFINITIV TRANSACTION SERVICES LIMITED - FORWARDS MATCHING", "TRADEWEB FX OPTIONS", "TRADING 212 MARKETS (IRELAND) LIMITED", "MARKETAXESS POST-TRADE B.V. - APA", "MERJ EXCHANGE LIMITED", "TURQUOISE - PERIODIC AUCTIONS ORDER BOOK", "TURQUOISE NYLON CASH ORDER BOOK", "TURQUOISE NYLON CLEARED CONTRACT", "TURQUOISE DERIVATIVES MARKET", "TURQUOISE - DARK ORDER BOOK", 
-    "TURQUOISE SWAPMATCH", "TURQUOISE - LIT ORDER BOOK", "TOWER RESEARCH CAPITAL EUROPE LTD", "TRUEEX LLC - DESIGNATED CONTRACT MARKET (DMC)", "TRUEEX LLC - SEF (SWAP EXECUTION FACILITY)", "TRADING 212 UK LIMITED", "TRUEEX LLC", "TRADEWEB LLC", "TRAD-X EUROPE", "TRADITION SECURITIES AND DERIVATIVES INC.", 
-    "TSAF OTC - OTF", "TRADITION SBSEF", "DBOT ATS, LLC", "TP UK OTF - CORPORATE BONDS", "TP UK OTF - CREDIT DERIVATIVES", "TP UK OTF - EQUITY DERIVATIVES", "TRADITION SEF", "TULLETT PREBON SECURITIES - FRANKFURT - OTF - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON SECURITIES - FRANKFURT - OTF - GOVERNMENT BONDS - EX GILTS", "TP UK OTF - CORPORATE BONDS AND SECURITISED DEBT", 
-    "TP UK OTF - FX DERIVATIVES", "TP UK OTF - GOVERNMENT BONDS EXCLUDING UK GILTS", "TP UK OTF - GOVERNMENT BONDS - UK GILTS", "TRADITION SINGAPORE PTE. LTD.", "TP UK OTF - INTEREST RATE DERIVATIVES", "TULLETT PREBON SECURITIES - MTF - CORPORATE BONDS AND SECURITISED DEBT", "TULLETT PREBON SECURITIES - MTF - CREDIT DERIVATIVES", "TULLETT PREBON SECURITIES - MTF - GOVERNMENT BONDS EXCLUDING UK GILTS", "TULLETT PREBON SECURITIES - MTF - MONEY MARKET INSTRUMENTS", "TP UK OTF - MONEY MARKET INSTRUMENTS", 
-    "TULLETT PREBON SECURITIES - MTF - REPOS", "TP UK OTF - REPOS", "TULLETT PREBON SECURITIES - MTF - GOVERNMENT BONDS - UK GILTS", "General purpose market for Trinidad and Tobago", "General purpose market for Tunisia", "TP UK OTF - ORDERBOOK", "General purpose market for Turkey", "General purpose market for Tuvalu", "TRADEWEB EU BV - APA", "TRADEWEB EU BV - MTF", 
-    "TRADEWEB EU BV - OTF", "TRADEWEB EU BV", "TRADEWEB EUROPE LIMITED - GLOBAL TRADING PLATFORM", "TRADEWEB EUROPE LIMITED - HONG KONG", "TRADEWEB JAPAN KK - PTS", "TRADEWEB JAPAN KK - ETP", "General purpose market for Taiwan", "TRADEWEB COMPANY - ATS", "TW SEF LLC", "TRADEWEB EUROPE LIMITED - SINGAPORE", 
-    "BOFA VWAP CROSS AT LEVEL", "TEXAS STOCK EXCHANGE - DARK", "TEXAS STOCK EXCHANGE", "General purpose market for Tanzania", "360 TRADING NETWORKS INC.", "UNICREDIT BANK CZECH REPUBLIC AND SLOVAKIA, A.S.", "UNIVERSAL BARTER EXCHANGE CREDIT UNION", "UBI BANCA", "UNION BANK OF INDIA UK LTD", "UNIPOL BANCA S.P.A.", 
-    "UBS ATS", "UBS AG LONDON BRANCH - TRADING", "UBS PIN-FX", "UBS EUROPE SE", "UBS PIN (EMEA)", "UBS FX", "UBS TRADING", "UBS EUROPE SE", "UBS EUROPE SE - TRADING", "UBS PIN (UBS PRICE IMPROVEMENT NETWORK)", 
-    "UBS SECURITIES LLC", "UBS TRADING", "UBS CROSS", "UBS AG LONDON BRANCH", "UNICREDIT BANK AUSTRIA AG", "UNICREDIT BULBANK AD", "UNICREDIT BANK AG", "UNICREDIT BANK HUNGARY ZRT.", "UNICREDIT SPA", "UFEX", 
-    "General purpose market for Uganda", "UNITEDBLOCKTRADE", "UKRAINIAN INTERBANK CURRENCY EXCHANGE", "CREDIT AGRICOLE CIB UK BRANCH", "UKRAINIAN EXCHANGE", "MTS UK", "TP ICAP UK MTF - ORDERBOOK", "EPEX SPOT", "General purpose market for Ukraine", "TP ICAP UK MTF - REGISTRATION", 
-    "ALT XCHANGE (U)", "MTS CEDULAS MARKET", "UNICREDIT BANK AG - LONDON BRANCH - UK", "REGIONAL EXCHANGE CENTRE - MICEX URAL", "General purpose market for Uruguay", "General purpose market for United States", "360 TRADING NETWORKS INC.", "NASDAQ STOCKHOLM AB - OTC USD WB EQ DERIVATIVES", "NASDAQ STOCKHOLM AB - USD WB EQ DERIVATIVES", "EUROMTS LIMITED", 
-    "UEDA TRADITION SECURITIES LTD.", "General purpose market for Uzbekistan", "ICE BONDPOINT", "VIRTUAL AUCTION GLOBAL LIMITED", "VIRTUAL AUCTION GLOBAL MARKETS - MTF", "VIRTU CLIENT MARKET MAKING", "VAMOS", "General purpose market for Vatican City", "BITVAVO", "VANTAGE CAPITAL MARKETS LLP - OTF", 
-    "VIRTU MATCHIT - CONDITIONAL ROOM", "General purpose market for Saint Vincent and the Grenadines", "TSX VENTURE EXCHANGE - DRK", "VEGA-CHI", "General purpose market for Venezuela", "VERTICAL", "VIRTU FINANCIAL CAPITAL MARKETS LLC", "VICTORIA FALLS STOCK EXCHANGE", "VIRTU FINANCIAL IRELAND LIMITED (LONDON BRANCH)", "VIRTU FINANCIAL IRELAND LIMITED", 
-    "VIRTU MATCHIT - MAIN CROSSING SESSION", "VIRTU FINANCIAL IRELAND LIMITED - SYSTEMATIC INTERNALISER", "VIRTU FINANCIAL IRELAND LIMITED (LONDON BRANCH)", "VIRTU FINANCIAL IRELAND LIMITED - OTC", "General purpose market for British Virgin Islands", "General purpose market for United States Virgin Islands", "VIRTU FINANCIAL BD", "POSIT UK", "KABU.COMPTS-VWAP", "VONTOBEL LIQUIDITY EXTENDER", 
-    "VENOMEX LIMITED", "THE FAROESE SECURITIES MARKET", "MTS SLOVENIA", "WALL STREET ACCESS NYC - VNDM", "General purpose market for Viet Nam", "TRADITION - VOLATIS", "BANK VONTOBEL EUROPE AG", "EURONEXT - VENTES PUBLIQUES BRUSSELS", "NYSE EURONEXT - COMPARTIMENT DES VALEURS RADIEES PARIS", "VTB CAPITAL PLC", 
-    "VORTEX", "TRADELINK", "TRADEPLUS", "VSEOBECNA UVEROVA BANKA, AS", "VIRTU AMERICAS LLC", "General purpose market for Vanuatu", "CBOE EUROPE EQUITIES - NL", "VWD - APA SERVICE", "VWD TRANSACTIONSOLUTIONS AG", "WALL STREET ACCESS NYC", 
-    "WIENER BOERSE AG AMTLICHER HANDEL (OFFICIAL MARKET)", "WARSAW STOCK EXCHANGE/BONDS/CATALYST/LISTING", "WIENER BOERSE AG VIENNA MTF (VIENNA MTF)", "WIENER BOERSE AG GEREGELTER FREIVERKEHR (SECOND REGULATED MARKET)", "BANK ZACHODNI WBK S.A.", "WARSAW STOCK EXCHANGE/BONDS/CATALYST/LISTING", "WIENER BOERSE AG MIDPOINT AMTLICHER HANDEL (OFFICIAL MARKET)", "WARSAW STOCK EXCHANGE/ BONDS/CATALYST/MAIN MARKET", "WARSAW STOCK EXCHANGE/COMMODITY DERIVATIVES", "ICAP WCLK", 
-    "WARSAW STOCK EXCHANGE/FINANCIAL DERIVATIVES", "WEEDEN AND CO MARKETS", "WEL", "WELLS FARGO SECURITIES, LLC - EQUITIES", "WELLS FARGO LIQUIDITY CROSS ATS", "WARSAW STOCK EXCHANGE/ ETPS", "WELLS FARGO BANK NA - LONDON BRANCH", "WELLS FARGO SECURITIES, LLC - EQUITIES - LIQUIDITY PROVIDERS", "WELLS FARGO SECURITIES EUROPE, S.A.", "WARSAW STOCK EXCHANGE/COMMODITIES/POLISH POWER EXCHANGE/GAS", 
-    "WARSAW STOCK EXCHANGE/INDICES", "WINTERFLOOD SECURITIES LIMITED - ELECTRONIC PLATFORM", "WINTERFLOOD SECURITIES LIMITED - MANUAL TRADING", "WARSAW STOCK EXCHANGE - OTHER THAN XOFF OR XXXX", "General purpose market for Wallis and Futuna", "WEMATCH", "WEMATCH - SBL", "WEMATCH - SWAPS", "WARSAW STOCK EXCHANGE/BONDS/CATALYST/MTF", "WEMATCH US", 
-    "WOOD AND COMPANY FINANCIAL SERVICES, A.S.", "WARSAW STOCK EXCHANGE - SPO BOOK BUILDING", "EURONEXT - MARKET WITHOUT QUOTATIONS LISBON", "WALL STREET ACCESS", "WEMATCH US - SBL", "WELLS FARGO SECURITIES INTERNATIONAL", "WESTPAC BANKING CORPORATION", "General purpose market for Samoa", "WEMATCH US - SWAPS", "A1", 
-    "ABG SUNDAL COLLIER AB", "ABG SUNDAL COLLIER ASA", "BOURSE DES VALEURS ABIDJAN", "ABAXX EXCHANGE", "EURONEXT ACCESS DUBLIN", "AMSTERDAM COMMODITY EXCHANGE", "ATHENS EXCHANGE S.A. DERIVATIVES MARKET", "FINRA ALTERNATIVE DISPLAY FACILITY (ADF)", "ABU DHABI SECURITIES EXCHANGE", "AEX-AGRICULTURAL FUTURES EXCHANGE", 
-    "ALTERNATIVA FRANCE", "AFRICAN STOCK EXCHANGE", "AIM ITALIA - MERCATO ALTERNATIVO DEL CAPITALE", "ALBERTA STOCK EXCHANGE, THE", "ALGIERS STOCK EXCHANGE", "ALBANIA SECURITIES EXCHANGE", "ALTEX - ATS", "EURONEXT AMSTERDAM – MULTI-CURRENCY TRADING", "AMMAN STOCK EXCHANGE", "EURONEXT - EURONEXT AMSTERDAM", 
-    "ASIANEXT DERIVATIVES", "ASIANEXT TOKEN MARKETPLACE", "ASIANEXT CRYPTO SPOT", "BEURS VAN ANTWERPEN (ANTWERP STOCK EXCHANGE)", "AUSTRALIAN OPTIONS MARKET", "EURONEXT - APA", "REGIONAL EXCHANGE CENTRE - MICEX FAR EAST", "AUTOMATED EQUITY FINANCE MARKETS", "THE ARCHIPELAGO ECN", "ARMENIA SECURITIES EXCHANGE", 
-    "NYSE AMERICAN LLC", "IRISH STOCK EXCHANGE - GLOBAL EXCHANGE MARKET", "ASX - ALL MARKETS", "ATHENS EXCHANGE S.A. CASH MARKET", "ATLANTIC SECURITIES MARKET", "ALPHA EXCHANGE", "ALPHA-X", "NEW ZEALAND STOCK EXCHANGE - AUCKLAND", "ARIZONA STOCK EXCHANGE", "BAHAMAS INTERNATIONAL SECURITIES EXCHANGE", 
-    "BARBADOS STOCK EXCHANGE", "BAHRAIN BOURSE", "BANGALORE STOCK EXCHANGE LTD", "BOLSA DE BARCELONA", "MERCHBOLSA AGENCIA DE VALORES, S.A.", "BOLSA BRASILIERA DE FUTUROS", "JAKARTA FUTURES EXCHANGE (BURSA BERJANGKA JAKARTA)", "PERIMETER FINANCIAL CORP. - BLOCKBOOK ATS", "BOLSA DE COMERCIO DE CORDOBA", "BUDAPEST COMMODITY EXCHANGE", 
-    "LA BOLSA ELECTRONICA DE CHILE", "BOLSA DE COMERCIO DE MENDOZA S.A.", "BOLSA CENTROAMERICANA DE VALORES", "MERCADO DE VALORES DE MENDOZA S.A.", "BERMUDA STOCK EXCHANGE LTD", "BOLSA DE DIVIDA E VALORES DE ANGOLA (BODIVA) - ANGOLA SECURITIES EXCHANGE", "BELGRADE STOCK EXCHANGE", "BOERSE BERLIN", "JSE CASH BOND MARKET", "BOURSE DE BEYROUTH - BEIRUT STOCK EXCHANGE", 
-    "BELGIAN FUTURES AND OPTIONS EXCHANGE", "BOLSA DE VALORES DE BILBAO", "BARBADOS STOCK EXCHANGE - INTERNATIONAL SECURITIES MARKET", "STOCK EXCHANGE OF THAILAND - FOREIGN BOARD", "STOCK EXCHANGE OF THAILAND", "BANJA LUKA STOCK EXCHANGE", "EURONEXT BLOCK 2", "BLUENEXT", "BOLSA DE MERCADORIAS E FUTUROS", "BONDMART", 
-    "BUDAPEST STOCK EXCHANGE - XBOND", "BOLSA NACIONAL DE VALORES, S.A.", "BOLSA DE VALORES DE COLOMBIA", "BOLSA BOLIVIANA DE VALORES S.A.", "BSE LTD", "NASDAQ OMX BX", "BOTSWANA STOCK EXCHANGE", "BOX OPTIONS EXCHANGE", "BRATISLAVA STOCK EXCHANGE", "EURONEXT - EURONEXT BRUSSELS - DERIVATIVES", 
-    "BREMER WERTPAPIERBOERSE", "ROMANIAN COMMODITIES EXCHANGE", "BX SWISS AG", "BRUT ECN", "EURONEXT - EURONEXT BRUSSELS", "BOURSE REGIONALE DES VALEURS MOBILIERES", "XBERRY", "DERIVATIVES REGULATED MARKET - BVB", "SPOT REGULATED MARKET - BVB", "BOLSA DE VALORES DE SAO PAULO", 
-    "BROKERTEC FUTURES EXCHANGE", "SIX SWISS BILATERAL TRADING PLATFORM FOR STRUCTURED OTC PRODUCTS", "BUDAPEST STOCK EXCHANGE", "BOLSA DE COMERCIO DE BUENOS AIRES", "BULGARIAN STOCK EXCHANGE", "CAPE VERDE STOCK EXCHANGE", "MOZAMBIQUE STOCK EXCHANGE", "BOLSA DE VALORES DO PARANA", "BOLSA DE VALORES DE LA REPUBLICA DOMINICANA SA.", "NASDAQ OMX BX OPTIONS", 
-    "EGYPTIAN EXCHANGE", "CALCUTTA STOCK EXCHANGE", "CAN - ATS", "BOLSA DE VALORES DE CARACAS", "CASABLANCA STOCK EXCHANGE", "CAYMAN ISLANDS STOCK EXCHANGE", "CBOE DIGITAL EXCHANGE", "CBOE FUTURES EXCHANGE", "CBOE GLOBAL MARKETS INC.", "CHICAGO BOARD OF TRADE", 
-    "CHUBU COMMODITY EXCHANGE", "CHICAGO CLIMATE EXCHANGE, INC", "BAXTER FINANCIAL SERVICES", "COMMODITIES EXCHANGE CENTER", "DEUTSCHE BOERSE - CEF - REAL-TIME FEED", "WIENER BOERSE AG, CEGH GAS EXCHANGE", "UZBEK COMMODITY EXCHANGE", "CHINA FOREIGN EXCHANGE TRADE SYSTEM", "CANTOR FINANCIAL FUTURES EXCHANGE", "CHINESE GOLD AND SILVER EXCHANGE SOCIETY", 
-    "CHITTAGONG STOCK EXCHANGE LTD.", "NYSE TEXAS, INC.", "THE INTERNATIONAL STOCK EXCHANGE", "NYSE NATIONAL, INC.", "CHICAGO MERCANTILE EXCHANGE", "BOLSA DE COMERCIO CONFEDERADA S.A.", "CANADIAN SECURITIES EXCHANGE", "COLOMBO STOCK EXCHANGE", "ICMA", "CHICAGO RICE AND COTTON EXCHANGE", 
-    "CROATIAN POWER EXCHANGE", "NEW YORK COCOA, COFFEE AND SUGAR EXCHANGE", "NASDAQ COPENHAGEN A/S", "CAMBODIA SECURITIES EXCHANGE", "BOERSE STUTTGART - TECHNICAL PLATFORM 4", "UZBEKISTAN REPUBLICAN CURRENCY EXCHANGE", "CURRENEX", "CEVALDOM - OTC MARKET", "CX2", "NASDAQ CXD", 
-    "CYPRUS STOCK EXCHANGE - OTC", "CYPRUS STOCK EXCHANGE", "DAR ES SALAAM STOCK EXCHANGE", "DEUTSCHE BOERSE AG - CUSTOMIZED INDICES", "DEUTSCHE BOERSE AG - VOLATILITY INDICES", "DEUTSCHE BOERSE AG - INDICES", "DALIAN COMMODITY EXCHANGE", "DELHI STOCK EXCHANGE", "BOERSE STUTTGART - DIGITAL EXCHANGE", "JOINT-STOCK COMPANY “STOCK EXCHANGE INNEX”", 
-    "DUBAI FINANCIAL MARKET", "DHAKA STOCK EXCHANGE LTD", "SIX SWISS EXCHANGE - DEAL POOL - BOOK BUILDING AND ANNOUNCEMENT PLATFORM", "ITALIAN DERIVATIVES MARKET", "DNB BANK ASA", "CADE - MERCADO DE DEUDA PUBLICA ANOTADA", "AIAF - MERCADO DE RENTA FIJA", "TORONTO STOCK EXCHANGE - DRK", "DAMASCUS SECURITIES EXCHANGE", "BORSA ISTANBUL - DEBT SECURITIES MARKET", 
-    "DOUALA STOCK EXCHANGE", "DTB DEUTSCHE TERMINBOERSE GMBH", "IRISH STOCK EXCHANGE - ALL MARKET", "BOERSE DUESSELDORF", "DEUTSCHE BOERSE AG, FRANKFURT AM MAIN", "EQUIDUCT", "ENERGY BROKING IRELAND GAS TRADING PLATFORM", "EBS UK MULTILATERAL TRADING FACILITY", "ECB EXCHANGE RATES", "EUROPEAN COMMODITY CLEARING AG", 
-    "MTF - CYPRUS EXCHANGE", "EURONEXT OTHER COMMODITY DERIV", "EASTERN CARIBBEAN SECURITIES EXCHANGE", "ELECTRICITY DAY-AHEAD MARKET", "EDX LONDON LIMITED", "EUROPEAN ENERGY EXCHANGE", "EUROPEAN ENERGY EXCHANGE - NON-MTF MARKET", "EUROPEAN ENERGY EXCHANGE - REGULATED MARKET", "EUREX REPO - HQLA MARKET", "ELECTRICITY INTRA-DAY MARKET", 
-    "ELX", "XETRA MIDPOINT REGULATED MARKET", "XETRA MIDPOINT OPEN MARKET", "MERCADO MEXICANO DE DERIVADOS", "XETRA MIDPOINT SCALE", "EMS EXCHANGE", "BOERSE BERLIN EQUIDUCT TRADING", "BORSA ISTANBUL - EQUITY MARKET", "EUREX REPO - FUNDING AND FINANCING PRODUCTS", "EUREX REPO - TRIPARTY", 
-    "EURONEXT GROWTH DUBLIN", "XETRA - REGULIERTER MARKT", "XETRA - FREIVERKEHR", "XETRA INTERNATIONAL MARKET - REGULATED MARKET", "XETRA INTERNATIONAL MARKET - OPEN MARKET", "XETRA - NON-FINANCIAL INSTRUMENTS", "EURONEXT ETF ACCESS", "XETRA INTERNATIONAL MARKET", "XETRA", "XETRA - SCALE", 
-    "XETRA - REGULIERTERMARKT - OFF-BOOK", "XETRA - FREIVERKEHR - OFF-BOOK", "XETRA - SCALE - OFF-BOOK", "XETRA - NON-FINANCIAL INSTRUMENTS - OFF-BOOK", "EUREX BONDS", "EURONEXT COM, COMMODITIES FUTURES AND OPTIONS", "EURONEXT EQF, EQUITIES AND INDICES DERIVATIVES", "EURONEXT IRF, INTEREST RATE FUTURE AND OPTIONS", "EUREX REPO SECLEND MARKET", "EUREX REPO GMBH", 
-    "EUREX DEUTSCHLAND", "US FUTURES EXCHANGE", "IRISH STOCK EXCHANGE - GLOBAL EXCHANGE MARKET", "FINANCIALCONTENT - INDEXES", "MERCADO DE FUTUROS Y OPCIONES SOBRE CITRICOS", "FINANCIALCONTENT - DIGITAL ASSET TRADE REPORTING FACILITY", "FEX GLOBAL", "FUKUOKA FUTURES EXCHANGE", "FUKUOKA STOCK EXCHANGE", "SOCIETE DU NOUVEAU MARCHE", 
-    "FIRST NORTH DENMARK", "BORSA ISTANBUL - FUTURES AND OPTIONS MARKET", "FINEX (NEW YORK AND DUBLIN)", "FINNISH OPTIONS MARKET", "DEUTSCHE BOERSE AG", "FINANCIELE TERMIJNMARKET AMSTERDAM", "FTX", "GAMI ASSET INVESTMENT L.L.C", "CENTRAL EASTERN EUROPEAN GAS EXCHANGE LTD", "TRADEGATE EXCHANGE - FREIVERKEHR", 
-    "GLOBAL COAL LIMITED", "GLOBAL COMMODITIES EXCHANGE", "GLOBAL DERIVATIVES EXCHANGE", "HONG KONG GROWTH ENTERPRISES MARKET", "GFI BASISMATCH", "GAMI GLOBAL INVESTMENT L.L.C", "GHANA STOCK EXCHANGE", "WARSAW STOCK EXCHANGE/ EQUITIES/GLOBAL CONNECT - MTF", "GESTORE MERCATO ELETTRICO - ITALIAN POWER EXCHANGE", "GLOBALCLEAR MERCANTILE EXCHANGE", 
-    "TRADEGATE EXCHANGE - REGULIERTER MARKT", "GEORGIA STOCK EXCHANGE", "GLOBAL SECURITIES EXCHANGE", "BOLSA DE VALORES NACIONAL SA", "BOLSA DE VALORES DE GUAYAQUIL", "HANSEATISCHE WERTPAPIERBOERSE HAMBURG", "NIEDERSAECHSISCHE BOERSE ZU HANNOVER", "RISK MANAGEMENT EXCHANGE", "NASDAQ HELSINKI LTD", "NIPPON NEW MARKET - HERCULES", 
-    "ARCA EUROPE", "HIROSHIMA STOCK EXCHANGE", "HONG KONG FUTURES EXCHANGE LTD.", "HONG KONG EXCHANGES AND CLEARING LTD", "HANOI STOCK EXCHANGE - DERIVATIVES", "HANOI STOCK EXCHANGE (UNLISTED PUBLIC COMPANY TRADING PLATFORM)", "HONDURIAN STOCK EXCHANGE", "ISTANBUL GOLD EXCHANGE", "BAKU INTERBANK CURRENCY EXCHANGE", "SIX CORPORATE BONDS AG", 
-    "NASDAQ ICELAND HF.", "INSTINET CANADA CROSS", "INDONESIA STOCK EXCHANGE", "INSTINET EUROPE LIMITED", "IRISH STOCK EXCHANGE - ENTERPRISE SECURITIES MARKET", "BLOCKMATCH EUROPE", "INSTINET PACIFIC LTD", "INSTINET JAPAN", "INTERNATIONAL MARTIME EXCHANGE", "MULTI COMMODITY EXCHANGE OF INDIA LTD.", 
-    "TAIWAN INTERNATIONAL MERCANTILE EXCHANGE", "INTERNATIONAL MONETARY MARKET", "IMX HEALTH - FUTURES", "SHANGHAI INTERNATIONAL ENERGY EXCHANGE", "INSTINET", "INVESTRO", "INDEX AND OPTIONS MARKET", "INTERNATIONAL PETROLEUM EXCHANGE", "HELEX ELECTRONIC BOOK BUILDING", "IRAQ STOCK EXCHANGE", 
-    "INTERNATIONAL SECURITIES EXCHANGE, LLC - ALTERNATIVE MARKETS", "INTERNATIONAL SECURITIES EXCHANGE, LLC - EQUITIES", "ISLAMABAD STOCK EXCHANGE", "BORSA ISTANBUL", "INTERNATIONAL SECURITIES EXCHANGE, LLC", "JAMAICA STOCK EXCHANGE", "TOKYO STOCK EXCHANGE JASDAQ", "JAX", "JAKARTA STOCK EXCHANGE", "JAKARTA NEGOTIATED BOARD", 
-    "JAPAN EXCHANGE GROUP", "JOHANNESBURG STOCK EXCHANGE", "JIWAY EXCHANGE LTD", "OSAKA DOJIMA COMMODITY EXCHANGE", "THE PAKISTAN STOCK EXCHANGE LIMITED", "KAZAKHSTAN STOCK EXCHANGE", "KANSAS CITY BOARD OF TRADE", "KHOREZM INTERREGION COMMODITY EXCHANGE", "KOREA EXCHANGE COMMODITY MARKET", "KOREA EXCHANGE EMISSIONS MARKET", 
-    "KOREA FREEBOARD MARKET", "KOREA EXCHANGE (FUTURES MARKET)", "KOBE GOMU TORIHIKIJO (RUBBER EXCHANGE)", "KHARTOUM STOCK EXCHANGE", "KHARKOV COMMODITY EXCHANGE", "KIEV UNIVERSAL EXCHANGE", "KIEV INTERNATIONAL STOCK EXCHANGE", "KOBE KIITO TORIHIKIJO (RAW SILK EXCHANGE)", "BURSA MALAYSIA", "KOREA NEW EXCHANGE", 
-    "KOREA STOCK EXCHANGE", "KOREA EXCHANGE (KOSDAQ)", "KOREA EXCHANGE (STOCK MARKET)", "KYRGYZ STOCK EXCHANGE", "KANMON SHOHIN TORIHIKIJO (COMMODITY EXCHANGE)", "KUWAIT STOCK EXCHANGE", "KYOTO STOCK EXCHANGE", "LAHORE STOCK EXCHANGE", "LAO SECURITIES EXCHANGE", "MERCADO DE VALORES LATINOAMERICANOS (LATIBEX SMN)", 
-    "LONDON BULLION MARKET", "LONDON COMMODITY EXCHANGE, THE", "LCH LTD", "EURONEXT - EURONEXT LONDON", "LONDON DERIVATIVES EXCHANGE", "LABUAN INTERNATIONAL FINANCIAL EXCHANGE", "LGT BANK AG", "EURONEXT LIFFE", "BOLSA DE VALORES DE LIMA", "EURONEXT - EURONEXT LISBON", 
-    "AB NASDAQ VILNIUS", "SI ENTER", "LJUBLJANA STOCK EXCHANGE (SEMI-OFFICIAL MARKET)", "LJUBLJANA STOCK EXCHANGE (OFFICIAL MARKET)", "LIECHTENSTEINISCHE LANDESBANK AG", "LONDON METAL EXCHANGE", "LONDON STOCK EXCHANGE - CURVEGLOBAL MARKETS", "MALAYSIA DERIVATIVES EXCHANGE BHD", "LONDON STOCK EXCHANGE - MTF", "LONDON STOCK EXCHANGE", 
-    "LIQUIDITY CUBE PTY LTD", "LIBYAN STOCK MARKET", "LONDON TRADED OPTIONS MARKET", "LUSAKA STOCK EXCHANGE", "LUXEMBOURG STOCK EXCHANGE", "MERCADO ABIERTO ELECTRONICO", "MID AMERICA COMMODITY EXCHANGE", "BOLSA DE MADRID", "MACEDONIAN STOCK EXCHANGE", "MARKET FOR ALTERNATIVE INVESTMENT", 
-    "MALTA STOCK EXCHANGE", "BOLSA DE VALORES DE NICARAGUA", "MAPUTO STOCK EXCHANGE", "EURONEXT PARIS MATIF", "STOCK EXCHANGE OF MAURITIUS LTD", "MERCADO CONTINUO ESPANOL - CONTINUOUS MARKET", "MARCHE INTERBANCAIRE DES DEVISES M.I.D.", "MADRAS STOCK EXCHANGE", "MEFF RENTA FIJA", "MERCHANTS' EXCHANGE", 
-    "MERCADO DE VALORES DE BUENOS AIRES S.A.", "BOLSA MEXICANA DE VALORES (MEXICAN STOCK EXCHANGE)", "MIAX FUTURES EXCHANGE - OCC CLEARING", "MEFF FX FINANCIAL DERIVATIVES", "MIAX FUTURES EXCHANGE, LLC", "MOSCOW INTERBANK CURRENCY EXCHANGE", "MIDWEST STOCK EXCHANGE", "MERCATO ITALIANO DEI FUTURES", "BORSA ITALIANA S.P.A.", "MIAMI INTERNATIONAL SECURITIES EXCHANGE", 
-    "EURONEXT ACCESS PARIS", "OMLX, THE LONDON SECURITIES AND DERIVATIVES EXCHANGE LIMITED", "CYPRUS STOCK EXCHANGE - SMES", "BOLSA DE VALORES DE MONTEVIDEO", "MONTENEGRO STOCK EXCHANGE", "MONTREAL CLIMATE EXCHANGE", "THE MONTREAL EXCHANGE / BOURSE DE MONTREAL", "MOLDOVA STOCK EXCHANGE", "EURONEXT PARIS MONEP", "MONTREAL EXCHANGE THE / BOURSE DE MONTREAL", 
-    "CENTRAL COUNTERPARTY CLEARING CENTER MFB - JOINT-STOCK COMPANY", "EURONEXT - ACCESS MILAN", "MEFF POWER DERIVATIVES", "MEFF FINANCIAL DERIVATIVES", "EURONEXT DUBLIN", "MALAWI STOCK EXCHANGE", "MATBA-ROFEX", "BVB MTS INTERNATIONAL", "EUROMTS LTD", "BOERSE MUENCHEN", 
-    "MUSCAT STOCK EXCHANGE", "MERCADO DE VALORES DEL LITORAL S.A.", "SISTEMA ELETRÓNICO DE NEGOCIACION DE ACTIVOS FINANCIEROS", "NAIROBI STOCK EXCHANGE", "NAMIBIAN STOCK EXCHANGE", "NASDAQ - ALL MARKETS", "NATIONAL COMMODITY AND DERIVATIVES EXCHANGE LTD", "NASDAQ CAPITAL MARKET", "WARSAW STOCK EXCHANGE/ EQUITIES/NEW CONNECT - MTF", "NASDAQ OPTIONS MARKET", 
-    "PJSC NATIONAL DEPOSITORY OF UKRAINE", "NORDIC DERIVATIVES EXCHANGE", "NATIONAL STOCK EXCHANGE OF AUSTRALIA LIMITED", "NEW ZEALAND FUTURES AND OPTIONS EXCHANGE", "NEPAL STOCK EXCHANGE", "NEWEX", "NASDAQ FIXED INCOME TRADING", "NORDIC GROWTH MARKET", "NAGOYA STOCK EXCHANGE", "NASDAQ/NGS (GLOBAL SELECT MARKET)", 
-    "NIIGATA STOCK EXCHANGE", "NASDAQ INTERMARKET", "CENTRAL JAPAN COMMODITIES EXCHANGE", "NYSE LIFFE", "NASDAQ OMX NLX", "NORDIC MTF REPORTING", "NASDAQ/NMS (GLOBAL MARKET)", "NOMISMA (LIECHTENSTEIN) AG", "NORDEA", "NQLX", 
-    "BVB ENERGY DERIVATIVES", "THE NIGERIAN STOCK EXCHANGE", "NATIONAL STOCK EXCHANGE OF INDIA", "NAGOYA SENI TORIHIKIJO (TEXTILE EXCHANGE) - CHUBU COMMODITY EXCHANGE", "NXCHANGE", "NXCHANGE B.V. MTF", "NEW YORK COTTON EXCHANGE", "NEW YORK MERCANTILE EXCHANGE - OTC MARKETS", "ICE FUTURES U.S. INC", "NEW YORK MERCANTILE EXCHANGE - ENERGY MARKETS", 
-    "NEW YORK MERCANTILE EXCHANGE", "NEW YORK STOCK EXCHANGE, INC.", "NZX - ALL MARKETS", "OSLO BORS ASA - OSLO AXESS LIT X AUCTIONS", "OSLO AXESS NORTH SEA - DARK POOL", "NORDIC ALTERNATIVE BOND MARKET", "EURONEXT EXPAND OSLO", "OSLO BORS - DERIVATIVES MARKET", "ONECHICAGO, LLC", "ODESSA COMMODITY EXCHANGE", 
-    "OFF-EXCHANGE TRANSACTIONS - LISTED INSTRUMENTS", "OMX NORDIC EXCHANGE STOCKHOLM AB", "OTC PUBLICATION VENUE", "OSLO BORS - LIT X AUCTIONS", "OSLO CONNECT", "OSLO BORS NORTH SEA - DARK POOL", "OSAKA EXCHANGE", "OSAKA EXCHANGE J-NET", "OSLO BORS", "OSAKA MERCANTILE EXCHANGE", 
-    "OSAKA SENI TORIHIKIJO (TEXTILE EXCHANGE)", "OESTERREICHISCHE TERMIN- UND OPTIONENBOERSE, CLEARING BANK AG", "OTCBB", "OTP BANKA D.D.", "POSIT AUCTION", "PALESTINE SECURITIES EXCHANGE", "POSIT AUCTION UK", "EURONEXT - EURONEXT PARIS", "NASDAQ OMX FUTURES EXCHANGE", "STOCK EXCHANGE SAINT PETERSBURG", 
-    "NASDAQ OMX PHLX", "PHILADELPHIA OPTIONS EXCHANGE", "PHILIPPINE STOCK EXCHANGE, INC.", "PEEL HUNT CROSSING", "SAINT-PETERSBURG CURRENCY EXCHANGE", "UBS PIN (UBS PRICE IMPROVEMENT NETWORK)", "PLUS MARKETS GROUP", "EURONEXT PARIS – MULTI-CURRENCY TRADING", "BORSA ISTANBUL - PRECIOUS METALS AND DIAMONDS MARKETS", "POSIT DARK UK", 
-    "PNGX MARKETS LIMITED", "PORTAL", "POSIT DARK", "EUROPEAN ENERGY EXCHANGE - OTF GAS MARKET", "POWERNEXT", "PRAGUE STOCK EXCHANGE", "PRIDNEPROVSK COMMODITY EXCHANGE", "PRAGUE STOCK EXCHANGE - MTF", "PACIFIC EXCHANGE", "EUROPEAN ENERGY EXCHANGE - REGULATED GAS MARKET", 
-    "POSIT - ASIA PACIFIC", "NASDAQ OMX PSX", "LATIN AMERICAN STOCK EXCHANGE, INC.", "XP INVESTMENTS UK LLP", "XP INVESTMENTS US, LLC", "LONDON STOCK EXCHANGE – PRIVATE SECURITIES MARKET", "POWER EXCHANGE CENTRAL EUROPE", "QLX", "SIX SWISS EXCHANGE - STRUCTURED PRODUCTS", "SIX SWISS EXCHANGE - ETF QOD", 
-    "BOERSE DUESSELDORF - QUOTRIX", "BOLSA DE VALORES DE QUITO", "RASDAQ", "RINGGIT BOND MARKET", "RAIFFEISEN CENTROBANK AG", "SIX REPO AG - CH REPO MARKET", "POSIT RFQ", "BOLSA DE VALORES DO RIO DE JANEIRO", "NASDAQ RIGA AS", "RM-SYSTEM CZECH STOCK EXCHANGE - MTF", 
-    "SK RM-S (SLOVAK STOCK EXCHANGE)", "RM-SYSTEM CZECH STOCK EXCHANGE", "BOLSA DE COMERCIO ROSARIO", "SIX REPO AG - OTC SPOT MARKET", "REGIONAL EXCHANGE CENTRE - MICEX SOUTH", "MERCADO DE VALORES DE ROSARIO S.A.", "ROMANIAN POWER MARKET", "PEEL HUNT RETAIL", "RTR (REUTERS-REALTIME-DATEN)", "INTERNET DIRECT-ACCESS EXCHANGE", 
-    "JSE EQUITY DERIVATIVES MARKET", "SAMARA CURRENCY INTERBANK EXCHANGE", "SAPPORO SECURITIES EXCHANGE", "SPOTLIGHT STOCK MARKET AB", "SAUDI STOCK EXCHANGE", "JAPANNEXT - X - MARKET", "SGX BOND PRO", "BOERSE FRANKFURT WARRANTS TECHNICAL 1", "BOERSE FRANKFURT WARRANTS TECHNICAL 2", "BOERSE FRANKFURT WARRANTS TECHNICAL 3", 
-    "SGX CATALIST", "SGX COMMODITIES", "SINGAPORE CENTRAL LIMIT ORDER BOOK INTERNATIONAL", "BOERSE FRANKFURT WARRANTS TECHNICAL", "STOXX LIMITED - CUSTOMIZED INDICES", "SIX DIGITAL EXCHANGE", "SIX SWISS EXCHANGE - EBBO BOOK", "SHENZHEN STOCK EXCHANGE - SHENZHEN - HONG KONG STOCK CONNECT", "SWAPEX, LLC", "SINGAPORE EXCHANGE", 
-    "JSE COMMODITY DERIVATIVES MARKET", "ASX - TRADE24", "SOCIETE GENERALE", "SOCIETE GENERALE (LONDON BRANCH)", "SHANGHAI FUTURES EXCHANGE", "SANTIAGO STOCK EXCHANGE", "SHENZHEN STOCK EXCHANGE", "SHANGHAI STOCK EXCHANGE", "SIBERIAN EXCHANGE", "SIBERIAN INTERBANK CURRENCY EXCHANGE", 
-    "SGX DERIVATIVES MARKET", "SIX SWISS EXCHANGE - SLS", "SHENZHEN MERCANTILE EXCHANGE", "EURONEXT BLOCK", "BOLSA DE VALORES DE SAO PAULO - SOMA", "BSP REGIONAL ENERGY EXCHANGE - SOUTH POOL", "EURONEXT STRUCTURED PRODUCTS MTF", "SOUTH PACIFIC STOCK EXCHANGE", "MERCADO DE FUTUROS DE ACEITE DE OLIVA, S.A.", "SHANGHAI STOCK EXCHANGE - SHANGHAI - HONG KONG STOCK CONNECT", 
-    "SARAJEVO STOCK EXCHANGE", "HOCHIMINH STOCK EXCHANGE", "REPUBLICAN STOCK EXCHANGE", "BOERSE STUTTGART - TECHNICAL PLATFORM 2", "FIDELITY CROSSSTREAM ATS", "NASDAQ STOCKHOLM AB", "BOERSE STUTTGART - TECHNICAL PLATFORM 3", "BOERSE STUTTGART", "STOXX LIMITED - VOLATILITY INDICES", "STOXX LIMITED - INDICES", 
-    "SURABAYA STOCK EXCHANGE", "EL SALVADOR STOCK EXCHANGE", "ESWATINI STOCK EXCHANGE", "SWX SWISS BLOCK", "SIX SWISS EXCHANGE - SIX SWISS EXCHANGE AT MIDPOINT", "SWISS OPTIONS AND FINANIAL FUTURES EXCHANGE", "SIX SWISS EXCHANGE", "FIRST NORTH ESTONIA", "TAISDAQ", "TEL AVIV STOCK EXCHANGE", 
-    "TAIWAN FUTURES EXCHANGE", "TAIWAN STOCK EXCHANGE", "NASDAQ TALLINN AS", "TOKYO STOCK EXCHANGE-TOKYO PRO MARKET", "TALLINN STOCK EXCHANGE - REGULATED MARKET", "TEHRAN STOCK EXCHANGE", "TORONTO FUTURES EXCHANGE", "TOKYO FINANCIAL EXCHANGE", "TRADEPOINT FINANCIAL NETWORKS PLC", "TIRANA STOCK EXCHANGE", 
-    "TOKYO STOCK EXCHANGE - TOSTNET-1", "TOKYO STOCK EXCHANGE - TOSTNET-2", "TOKYO STOCK EXCHANGE - TOSTNET-3", "TOYOHASHI KANKEN TORIHIKIJO (DRIED COCOON EXCHANGE) - CHUBU COMMODITY EXCHANGE", "TOKYO GRAIN EXCHANGE", "TOKYO STOCK EXCHANGE", "TOKYO COMMODITY EXCHANGE", "TLX", "BUDAPEST STOCK EXCHANGE - XTEND", "TSX VENTURE EXCHANGE - NEX", 
-    "TORONTO OPTIONS EXCHANGE", "TULLETT PREBON PLC - TP ENERGYTRADE", "INTERNATIONAL SECURITIES EXCHANGE, LLC - TOPAZ", "XTRAMARKED", "XTRD", "TRINIDAD AND TOBAGO STOCK EXCHANGE", "ZAGREB MONEY AND SHORT TERM SECURITIES MARKET INC", "TORONTO STOCK EXCHANGE", "TSX VENTURE EXCHANGE", "NUEVA BOLSA DE COMERCIO DE TUCUMAN S.A.", 
-    "TUNIS STOCK EXCHANGE (BOURSE DE TUNIS)", "TULLETT PREBON PLC", "TURKISH DERIVATIVES EXCHANGE", "XTX DIRECT", "XTX MARKETS SAS", "XTX MARKETS", "UKRAINIAN STOCK EXCHANGE", "AQUIS EXCHANGE PLC - AMP - DARK ORDER BOOK", "UGANDA SECURITIES EXCHANGE", "UKRAINIAN UNIVERSAL COMMODITY EXCHANGE", 
-    "MONGOLIAN STOCK EXCHANGE", "UBS MTF LIMITED - PERIODIC AUCTION ORDER BOOK", "UNIVERSAL BROKER'S EXCHANGE 'TASHKENT'", "UNITED STOCK EXCHANGE", "BOLSA DE VALENCIA", "VARAZDIN STOCK EXCHANGE, THE", "VESTIMA", "ALTERNATIVE MARKET-FIRST NORTH LITHUANIA", "WIENER BOERSE AG, WERTPAPIERBOERSE (SECURITIES EXCHANGE)", "VLADIVOSTOK (RUSSIA) STOCK EXCHANGE", 
-    "BOLSA DE VALORES Y PRODUCTOS DE ASUNCION SA", "VP BANK AG", "VANCOUVER STOCK EXCHANGE", "SIX SWISS EXCHANGE - BLUE CHIPS SEGMENT", "CBOE EUROPE EQUITIES - LONDON", "WARSAW STOCK EXCHANGE/EQUITIES/MAIN MARKET", "WIENER BOERSE AG", "INTERCONTINENTAL EXCHANGE - ICE FUTURES CANADA", "WEEDEN ATS", "FRANKFURT CEF SC", 
-    "General purpose market for No Country", "NO MARKET (E.G. UNLISTED)", "TRADEWEB AUSTRALIA", "YOKOHAMA COMMODITY EXCHANGE (WRONGLY RENAMED TOKYO GRAIN EXCHANGE SEPT 2006)", "ZAGREB STOCK EXCHANGE", "THE ZAGREB STOCK EXCHANGE MTF", "PROGRESS MARKET", "ZHENGZHOU COMMODITY EXCHANGE", "ZIMBABWE STOCK EXCHANGE", "General purpose market for Yemen", 
-    "COMHAR CAPITAL MARKETS, LLC - US EQUITIES", "JSE INTEREST RATE DERIVATIVES MARKET", "General purpose market for South Africa", "ZAGREB STOCK EXCHANGE - APA", "ZAR X", "BULGARIAN STOCK EXCHANGE - MAIN MARKET", "ZBX", "ZERO HASH", "JSE CURRENCY DERIVATIVES MARKET", "ZERO HASH EUROPE", 
-    "ZURCHER KANTONALBANK SECURITIES EXCHANGE", "General purpose market for Zambia", "ZOBEX", "ZODIA MARKETS", "General purpose market for Zimbabwe"
-};
-//
-//
-//
@@ -51,7 +51,11 @@
 #define __MARKETID_H__
 
 #include <string>
-#include <iostream>
+#include <iosfwd>
+
+#ifndef __STRINGPOOL_H__
+#include "StringPool.h"
+#endif
 
 
 class MarketId
@@ -409,13 +413,16 @@ public:
     
 private:
     
+    friend class ArrowExport;
+    template <typename> friend class Dense;
+    
     short m_mic;
     
     static const short        m_search[28];   
     static const short        m_fromISO[MAXMARKETID]; 
     static const short        m_toISO[NUMMARKETID];
-    static const char * const m_codes[NUMMARKETID];
-    static const char * const m_fullNames[NUMMARKETID];
+    static const StringPool   m_codes;
+    static const StringPool   m_fullNames;
 };
 
 
@@ -425,6 +432,14 @@ operator<<( std::ostream &ostr, const MarketId &m );
 std::istream&
 operator>>( std::istream &istr, MarketId &m );
 
+// hashed by the numeric code
+template <>
+struct std::hash<MarketId>
+{
+    std::size_t
+    operator()( const MarketId &m ) const noexcept { return std::size_t(short(m)); }
+};
+
 
 
 #endif
@@ -0,0 +1,234 @@
+/* MarketSearch 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   MarketSearch.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __MARKETSEARCH_H__
+#include "MarketSearch.h"
+#endif
+
+#ifndef __NAME_H__
+#include "Name.h"
+#endif
+
+#include <map>
+#include <algorithm>
+#include <cassert>
+
+
+std::vector<std::string>
+MarketSearch::tokenise( const std::string &name )
+{
+    const std::string s = Name::toupper(Name::deaccent(name));
+
+    // bytes over 127 are what deaccent could not map and are kept as part of a token
+    std::vector<std::string> retVal(1);
+    for (char c : s)
+    {
+        const unsigned char u = (unsigned char) c;
+        if ((u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9') || u > 127)
+            retVal.back() += c;
+        else if (!retVal.back().empty())
+            retVal.emplace_back();
+    }
+    if (retVal.back().empty())
+        retVal.pop_back();
+    return retVal;
+}
+
+MarketSearch::MarketSearch( void )
+{
+    // the distinct tokens of each name
+    std::vector<std::vector<std::string>> names(MarketId::NUMMARKETID);
+    std::map<std::string, std::vector<std::uint16_t>> postings;
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+    {
+        names[i] = tokenise(MarketId::index(i).name());
+        std::sort(names[i].begin(), names[i].end());
+        names[i].erase(std::unique(names[i].begin(), names[i].end()), names[i].end());
+
+        for (const std::string &t : names[i])
+            postings[t].push_back(std::uint16_t(i));
+    }
+
+    // token ids in sorted order, the postings are sorted as the markets were visited in order
+    std::map<std::string, int> ids;
+    m_tokenStart.push_back(0);
+    m_postingStart.push_back(0);
+    for (const auto &p : postings)
+    {
+        ids[p.first] = int(ids.size());
+        m_tokens += p.first;
+        m_tokenStart.push_back(std::uint32_t(m_tokens.size()));
+        m_postings.insert(m_postings.end(), p.second.begin(), p.second.end());
+        m_postingStart.push_back(std::uint32_t(m_postings.size()));
+    }
+
+    m_nameStart.push_back(0);
+    for (int i = 0; i < MarketId::NUMMARKETID; ++i)
+    {
+        for (const std::string &t : names[i])
+            m_names.push_back(std::uint16_t(ids[t]));
+        m_nameStart.push_back(std::uint32_t(m_names.size()));
+    }
+}
+
+int
+MarketSearch::lowerBound( std::string_view t ) const
+{
+    int lo = 0, hi = size();
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (token(mid) < t)
+            lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+std::span<const std::uint16_t>
+MarketSearch::postings( std::string_view t ) const
+{
+    const int lo = lowerBound(t);
+    if (lo == size() || token(lo) != t)
+        return std::span<const std::uint16_t>();
+    return std::span<const std::uint16_t>(m_postings.data() + m_postingStart[lo], m_postings.data() + m_postingStart[lo + 1]);
+}
+
+std::vector<std::vector<MarketSearch::Group>>
+MarketSearch::parse( const std::string &query ) const
+{
+    // the token ids equal to t or, if prefix, beginning with it
+    auto term = [this]( const std::string &t, bool prefix ) {
+        const int first = lowerBound(t);
+        int last = first;
+        while (last < size() && ((prefix) ? token(last).starts_with(t) : token(last) == t))
+            ++last;
+        return Term(first, last);
+    };
+
+    std::vector<std::vector<Group>> retVal;
+    bool join = false; // the previous word was OR
+    for (const std::string &word : Name::split(Name::trim(query), std::string(" ")))
+    {
+        if (word.empty())
+            continue;
+
+        if (Name::toupper(word) == "OR")
+        {
+            join = !retVal.empty();
+            continue;
+        }
+
+        // an alternative of several tokens, such as "new-york", matches names with all of them
+        std::vector<Group> alternatives;
+        for (const std::string &alt : Name::split(word, std::string("|")))
+        {
+            const bool prefix = !alt.empty() && alt.back() == '*';
+            const std::vector<std::string> t = tokenise((prefix) ? alt.substr(0, alt.size() - 1) : alt);
+
+            Group g;
+            for (std::size_t i = 0; i < t.size(); ++i)
+                g.push_back(term(t[i], prefix && i + 1 == t.size()));
+            if (!g.empty())
+                alternatives.push_back(g);
+        }
+
+        if (alternatives.empty())
+            continue;
+
+        if (join)
+            retVal.back().insert(retVal.back().end(), alternatives.begin(), alternatives.end());
+        else retVal.push_back(alternatives);
+        join = false;
+    }
+    return retVal;
+}
+
+MarketSet
+MarketSearch::evaluate( const std::vector<std::vector<Group>> &words ) const
+{
+    // the markets with any of the tokens of t
+    auto postingSet = [this]( const Term &t ) {
+        MarketSet retVal;
+        for (std::uint32_t p = m_postingStart[t.first]; p < m_postingStart[t.second]; ++p)
+            retVal.set(m_postings[p]);
+        return retVal;
+    };
+
+    MarketSet retVal;
+    for (std::size_t w = 0; w < words.size(); ++w)
+    {
+        MarketSet s;
+        for (const Group &g : words[w])
+        {
+            MarketSet a = postingSet(g[0]);
+            for (std::size_t j = 1; j < g.size(); ++j)
+                a &= postingSet(g[j]);
+            s |= a;
+        }
+
+        if (w == 0)
+            retVal = s;
+        else retVal &= s;
+
+        if (retVal.empty())
+            break;
+    }
+    return retVal;
+}
+
+MarketSet
+MarketSearch::matches( const std::string &query ) const
+{
+    return evaluate(parse(query));
+}
+
+std::vector<MarketSearch::Match>
+MarketSearch::search( const std::string &query ) const
+{
+    const std::vector<std::vector<Group>> words = parse(query);
+    const MarketSet found = evaluate(words);
+
+    std::vector<Match> retVal;
+    retVal.reserve(found.count());
+    found.forEach([this, &words, &retVal]( const MarketId &mic ) {
+        // the tokens of the name that some term of the query matches
+        const int i = MarketId::index(mic);
+        int matched = 0;
+        for (std::uint32_t k = m_nameStart[i]; k < m_nameStart[i + 1]; ++k)
+        {
+            const int t = m_names[k];
+            bool hit = false;
+            for (const std::vector<Group> &w : words)
+            {
+                for (const Group &g : w)
+                {
+                    for (const Term &x : g)
+                        hit = hit || (t >= x.first && t < x.second);
+                }
+            }
+            matched += hit;
+        }
+
+        const int n = int(m_nameStart[i + 1] - m_nameStart[i]);
+        retVal.push_back(Match{ mic, (n) ? double(matched) / n : 0.0 });
+    });
+
+    std::stable_sort(retVal.begin(), retVal.end(), []( const Match &a, const Match &b ) { return a.coverage > b.coverage; });
+    return retVal;
+}
+
+//
+//
+//
+
@@ -0,0 +1,130 @@
+/* MarketSearch 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   MarketSearch.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Word search over the full names of the markets, e.g. "london exch*" or "new york stock|mercantile".
+
+ Each name is folded (deaccented, upper cased) and cut into tokens at every character other than a letter or digit, so
+ "NEW YORK STOCK EXCHANGE, INC." has the tokens NEW, YORK, STOCK, EXCHANGE and INC. The index keeps the distinct tokens
+ in sorted order and, for each, the sorted MarketId::index() of the markets whose name contains it as a uint16 posting
+ list, and for each market the ids of its tokens.
+
+ A query is a list of words which must all match. A word is a token, a prefix ending in '*' (the tokens with the prefix
+ are a contiguous range of the sorted tokens), or alternatives joined by '|' or by OR between words. An alternative
+ that folds to several tokens must match all of them, so "new-york|nasdaq" is (NEW and YORK) or NASDAQ. Each word becomes
+ the MarketSet of the union of its postings and the words are intersected as MarketSets, 48 words of 64 bits that the
+ compiler vectorises (see EntitySet), so a query is a few microseconds against milliseconds for a regular expression over
+ every name.
+
+ search() ranks the matches by coverage, the fraction of the tokens of a name that the query matches, so "london stock
+ exchange" puts LONDON STOCK EXCHANGE (coverage 1) ahead of LONDON STOCK EXCHANGE - MTF (coverage 0.75). Ties go
+ to the market with the lower index.
+
+ Example
+
+ MarketSearch s;
+
+ for (const MarketSearch::Match &m : s.search("london exch*"))
+     std::cout << m.mic << " " << m.mic.name() << " " << m.coverage << std::endl;
+
+ MarketSet nyse = s.matches("new york stock|mercantile");
+
+ */
+
+
+#ifndef __MARKETSEARCH_H__
+#define __MARKETSEARCH_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstdint>
+
+
+#ifndef __ENTITYSET_H__
+#include "EntitySet.h"
+#endif
+
+
+
+class MarketSearch
+{
+public:
+
+    struct Match
+    {
+        MarketId mic;
+        double   coverage;
+    };
+
+    // the index over every name in the compiled MarketId table
+    MarketSearch( void );
+    ~MarketSearch( void )=default;
+
+    // the markets matching query, best coverage first
+    std::vector<Match>
+    search( const std::string &query ) const;
+
+    // the markets matching query
+    MarketSet
+    matches( const std::string &query ) const;
+
+    // the sorted MarketId::index() of the markets with the token (folded), empty if none
+    std::span<const std::uint16_t>
+    postings( std::string_view token ) const;
+
+    // the number of distinct tokens
+    int
+    size( void ) const { return int(m_tokenStart.size()) - 1; }
+
+    // the folded tokens of a name, in order
+    static std::vector<std::string>
+    tokenise( const std::string &name );
+
+private:
+
+    // the token ids [first, second) a query term matches
+    typedef std::pair<int,int> Term;
+
+    // one alternative of a word, the terms of which must all match e.g. NEW and YORK for "new-york"
+    typedef std::vector<Term> Group;
+
+    // the words of a query, each the alternatives it allows
+    std::vector<std::vector<Group>>
+    parse( const std::string &query ) const;
+
+    MarketSet
+    evaluate( const std::vector<std::vector<Group>> &words ) const;
+
+    // the first token id not less than t
+    int
+    lowerBound( std::string_view t ) const;
+
+    std::string_view
+    token( int t ) const { return std::string_view(m_tokens.data() + m_tokenStart[t], m_tokenStart[t + 1] - m_tokenStart[t]); }
+
+    // the tokens as one block, m_tokenStart has one entry per token plus one
+    std::string                m_tokens;
+    std::vector<std::uint32_t> m_tokenStart;
+
+    // token to markets, CSR (compressed sparse row) by token id
+    std::vector<std::uint32_t> m_postingStart;
+    std::vector<std::uint16_t> m_postings;
+
+    // market to tokens, CSR by MarketId::index()
+    std::vector<std::uint32_t> m_nameStart;
+    std::vector<std::uint16_t> m_names;
+};
+
+
+#endif
+
+
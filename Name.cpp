@@ -74,20 +74,23 @@
 #include "Name.h"
 #endif
 
-#include <iostream>
+#include <algorithm>
+#include <cstring>
 #include <cassert>
 
 
 // https://www.regular-expressions.info
 // https://www.regexlib.com/Default.aspx
-const std::regex Name::m_left_whitespace  = std::regex( R"(^\s*)" );      
-const std::regex Name::m_right_whitespace = std::regex( R"(\s*$)" );
-const std::regex Name::m_left_quotes      = std::regex( R"(^\s*['"])" );  
-const std::regex Name::m_right_quotes     = std::regex( R"(['"]\s*$)" );
-const std::regex Name::m_trail_newlines   = std::regex( R"(\n+$)" );      // trailing newlines '\n'
-
-std::map<std::string, std::string> Name::m_diacritic;
-std::map<std::string, std::string> Name::m_escape;
+Name::Tables&
+Name::tables( void )
+{
+    static Tables t = []() { 
+        Tables retVal;
+        setup(retVal);
+        return retVal;
+    }();
+    return t;
+}
 
 
 
@@ -95,10 +98,10 @@ std::string
 Name::deaccent( std::string str )
 // substitute characters with accents -- slow
 {
-    assert(!m_diacritic.empty());
+    const std::map<std::string, std::string> &diacritic = tables().diacritic;
     
     // const std::map<std::string, std::string>::value_type& c
-    for (auto &c : m_diacritic)
+    for (auto &c : diacritic)
     {
         size_t pos = 0;
         while ((pos = str.find(c.first, pos)) != str.npos)
@@ -127,13 +130,14 @@ std::string
 Name::escape( const std::string &str )
 // escape std::regex special characters 
 {
+    const std::map<std::string, std::string> &escape = tables().escape;
     std::string retVal;
     
     for (char c : str)
     {
         std::string sym(1, c);
-        auto fitr = m_escape.find(sym);
-        retVal += (fitr != m_escape.end()) ? fitr->second : sym;
+        auto fitr = escape.find(sym);
+        retVal += (fitr != escape.end()) ? fitr->second : sym;
     }
 
     return retVal;
@@ -243,7 +247,7 @@ Name::concat( const std::vector<std::string> &strvec, const std::string &delim)
 int
 Name::chomp( std::string &str, const std::string &sym )
 {
-    std::regex exp = (sym.empty()) ? m_trail_newlines : std::regex(Name::escape(sym) + "$");
+    std::regex exp = (sym.empty()) ? tables().trailNewlines : std::regex(Name::escape(sym) + "$");
     
     const int factor = std::max(1, (int) sym.size());
     
@@ -358,8 +362,91 @@ Name::dist(const std::string &str1, const std::string &str2)
     return d[N1][N2];
 }
 
+std::string
+Name::nysiis( const std::string &str )
+// New York State Identification and Intelligence System phonetic code, without the usual truncation to 6 characters
+// https://en.wikipedia.org/wiki/New_York_State_Identification_and_Intelligence_System
+{
+    // letters only, so "Saint-Denis" and "St Denis" differ only as their letters do
+    std::string n;
+    for (char c : toupper(deaccent(str)))
+    {
+        if (c >= 'A' && c <= 'Z')
+            n += c;
+    }
+
+    if (n.empty())
+        return n;
+
+    // transliterated umlauts at the start, Oerlikon for Örlikon (within a name the vowels all code as A anyway)
+    if (n.size() > 2 && n[1] == 'E' && (n[0] == 'A' || n[0] == 'O' || n[0] == 'U'))
+        n.erase(1, 1);
+
+    auto vowel = []( char c ) { return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U'; };
+    auto starts = [&n]( const char *p ) { return n.compare(0, std::strlen(p), p) == 0; };
+    auto ends = [&n]( const char *p ) { const std::size_t k = std::strlen(p); return n.size() >= k && n.compare(n.size() - k, k, p) == 0; };
+
+    if (starts("MAC"))
+        n.replace(0, 3, "MCC");
+    else if (starts("KN"))
+        n.replace(0, 2, "NN");
+    else if (starts("K"))
+        n[0] = 'C';
+    else if (starts("PH") || starts("PF"))
+        n.replace(0, 2, "FF");
+    else if (starts("SCH"))
+        n.replace(0, 3, "SSS");
+
+    if (ends("EE") || ends("IE"))
+        n.replace(n.size() - 2, 2, "Y");
+    else if (ends("DT") || ends("RT") || ends("RD") || ends("NT") || ends("ND"))
+        n.replace(n.size() - 2, 2, "D");
+
+    // each letter after the first is coded in place, so later letters see the codes of earlier ones
+    std::string retVal(1, n[0]);
+    for (std::size_t i = 1; i < n.size(); ++i)
+    {
+        const char next = (i + 1 < n.size()) ? n[i + 1] : '\0';
+
+        if (n[i] == 'E' && next == 'V')
+            n.replace(i, 2, "AF");
+        else if (vowel(n[i]))
+            n[i] = 'A';
+        else if (n[i] == 'Q')
+            n[i] = 'G';
+        else if (n[i] == 'Z')
+            n[i] = 'S';
+        else if (n[i] == 'M')
+            n[i] = 'N';
+        else if (n[i] == 'K' && next == 'N')
+            n[i] = 'N';
+        else if (n[i] == 'K')
+            n[i] = 'C';
+        else if (n.compare(i, 3, "SCH") == 0)
+            n.replace(i, 3, "SSS");
+        else if (n.compare(i, 2, "PH") == 0)
+            n.replace(i, 2, "FF");
+        else if (n[i] == 'H' && (!vowel(n[i - 1]) || (next && !vowel(next))))
+            n[i] = n[i - 1];
+        else if (n[i] == 'W' && vowel(n[i - 1]))
+            n[i] = n[i - 1];
+
+        if (n[i] != retVal.back())
+            retVal += n[i];
+    }
+
+    if (retVal.size() > 1 && retVal.back() == 'S')
+        retVal.pop_back();
+    if (retVal.size() > 2 && retVal.compare(retVal.size() - 2, 2, "AY") == 0)
+        retVal.erase(retVal.size() - 2, 1);
+    if (retVal.size() > 1 && retVal.back() == 'A')
+        retVal.pop_back();
+
+    return retVal;
+}
+
 void
-Name::setup( void )
+Name::setup( Tables &t )
 // countries with alphabets that employ diacritic signs include:
 // AT, BO, BR, CH, CL, CR, DE, DK, FI, FO, FR, HU, IS, KR, MX, NO, PA, PE, PT, SE, SJ, TR and VN. 
 // https://service.unece.org/trade/locode/2024-1%20UNLOCODE%20SecretariatNotes.pdf
@@ -367,30 +454,40 @@ Name::setup( void )
 // https://www.fileformat.info/info/charset/UTF-16/list.htm
 // https://www.fileformat.info/info/unicode/block/latin_extended_additional/images.htm
 {
+    //
+    // patterns used by trim, unquote and chomp
+    //
+    
+    t.leftWhitespace  = std::regex( R"(^\s*)" );      
+    t.rightWhitespace = std::regex( R"(\s*$)" );
+    t.leftQuotes      = std::regex( R"(^\s*['"])" );  
+    t.rightQuotes     = std::regex( R"(['"]\s*$)" );
+    t.trailNewlines   = std::regex( R"(\n+$)" );      // trailing newlines '\n'
+    
     //
     // std::regex special characters
     //
     
-    m_escape["."]  = R"(\.)";
-    m_escape[R"(\)"] = R"(\\)";
-    m_escape["+"]  = R"(\+)";
-    m_escape["*"]  = R"(\*)";
-    m_escape["?"]  = R"(\?)";
-    m_escape["["]  = R"(\[)";
-    m_escape["^"]  = R"(\^)";
-    m_escape["]"]  = R"(\])";
-    m_escape["$"]  = R"(\$)";
-    m_escape["("]  = R"(\()";
-    m_escape[")"]  = R"(\))";
-    m_escape["{"]  = R"(\{)";
-    m_escape["}"]  = R"(\})";
-    m_escape["="]  = R"(\=)";
-    m_escape["!"]  = R"(\!)";
-    m_escape["<"]  = R"(\<)";
-    m_escape[">"]  = R"(\>)";
-    m_escape["|"]  = R"(\|)";
-    m_escape[":"]  = R"(\:)";
-    m_escape["-"]  = R"(\-)";
+    t.escape["."]  = R"(\.)";
+    t.escape[R"(\)"] = R"(\\)";
+    t.escape["+"]  = R"(\+)";
+    t.escape["*"]  = R"(\*)";
+    t.escape["?"]  = R"(\?)";
+    t.escape["["]  = R"(\[)";
+    t.escape["^"]  = R"(\^)";
+    t.escape["]"]  = R"(\])";
+    t.escape["$"]  = R"(\$)";
+    t.escape["("]  = R"(\()";
+    t.escape[")"]  = R"(\))";
+    t.escape["{"]  = R"(\{)";
+    t.escape["}"]  = R"(\})";
+    t.escape["="]  = R"(\=)";
+    t.escape["!"]  = R"(\!)";
+    t.escape["<"]  = R"(\<)";
+    t.escape[">"]  = R"(\>)";
+    t.escape["|"]  = R"(\|)";
+    t.escape[":"]  = R"(\:)";
+    t.escape["-"]  = R"(\-)";
     
     //
     // accents and their replacements
@@ -398,237 +495,237 @@ Name::setup( void )
     
     
     // never use the same character in the accent key and the ascii value
-    // i.e m_diacritic["'"] = R"(\')";
+    // i.e t.diacritic["'"] = R"(\')";
     // this will loop forever as "'" is matched again and again
     
     
     //   NO-BREAK SPACE
-    m_diacritic["\xc2\xa0"]  = " ";
+    t.diacritic["\xc2\xa0"]  = " ";
     
  
     //
     // for latitudes/longitudes of the form DD°MM′SS″DIR or DDD°MM′SS″DIR
     //
-    m_diacritic["°"]  = ":";
-    m_diacritic["′"]  = ":";
-    m_diacritic["″"]  = ":";
+    t.diacritic["°"]  = ":";
+    t.diacritic["′"]  = ":";
+    t.diacritic["″"]  = ":";
     //
     
-    m_diacritic["Æ"] = "A"; // "AE";
-    m_diacritic["æ"] = "a"; // "ae";
+    t.diacritic["Æ"] = "A"; // "AE";
+    t.diacritic["æ"] = "a"; // "ae";
 
-    m_diacritic["Œ"] = "O"; // "OE";
-    m_diacritic["œ"] = "o"; // "oe";
+    t.diacritic["Œ"] = "O"; // "OE";
+    t.diacritic["œ"] = "o"; // "oe";
     
-    m_diacritic["ß"] = "ss";
+    t.diacritic["ß"] = "ss";
     
-    m_diacritic["Þ"] = "Th";
-    m_diacritic["þ"] = "th";
+    t.diacritic["Þ"] = "Th";
+    t.diacritic["þ"] = "th";
  
-    m_diacritic["Ā"] = "A"; // Latin A with macron
-    m_diacritic["Á"] = "A"; // Latin A with acute
-    m_diacritic["À"] = "A"; // Latin A with grave
-    m_diacritic["Ã"] = "A"; // Latin A with tilde
-    m_diacritic["Â"] = "A"; // Latin A with circumflex
-    m_diacritic["Ä"] = "A"; // Latin A with diaeresis
-    m_diacritic["Å"] = "A"; // Latin A with ring above
-    m_diacritic["Ă"] = "A"; // Latin A with breve
-    m_diacritic["Ą"] = "A"; // Latin A with ogonek
-    
-    m_diacritic["Č"] = "C";
-    m_diacritic["Ç"] = "C";
-    
-    m_diacritic["Ḑ"] = "D"; 
-    m_diacritic["Đ"] = "D"; 
-    
-    m_diacritic["É"] = "E"; 
-    m_diacritic["È"] = "E";
-    
-    m_diacritic["Ħ"] = "H"; 
-    m_diacritic["Ḩ"] = "H";
-    
-    m_diacritic["Í"] = "I"; 
-    m_diacritic["Ì"] = "I";
-    m_diacritic["İ"] = "I";  
-    m_diacritic["Ï"] = "I";
-    m_diacritic["Ī"] = "I";
-    m_diacritic["Î"] = "I";
-    
-    m_diacritic["Ñ"] = "N"; 
-    
-    m_diacritic["Ò"] = "O";
-    m_diacritic["Ó"] = "O";
-    m_diacritic["Ô"] = "O";
-    m_diacritic["Õ"] = "O";
-    m_diacritic["Ö"] = "O"; 
-    m_diacritic["Ø"] = "O";
-    
-    m_diacritic["Ķ"] = "K";
-    
-    m_diacritic["Ł"] = "L";
-    
-    m_diacritic["Š"] = "S";
-    m_diacritic["Ş"] = "S"; 
-    m_diacritic["Ś"] = "S"; 
-    m_diacritic["Ș"] = "S";
-    
-    m_diacritic["Ţ"] = "T";
-    m_diacritic["Ť"] = "T";
-    m_diacritic["Ŧ"] = "T";
-    m_diacritic["Ƭ"] = "T";
-    m_diacritic["Ʈ"] = "T";
-    m_diacritic["Ṭ"] = "T";
-    
-    m_diacritic["Ú"] = "U";
-    m_diacritic["Ù"] = "U";
-    m_diacritic["Û"] = "U";
-    m_diacritic["Ü"] = "U";
-    m_diacritic["Ŭ"] = "U";
-    m_diacritic["Ũ"] = "U";
-    m_diacritic["Ů"] = "U";
-    m_diacritic["Ū"] = "U";
-    
-    
-    m_diacritic["Ỳ"] = "Y"; 
-    m_diacritic["Ÿ"] = "Y"; 
-    m_diacritic["Ý"] = "Y"; 
-    
-    
-    m_diacritic["Ż"] = "Z";  
-    m_diacritic["Z̧"] = "Z"; 
-    m_diacritic["Ž"] = "Z";
-    m_diacritic["Ƶ"] = "Z";
-    m_diacritic["Ž"] = "Z";
-    m_diacritic["Ź"] = "Z";
-    m_diacritic["Ȥ"] = "Z";
+    t.diacritic["Ā"] = "A"; // Latin A with macron
+    t.diacritic["Á"] = "A"; // Latin A with acute
+    t.diacritic["À"] = "A"; // Latin A with grave
+    t.diacritic["Ã"] = "A"; // Latin A with tilde
+    t.diacritic["Â"] = "A"; // Latin A with circumflex
+    t.diacritic["Ä"] = "A"; // Latin A with diaeresis
+    t.diacritic["Å"] = "A"; // Latin A with ring above
+    t.diacritic["Ă"] = "A"; // Latin A with breve
+    t.diacritic["Ą"] = "A"; // Latin A with ogonek
+    
+    t.diacritic["Č"] = "C";
+    t.diacritic["Ç"] = "C";
+    
+    t.diacritic["Ḑ"] = "D"; 
+    t.diacritic["Đ"] = "D"; 
+    
+    t.diacritic["É"] = "E"; 
+    t.diacritic["È"] = "E";
+    
+    t.diacritic["Ħ"] = "H"; 
+    t.diacritic["Ḩ"] = "H";
+    
+    t.diacritic["Í"] = "I"; 
+    t.diacritic["Ì"] = "I";
+    t.diacritic["İ"] = "I";  
+    t.diacritic["Ï"] = "I";
+    t.diacritic["Ī"] = "I";
+    t.diacritic["Î"] = "I";
+    
+    t.diacritic["Ñ"] = "N"; 
+    
+    t.diacritic["Ò"] = "O";
+    t.diacritic["Ó"] = "O";
+    t.diacritic["Ô"] = "O";
+    t.diacritic["Õ"] = "O";
+    t.diacritic["Ö"] = "O"; 
+    t.diacritic["Ø"] = "O";
+    
+    t.diacritic["Ķ"] = "K";
+    
+    t.diacritic["Ł"] = "L";
+    
+    t.diacritic["Š"] = "S";
+    t.diacritic["Ş"] = "S"; 
+    t.diacritic["Ś"] = "S"; 
+    t.diacritic["Ș"] = "S";
+    
+    t.diacritic["Ţ"] = "T";
+    t.diacritic["Ť"] = "T";
+    t.diacritic["Ŧ"] = "T";
+    t.diacritic["Ƭ"] = "T";
+    t.diacritic["Ʈ"] = "T";
+    t.diacritic["Ṭ"] = "T";
+    
+    t.diacritic["Ú"] = "U";
+    t.diacritic["Ù"] = "U";
+    t.diacritic["Û"] = "U";
+    t.diacritic["Ü"] = "U";
+    t.diacritic["Ŭ"] = "U";
+    t.diacritic["Ũ"] = "U";
+    t.diacritic["Ů"] = "U";
+    t.diacritic["Ū"] = "U";
+    
+    
+    t.diacritic["Ỳ"] = "Y"; 
+    t.diacritic["Ÿ"] = "Y"; 
+    t.diacritic["Ý"] = "Y"; 
+    
+    
+    t.diacritic["Ż"] = "Z";  
+    t.diacritic["Z̧"] = "Z"; 
+    t.diacritic["Ž"] = "Z";
+    t.diacritic["Ƶ"] = "Z";
+    t.diacritic["Ž"] = "Z";
+    t.diacritic["Ź"] = "Z";
+    t.diacritic["Ȥ"] = "Z";
     
     //
     //
     //
     
-    m_diacritic["à"] = "a";
-    m_diacritic["á"] = "a"; 
-    m_diacritic["â"] = "a";
-    m_diacritic["ã"] = "a";
-    m_diacritic["ä"] = "a";
-    m_diacritic["å"] = "a";
-    m_diacritic["ả"] = "a"; 
-    m_diacritic["ậ"] = "a";
-    m_diacritic["ằ"] = "a"; 
-    m_diacritic["ắ"] = "a"; 
-    m_diacritic["ā"] = "a"; 
-    m_diacritic["ą"] = "a";   
-    m_diacritic["ă"] = "a";
-    m_diacritic["ầ"] = "a";
-    m_diacritic["ẵ"] = "a";
-    m_diacritic["ạ"] = "a";
-    
-    m_diacritic["ç"] = "c"; 
-    m_diacritic["ć"] = "c";
-    m_diacritic["č"] = "c"; 
-    m_diacritic["ċ"] = "c"; 
-    m_diacritic["ĉ"] = "c";
-    m_diacritic["ƈ"] = "c";
-    
-    m_diacritic["ď"] = "d";
-    m_diacritic["ḑ"] = "d";
-    m_diacritic["đ"] = "d";
-    
-    m_diacritic["é"] = "e";   
-    m_diacritic["è"] = "e"; 
-    m_diacritic["ė"] = "e";
-    m_diacritic["ë"] = "e"; 
-    m_diacritic["ế"] = "e";
-    m_diacritic["ề"] = "e";
-    m_diacritic["ě"] = "e";
-    m_diacritic["ê"] = "e";
-    m_diacritic["ệ"] = "e";
-    m_diacritic["ę"] = "e";
-    m_diacritic["ē"] = "e";
-    m_diacritic["ə"] = "e";
-    
-    m_diacritic["ġ"] = "g";
-    m_diacritic["ğ"] = "g"; 
-    m_diacritic["ĝ"] = "g";
-    m_diacritic["ģ"] = "g";
-    
-    m_diacritic["ḩ"] = "h";           
-    m_diacritic["ḥ"] = "h";
-    m_diacritic["ħ"] = "h"; 
-    m_diacritic["ĥ"] = "h";
-    
-    m_diacritic["í"] = "i"; 
-    m_diacritic["ì"] = "i";
-    m_diacritic["ĩ"] = "i";
-    m_diacritic["î"] = "i"; 
-    m_diacritic["ĭ"] = "i";
-    m_diacritic["ī"] = "i";
-    m_diacritic["ı"] = "i";
-    m_diacritic["ï"] = "i";
-    m_diacritic["ị"] = "i";
-
-    m_diacritic["ł"] = "l";
-    
-    m_diacritic["ñ"] = "n";
-    m_diacritic["ň"] = "n";
-    m_diacritic["ń"] = "n";
-    m_diacritic["ņ"] = "n";
-    
-    
-    
-    m_diacritic["ồ"] = "o"; 
-    m_diacritic["ó"] = "o";
-    m_diacritic["ò"] = "o"; 
-    m_diacritic["ö"] = "o";
-    m_diacritic["ǒ"] = "o";     
-    m_diacritic["ô"] = "o";
-    m_diacritic["ð"] = "o"; 
-    m_diacritic["õ"] = "o";
-    m_diacritic["ő"] = "o";
-    m_diacritic["ọ"] = "o";
-    m_diacritic["ơ"] = "o"; 
-    m_diacritic["ō"] = "o";
-    m_diacritic["ộ"] = "o"; 
-    m_diacritic["ớ"] = "o";
-    m_diacritic["ø"] = "o";
-    m_diacritic["ǿ"] = "o";
-    
-    m_diacritic["ṟ"] = "r";
-    m_diacritic["ṙ"] = "r"; 
-    m_diacritic["ř"] = "r";     
-    
-    m_diacritic["š"] = "s"; 
-    m_diacritic["ş"] = "s";
-    m_diacritic["ś"] = "s";
-    m_diacritic["ŝ"] = "s"; 
-    m_diacritic["ș"] = "s";
-    
-    m_diacritic["ţ"] = "t"; 
-    m_diacritic["ț"] = "t";
-    m_diacritic["ṭ"] = "t";
-    
-    m_diacritic["ů"] = "u";
-    m_diacritic["ừ"] = "u"; 
-    m_diacritic["ú"] = "u";
-    m_diacritic["ù"] = "u"; 
-    m_diacritic["ū"] = "u";   
-    m_diacritic["ü"] = "u";
-    m_diacritic["ŭ"] = "u";
-    m_diacritic["ũ"] = "u"; 
-    m_diacritic["û"] = "u";
-    m_diacritic["ư"] = "u";
-    
-    m_diacritic["ý"] = "y";
-    m_diacritic["ỳ"] = "y"; 
-    m_diacritic["ÿ"] = "y";
-    
-    m_diacritic["ż"] = "z"; 
-    m_diacritic["ẕ"] = "z";
-    m_diacritic["ž"] = "z"; 
-    m_diacritic["ź"] = "z"; 
-    m_diacritic["ż"] = "z";
-    m_diacritic["z̧"] = "z";
-    m_diacritic["ƶ"] = "z";
+    t.diacritic["à"] = "a";
+    t.diacritic["á"] = "a"; 
+    t.diacritic["â"] = "a";
+    t.diacritic["ã"] = "a";
+    t.diacritic["ä"] = "a";
+    t.diacritic["å"] = "a";
+    t.diacritic["ả"] = "a"; 
+    t.diacritic["ậ"] = "a";
+    t.diacritic["ằ"] = "a"; 
+    t.diacritic["ắ"] = "a"; 
+    t.diacritic["ā"] = "a"; 
+    t.diacritic["ą"] = "a";   
+    t.diacritic["ă"] = "a";
+    t.diacritic["ầ"] = "a";
+    t.diacritic["ẵ"] = "a";
+    t.diacritic["ạ"] = "a";
+    
+    t.diacritic["ç"] = "c"; 
+    t.diacritic["ć"] = "c";
+    t.diacritic["č"] = "c"; 
+    t.diacritic["ċ"] = "c"; 
+    t.diacritic["ĉ"] = "c";
+    t.diacritic["ƈ"] = "c";
+    
+    t.diacritic["ď"] = "d";
+    t.diacritic["ḑ"] = "d";
+    t.diacritic["đ"] = "d";
+    
+    t.diacritic["é"] = "e";   
+    t.diacritic["è"] = "e"; 
+    t.diacritic["ė"] = "e";
+    t.diacritic["ë"] = "e"; 
+    t.diacritic["ế"] = "e";
+    t.diacritic["ề"] = "e";
+    t.diacritic["ě"] = "e";
+    t.diacritic["ê"] = "e";
+    t.diacritic["ệ"] = "e";
+    t.diacritic["ę"] = "e";
+    t.diacritic["ē"] = "e";
+    t.diacritic["ə"] = "e";
+    
+    t.diacritic["ġ"] = "g";
+    t.diacritic["ğ"] = "g"; 
+    t.diacritic["ĝ"] = "g";
+    t.diacritic["ģ"] = "g";
+    
+    t.diacritic["ḩ"] = "h";           
+    t.diacritic["ḥ"] = "h";
+    t.diacritic["ħ"] = "h"; 
+    t.diacritic["ĥ"] = "h";
+    
+    t.diacritic["í"] = "i"; 
+    t.diacritic["ì"] = "i";
+    t.diacritic["ĩ"] = "i";
+    t.diacritic["î"] = "i"; 
+    t.diacritic["ĭ"] = "i";
+    t.diacritic["ī"] = "i";
+    t.diacritic["ı"] = "i";
+    t.diacritic["ï"] = "i";
+    t.diacritic["ị"] = "i";
+
+    t.diacritic["ł"] = "l";
+    
+    t.diacritic["ñ"] = "n";
+    t.diacritic["ň"] = "n";
+    t.diacritic["ń"] = "n";
+    t.diacritic["ņ"] = "n";
+    
+    
+    
+    t.diacritic["ồ"] = "o"; 
+    t.diacritic["ó"] = "o";
+    t.diacritic["ò"] = "o"; 
+    t.diacritic["ö"] = "o";
+    t.diacritic["ǒ"] = "o";     
+    t.diacritic["ô"] = "o";
+    t.diacritic["ð"] = "o"; 
+    t.diacritic["õ"] = "o";
+    t.diacritic["ő"] = "o";
+    t.diacritic["ọ"] = "o";
+    t.diacritic["ơ"] = "o"; 
+    t.diacritic["ō"] = "o";
+    t.diacritic["ộ"] = "o"; 
+    t.diacritic["ớ"] = "o";
+    t.diacritic["ø"] = "o";
+    t.diacritic["ǿ"] = "o";
+    
+    t.diacritic["ṟ"] = "r";
+    t.diacritic["ṙ"] = "r"; 
+    t.diacritic["ř"] = "r";     
+    
+    t.diacritic["š"] = "s"; 
+    t.diacritic["ş"] = "s";
+    t.diacritic["ś"] = "s";
+    t.diacritic["ŝ"] = "s"; 
+    t.diacritic["ș"] = "s";
+    
+    t.diacritic["ţ"] = "t"; 
+    t.diacritic["ț"] = "t";
+    t.diacritic["ṭ"] = "t";
+    
+    t.diacritic["ů"] = "u";
+    t.diacritic["ừ"] = "u"; 
+    t.diacritic["ú"] = "u";
+    t.diacritic["ù"] = "u"; 
+    t.diacritic["ū"] = "u";   
+    t.diacritic["ü"] = "u";
+    t.diacritic["ŭ"] = "u";
+    t.diacritic["ũ"] = "u"; 
+    t.diacritic["û"] = "u";
+    t.diacritic["ư"] = "u";
+    
+    t.diacritic["ý"] = "y";
+    t.diacritic["ỳ"] = "y"; 
+    t.diacritic["ÿ"] = "y";
+    
+    t.diacritic["ż"] = "z"; 
+    t.diacritic["ẕ"] = "z";
+    t.diacritic["ž"] = "z"; 
+    t.diacritic["ź"] = "z"; 
+    t.diacritic["ż"] = "z";
+    t.diacritic["z̧"] = "z";
+    t.diacritic["ƶ"] = "z";
 }
 
 
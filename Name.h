@@ -43,7 +43,8 @@
  https://www.codetable.net/unicodecharacters
  
  
- Name xxx; // must define at least once for setup()
+ The tables of accents and regex special characters are built on first use, it is no longer necessary to
+ construct a Name before using the static methods.
  
  
  Example 1
@@ -103,7 +104,7 @@ class Name
 
 public:
 
-    Name( void ) { setup(); }
+    Name( void ) { tables(); }
     ~Name( void )=default;
 
     // replace accented characters such as [à] with a Roman or ASCII equivalent [a]
@@ -122,6 +123,11 @@ public:
     // see https://en.wikipedia.org/wiki/Damerau–Levenshtein_distance
     static int
     dist(const std::string &str1, const std::string &str2);
+
+    // NYSIIS phonetic key of the letters of str after deaccent, e.g. "Muenchen" and "München" are both "MANCAN"
+    // names that sound alike (to English ears) share a key; see Locode::soundsLike() and City::soundsLike()
+    static std::string
+    nysiis( const std::string &str );
    
     
     // remove all or first occurence of symbol 'match' 
@@ -179,10 +185,10 @@ public:
     trim( const std::vector<std::string> &strvec );
     
     static std::string 
-    ltrim( const std::string &str ) { return lclip(str, m_left_whitespace); }
+    ltrim( const std::string &str ) { return lclip(str, tables().leftWhitespace); }
     
     static std::string 
-    rtrim( const std::string &str ) { return rclip(str, m_right_whitespace); }
+    rtrim( const std::string &str ) { return rclip(str, tables().rightWhitespace); }
 
     
     // add/remove quote characters ["] ['] -- for more a sophisticated approach see std::quoted
@@ -199,13 +205,13 @@ public:
     unquote( const std::vector<std::string> &strvec, const std::string &sym );
     
     static std::string 
-    unquote( const std::string &str ) { return rclip( lclip(str, m_left_quotes), m_right_quotes ); }
+    unquote( const std::string &str ) { return rclip( lclip(str, tables().leftQuotes), tables().rightQuotes ); }
     
     static std::string 
-    lunquote( const std::string &str ) { return lclip(str, m_left_quotes); }
+    lunquote( const std::string &str ) { return lclip(str, tables().leftQuotes); }
     
     static std::string 
-    runquote( const std::string &str ) { return rclip(str, m_right_quotes); }
+    runquote( const std::string &str ) { return rclip(str, tables().rightQuotes); }
 
 
     // remove symbol or regular expresion from left/right i.e [(] and [)] or [<g] and [/>] 
@@ -245,7 +251,7 @@ public:
     // add/override mappings as you see fit
     // never use the same character in the accent key and the ascii value 
     static void
-    addAccent( const std::string &accent, const std::string &ascii ) { m_diacritic[accent] = ascii; }
+    addAccent( const std::string &accent, const std::string &ascii ) { tables().diacritic[accent] = ascii; }
     
     // escape the std::regex special characters: 
     // . \ + * ? [ ^ ] $ ( ) { } = ! < > | : -
@@ -255,16 +261,24 @@ public:
     
 private:
 
-    static void setup( void );
-    
-    static const std::regex m_left_whitespace;
-    static const std::regex m_right_whitespace;
-    static const std::regex m_left_quotes;
-    static const std::regex m_right_quotes;
-    static const std::regex m_trail_newlines;
+    struct Tables
+    {
+        std::regex leftWhitespace;
+        std::regex rightWhitespace;
+        std::regex leftQuotes;
+        std::regex rightQuotes;
+        std::regex trailNewlines;
+
+        std::map<std::string, std::string> escape;
+        std::map<std::string, std::string> diacritic;
+    };
+
+    // built by setup() on first use, so a program that links but does not use Name pays nothing at startup
+    static Tables&
+    tables( void );
 
-    static std::map<std::string, std::string> m_escape;
-    static std::map<std::string, std::string> m_diacritic;
+    static void 
+    setup( Tables &t );
 
 };
 
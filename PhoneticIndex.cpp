@@ -0,0 +1,65 @@
+/* PhoneticIndex 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   PhoneticIndex.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __PHONETICINDEX_H__
+#include "PhoneticIndex.h"
+#endif
+
+#ifndef __NAME_H__
+#include "Name.h"
+#endif
+
+#include <algorithm>
+#include <cassert>
+
+
+PhoneticIndex::PhoneticIndex( const std::vector<std::string> &names )
+{
+    std::vector<std::pair<std::string, int>> keys;
+    keys.reserve(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        std::string k = Name::nysiis(names[i]);
+        if (!k.empty())
+            keys.emplace_back(std::move(k), int(i));
+    }
+
+    // sorted by key then id, so each key is a run of ids in order
+    std::sort(keys.begin(), keys.end());
+
+    m_ids.reserve(keys.size());
+    m_keys.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); )
+    {
+        std::size_t j = i;
+        while (j < keys.size() && keys[j].first == keys[i].first)
+            m_ids.push_back(keys[j++].second);
+
+        m_keys.emplace(keys[i].first, std::pair<int,int>(int(i), int(j)));
+        i = j;
+    }
+}
+
+std::span<const int>
+PhoneticIndex::find( const std::string &name ) const
+{
+    auto iter = m_keys.find(Name::nysiis(name));
+    if (iter == m_keys.end())
+        return std::span<const int>();
+    return std::span<const int>(m_ids.data() + iter->second.first, m_ids.data() + iter->second.second);
+}
+
+//
+//
+//
+
@@ -0,0 +1,65 @@
+/* PhoneticIndex 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   PhoneticIndex.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ The ids of a table of names grouped by the Name::nysiis() key of their names.
+
+ Name::dist() compares one pair of names at a time and needs a bound on the distance, while transliterations differ by
+ more edits than misspellings do (Muenchen, München, Munchen). A PhoneticIndex maps each key to the ids whose names have
+ it, so the candidates for a name are found by computing its key and one hash probe, and Name::dist() or a closer test
+ need only score those. The ids of a key are a range of one array (CSR), in id order.
+
+ Locode::soundsLike() and City::soundsLike() each keep one over their table, built on first use.
+
+ Example
+
+ PhoneticIndex p({ "", "Muenchen", "Munich", "München" });
+ for (int id : p.find("Munchen"))
+     std::cout << id << std::endl; // 1 and 3
+
+ */
+
+
+#ifndef __PHONETICINDEX_H__
+#define __PHONETICINDEX_H__
+
+#include <string>
+#include <vector>
+#include <span>
+#include <unordered_map>
+#include <utility>
+
+
+
+class PhoneticIndex
+{
+public:
+
+    // names[i] is the name of id i, names with no letters are left out
+    explicit PhoneticIndex( const std::vector<std::string> &names );
+    ~PhoneticIndex( void )=default;
+
+    // the ids whose names have the key of name, in id order
+    std::span<const int>
+    find( const std::string &name ) const;
+
+    // the number of distinct keys
+    int
+    size( void ) const { return int(m_keys.size()); }
+
+private:
+
+    std::unordered_map<std::string, std::pair<int,int>> m_keys; // key to [first, last) of m_ids
+    std::vector<int>                                     m_ids;
+};
+
+
+#endif
+
+
@@ -0,0 +1,145 @@
+/* PositionColumns 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   PositionColumns.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __POSITIONCOLUMNS_H__
+#include "PositionColumns.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+
+PositionColumns::PositionColumns( Table t )
+{
+    if (t == LOCODES)
+    {
+        for (int i = 0; i < LOCODE::NUMLOCODE; ++i)
+        {
+            const Locode c = Locode::index(i);
+            const std::pair<double,double> pos = c.pos();
+            add(pos.first, pos.second, i > 0 && c.valid_pos());
+        }
+    }
+    else
+    {
+        for (int i = 0; i < City::NUMCITY; ++i)
+        {
+            const City c = City::index(i);
+            add(c.lat(), c.lon(), i > 0 && (c.lat() != 0.0 || c.lon() != 0.0));
+        }
+    }
+}
+
+const PositionColumns&
+PositionColumns::locode( void )
+{
+    static const PositionColumns p(LOCODES);
+    return p;
+}
+
+const PositionColumns&
+PositionColumns::city( void )
+{
+    static const PositionColumns p(CITIES);
+    return p;
+}
+
+void
+PositionColumns::add( double lat, double lon, bool valid )
+{
+    const int i = size();
+    if ((i & 63) == 0)
+        m_valid.push_back(0);
+    if (valid)
+        m_valid.back() |= (std::uint64_t(1) << (i & 63));
+
+    m_lat.push_back(std::int32_t(std::lround(lat * SCALE)));
+    m_lon.push_back(std::int32_t(std::lround(lon * SCALE)));
+}
+
+void
+PositionColumns::trig( void ) const
+{
+    std::call_once(m_trigOnce, [this]() {
+        m_sinU.resize(m_lat.size());
+        m_cosU.resize(m_lat.size());
+        for (std::size_t i = 0; i < m_lat.size(); ++i)
+            GeoCoord::reduced(m_lat[i] / SCALE, m_sinU[i], m_cosU[i]);
+    });
+}
+
+double
+PositionColumns::dist( int i, const GeoCoord &p ) const
+{
+    assert(i >= 0 && i < size());
+    if (!valid(i))
+        return -1.0;
+
+    double s, c;
+    GeoCoord::reduced(p.lat(), s, c);
+    return GeoCoord::dist(sinU()[i], cosU()[i], s, c, p.lon() - m_lon[i] / SCALE);
+}
+
+double
+PositionColumns::dist( int i, int j ) const
+{
+    assert(i >= 0 && i < size() && j >= 0 && j < size());
+    if (!valid(i) || !valid(j))
+        return -1.0;
+
+    const double *s = sinU();
+    const double *c = cosU();
+    return GeoCoord::dist(s[i], c[i], s[j], c[j], (m_lon[j] - m_lon[i]) / SCALE);
+}
+
+std::vector<std::pair<int, double>>
+PositionColumns::within( const GeoCoord &p, double metres ) const
+{
+    // a degree of latitude is at least 110.5km, so the band holds every row within range
+    const std::int32_t band = std::int32_t(std::ceil(metres / 110500.0 * SCALE));
+    const std::int32_t lo = std::int32_t(std::lround(p.lat() * SCALE)) - band;
+    const std::int32_t hi = std::int32_t(std::lround(p.lat() * SCALE)) + band;
+
+    double s, c;
+    GeoCoord::reduced(p.lat(), s, c);
+    const double *sinu = sinU();
+    const double *cosu = cosU();
+
+    std::vector<std::pair<int, double>> retVal;
+    for (int i = 0; i < size(); ++i)
+    {
+        if (m_lat[i] < lo || m_lat[i] > hi || !valid(i))
+            continue;
+
+        const double d = GeoCoord::dist(sinu[i], cosu[i], s, c, p.lon() - m_lon[i] / SCALE);
+        if (d >= 0.0 && d <= metres)
+            retVal.emplace_back(i, d);
+    }
+
+    std::stable_sort(retVal.begin(), retVal.end(), []( const auto &a, const auto &b ) { return a.second < b.second; });
+    return retVal;
+}
+
+//
+//
+//
+
@@ -0,0 +1,124 @@
+/* PositionColumns 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   PositionColumns.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ The Locode and City positions as columns for scans and distance kernels.
+
+ The tables hold float[N][2] in degrees, and GeoCoord::dist() works out the reduced latitude, atan((1 - f) tan(lat)), and its
+ sine and cosine for both points on every call. Here each table has, by dense index,
+
+ lat, lon   - int32 fixed point in units of 1e-5 degrees (about 1.1m), separate columns so a latitude band filter reads
+              only the latitudes
+ valid      - a bitmap, bit i set if row i has a position (Locode::valid_pos(), for City a position other than 0,0)
+ sinU, cosU - the sine and cosine of the reduced latitude as doubles, built on the first distance call
+
+ so dist() costs one reduced latitude for the query point and the Vincenty iteration, and within() filters by latitude
+ band on the integers before computing any distance. The columns are built on first use from the compiled tables and are
+ read only afterwards, so they may be used from any number of threads. The compiled tables are not changed.
+
+ Example
+
+ const PositionColumns &p = PositionColumns::locode();
+
+ // UN/LOCODEs within 20km of the City of London, nearest first
+ for (auto [i, metres] : p.within(GeoCoord(51.5155, -0.0922), 20000.0))
+     std::cout << Locode::index(i).name() << " " << metres << std::endl;
+
+ */
+
+
+#ifndef __POSITIONCOLUMNS_H__
+#define __POSITIONCOLUMNS_H__
+
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <cstdint>
+
+
+#ifndef __GEOCOORD_H__
+#include "GeoCoord.h"
+#endif
+
+
+
+class PositionColumns
+{
+public:
+
+    // fixed point units per degree
+    static constexpr double SCALE = 1e5;
+
+    static const PositionColumns&
+    locode( void );
+
+    static const PositionColumns&
+    city( void );
+
+    ~PositionColumns( void )=default;
+
+    int
+    size( void ) const { return int(m_lat.size()); }
+
+    // in units of 1e-5 degrees
+    const std::int32_t*
+    lat( void ) const { return m_lat.data(); }
+
+    const std::int32_t*
+    lon( void ) const { return m_lon.data(); }
+
+    bool
+    valid( int i ) const { return (m_valid[i >> 6] >> (i & 63)) & 1u; }
+
+    GeoCoord
+    pos( int i ) const { return GeoCoord(m_lat[i] / SCALE, m_lon[i] / SCALE); }
+
+    // the reduced latitude columns, built on first call
+    const double*
+    sinU( void ) const { trig(); return m_sinU.data(); }
+
+    const double*
+    cosU( void ) const { trig(); return m_cosU.data(); }
+
+    // metres from row i to p and between rows i and j, -1 if a row has no position (or Vincenty fails to converge)
+    double
+    dist( int i, const GeoCoord &p ) const;
+
+    double
+    dist( int i, int j ) const;
+
+    // (row, metres) for the rows with a position within metres of p, nearest first
+    std::vector<std::pair<int, double>>
+    within( const GeoCoord &p, double metres ) const;
+
+private:
+
+    enum Table { LOCODES, CITIES };
+
+    explicit PositionColumns( Table t );
+
+    void
+    add( double lat, double lon, bool valid );
+
+    void
+    trig( void ) const;
+
+    std::vector<std::int32_t>   m_lat;
+    std::vector<std::int32_t>   m_lon;
+    std::vector<std::uint64_t>  m_valid;
+
+    mutable std::once_flag      m_trigOnce;
+    mutable std::vector<double> m_sinU;
+    mutable std::vector<double> m_cosU;
+};
+
+
+#endif
+
+
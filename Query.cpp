@@ -0,0 +1,259 @@
+/* Query 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   Query.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A predicate is compiled bottom up. Each leaf is one of the Gazetteer masks, either a CountrySet or a CitySet,
+ which is lifted to the set type of the query; the inner nodes are then just bitset and, or and difference.
+ A subtree of only city level attributes is compiled over the cities and lifted once, so && and ! apply to the
+ same city; lifting each leaf would make Q::city == City::MAN && Q::capital true of GBR.
+
+ */
+
+
+#ifndef __QUERY_H__
+#include "Query.h"
+#endif
+
+#include <array>
+#include <type_traits>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <cassert>
+
+
+namespace
+{
+
+constinit const Gazetteer g;
+
+// city level masks, built once on first use
+struct CityTables
+{
+    CitySet                               capitals;
+    std::array<MarketSet, City::NUMCITY>  cty2mics;
+    std::array<Country, City::NUMCITY>    cty2cid;
+};
+
+const CityTables&
+cityTables( void )
+{
+    static const CityTables *tables = []() {
+        CityTables *t = new CityTables();
+
+        for (int i = 1; i < City::NUMCITY; ++i)
+        {
+            const City cty = City::index(i);
+
+            if (cty.capital())
+                t->capitals.set(i);
+
+            for (const MarketId &mic : g.markets(cty))
+            {
+                // some cities have no markets at the moment
+                if (mic != MarketId::XXXX && mic != MarketId::XXX0)
+                    t->cty2mics[i].insert(mic);
+            }
+
+            t->cty2cid[i] = g.country(cty);
+        }
+
+        return t;
+    }();
+
+    return *tables;
+}
+
+//
+// lift a country or city level mask to the set type of the query
+//
+template <typename T> typename Query<T>::Set lift( const CountrySet &cids );
+template <typename T> typename Query<T>::Set lift( const CitySet &ctys );
+
+template <>
+CountrySet
+lift<Country>( const CountrySet &cids ) { return cids; }
+
+template <>
+CitySet
+lift<City>( const CountrySet &cids ) { return g.citySet(cids); }
+
+template <>
+MarketSet
+lift<MarketId>( const CountrySet &cids ) { return g.marketSet(cids); }
+
+template <>
+CountrySet
+lift<Country>( const CitySet &ctys )
+{
+    const CityTables &t = cityTables();
+
+    CountrySet retVal;
+    ctys.forEach([&retVal, &t](const City &cty) { retVal.insert(t.cty2cid[City::index(cty)]); });
+    return retVal;
+}
+
+template <>
+CitySet
+lift<City>( const CitySet &ctys ) { return ctys; }
+
+template <>
+MarketSet
+lift<MarketId>( const CitySet &ctys )
+{
+    const CityTables &t = cityTables();
+
+    MarketSet retVal;
+    ctys.forEach([&retVal, &t](const City &cty) { retVal |= t.cty2mics[City::index(cty)]; });
+    return retVal;
+}
+
+// true if p refers only to city level attributes
+bool
+cityLevel( const Predicate &p )
+{
+    switch (p.op())
+    {
+        case Predicate::CITY:
+        case Predicate::CAPITAL: return true; break;
+        case Predicate::NOT:     return cityLevel(p.lhs()); break;
+        case Predicate::AND:
+        case Predicate::OR:      return cityLevel(p.lhs()) && cityLevel(p.rhs()); break;
+        default:                 return false; break;
+    }
+}
+
+template <typename T>
+struct Cache
+{
+    std::shared_mutex                                              mutex;
+    std::unordered_map<std::string, typename Query<T>::Set>        map;
+};
+
+template <typename T>
+Cache<T>&
+cache( void )
+{
+    static Cache<T> c;
+    return c;
+}
+
+} // namespace
+
+
+//
+// Predicate
+//
+std::string
+Predicate::shape( void ) const
+{
+    switch (m_op)
+    {
+        case ALL:       return "all"; break;
+        case REGION:    return "region=" + std::to_string(m_value); break;
+        case SUBREGION: return "subregion=" + std::to_string(m_value); break;
+        case CURRENCY:  return "ccy=" + std::to_string(m_value); break;
+        case COUNTRY:   return "country=" + std::to_string(m_value); break;
+        case CITY:      return "city=" + std::to_string(m_value); break;
+        case CAPITAL:   return "capital"; break;
+        case NOT:       return "!" + m_lhs->shape(); break;
+        case AND:       return "(" + m_lhs->shape() + "&" + m_rhs->shape() + ")"; break;
+        case OR:        return "(" + m_lhs->shape() + "|" + m_rhs->shape() + ")"; break;
+        default:        assert(false); return ""; break;
+    }
+}
+
+
+//
+// Query
+//
+template <typename T>
+const typename Query<T>::Set&
+Query<T>::universe( void )
+{
+    static const Set u = lift<T>(CountrySet::all());
+    return u;
+}
+
+template <typename T>
+typename Query<T>::Set
+Query<T>::compile( const Predicate &p )
+{
+    if constexpr (!std::is_same_v<T, City>)
+    {
+        if (cityLevel(p))
+            return lift<T>(Query<City>::compile(p));
+    }
+
+    switch (p.op())
+    {
+        case Predicate::ALL:       return universe(); break;
+        case Predicate::REGION:    return lift<T>(g.countrySet(Gazetteer::Region(p.value()))); break;
+        case Predicate::SUBREGION: return lift<T>(g.countrySet(Gazetteer::Subregion(p.value()))); break;
+        case Predicate::CURRENCY:  return lift<T>(g.countrySet(Currency(Currency::CurrencyCode(p.value())))); break;
+        case Predicate::COUNTRY:
+        {
+            CountrySet cids;
+            cids.insert(Country(Country::CountryCode(p.value())));
+            return lift<T>(cids);
+        }
+        case Predicate::CITY:
+        {
+            CitySet ctys;
+            ctys.insert(City(City::CityCode(p.value())));
+            return lift<T>(ctys);
+        }
+        case Predicate::CAPITAL:   return lift<T>(cityTables().capitals); break;
+        case Predicate::NOT:       return universe() - compile(p.lhs()); break;
+        case Predicate::AND:       return compile(p.lhs()) & compile(p.rhs()); break;
+        case Predicate::OR:        return compile(p.lhs()) | compile(p.rhs()); break;
+        default:                   assert(false); return Set(); break;
+    }
+}
+
+template <typename T>
+typename Query<T>::Set
+Query<T>::where( const Predicate &p ) const
+{
+    Cache<T> &c = cache<T>();
+    const std::string key = p.shape();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(c.mutex);
+        auto iter = c.map.find(key);
+        if (iter != c.map.end())
+            return iter->second;
+    }
+
+    // compile outside the lock, a racing thread computes the same answer
+    Set s = compile(p);
+
+    std::unique_lock<std::shared_mutex> lock(c.mutex);
+    if (c.map.size() >= MAXCACHE)
+        c.map.clear();
+    c.map.emplace(key, s);
+    return s;
+}
+
+template <typename T>
+int
+Query<T>::cacheSize( void )
+{
+    Cache<T> &c = cache<T>();
+    std::shared_lock<std::shared_mutex> lock(c.mutex);
+    return int(c.map.size());
+}
+
+
+template class Query<Country>;
+template class Query<City>;
+template class Query<MarketId>;
+
+//
+//
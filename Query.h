@@ -0,0 +1,218 @@
+/* Query 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$
+ $   Query.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A small query language over the Gazetteer attributes of countries, cities and markets.
+
+ A Predicate is built from the attributes in Q, compared with ==, != and combined with &&, || and !.
+ Query<T>::where() compiles the predicate into set operations over the precomputed Gazetteer masks
+ (see EntitySet.h) and returns the answer as a CountrySet, CitySet or MarketSet.
+
+ Attributes
+
+ Q::region    == Gazetteer::Region
+ Q::subregion == Gazetteer::Subregion
+ Q::ccy       == Currency    - the main/principal currency of the country
+ Q::country   == Country
+ Q::city      == City
+ Q::capital                  - the city is a capital city
+
+ Country level attributes apply to a city or market through its country, city level attributes apply to a market
+ through its city and to a country if any of its cities match.
+
+ Results are cached by the shape of the query i.e. the predicate, with its values, printed in canonical form, so a
+ repeated query costs a hash lookup. The cache is shared by all threads; readers do not block each other. It holds
+ at most Query<T>::MAXCACHE shapes and is emptied when full.
+
+ Example
+
+ // all markets whose country is in Europe, whose currency is not EUR and whose city is a capital
+ MarketSet m = Query<MarketId>().where(Q::region == Gazetteer::EUROPE && Q::ccy != Currency::EUR && Q::capital);
+
+ for (MarketId mic : m.toVector())
+     std::cout << mic << " " << mic.name() << " " << g.city(mic).name() << std::endl;
+
+ std::cout << Query<Country>().shape(Q::subregion == Gazetteer::CARIBBEAN || Q::ccy == Currency::XCD) << std::endl;
+
+ */
+
+
+#ifndef __QUERY_H__
+#define __QUERY_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __ENTITYSET_H__
+#include "EntitySet.h"
+#endif
+
+
+
+class Predicate
+{
+public:
+
+    enum Op : char { ALL = 0, REGION, SUBREGION, CURRENCY, COUNTRY, CITY, CAPITAL, NOT, AND, OR };
+
+    Predicate( void ): m_op(ALL), m_value(0), m_lhs(), m_rhs() {}
+    Predicate( Op op, short value ): m_op(op), m_value(value), m_lhs(), m_rhs() {}
+    Predicate( Op op, const Predicate &lhs ): m_op(op), m_value(0), m_lhs(std::make_shared<const Predicate>(lhs)), m_rhs() {}
+    Predicate( Op op, const Predicate &lhs, const Predicate &rhs ): m_op(op), m_value(0), m_lhs(std::make_shared<const Predicate>(lhs)), m_rhs(std::make_shared<const Predicate>(rhs)) {}
+    ~Predicate( void )=default;
+
+    Op
+    op( void ) const { return m_op; }
+
+    short
+    value( void ) const { return m_value; }
+
+    const Predicate&
+    lhs( void ) const { return *m_lhs; }
+
+    const Predicate&
+    rhs( void ) const { return *m_rhs; }
+
+    // canonical form e.g. "(region=6&!ccy=978)" - equal shapes give equal results
+    std::string
+    shape( void ) const;
+
+private:
+
+    Op                               m_op;
+    short                            m_value;
+    std::shared_ptr<const Predicate> m_lhs;
+    std::shared_ptr<const Predicate> m_rhs;
+};
+
+inline Predicate
+operator!( const Predicate &p ) { return Predicate(Predicate::NOT, p); }
+
+inline Predicate
+operator&&( const Predicate &lhs, const Predicate &rhs ) { return Predicate(Predicate::AND, lhs, rhs); }
+
+inline Predicate
+operator||( const Predicate &lhs, const Predicate &rhs ) { return Predicate(Predicate::OR, lhs, rhs); }
+
+
+//
+// attributes
+//
+class Q
+{
+public:
+
+    struct RegionAttr
+    {
+        Predicate operator==( Gazetteer::Region r ) const { return Predicate(Predicate::REGION, r); }
+        Predicate operator!=( Gazetteer::Region r ) const { return !(*this == r); }
+    };
+
+    struct SubregionAttr
+    {
+        Predicate operator==( Gazetteer::Subregion r ) const { return Predicate(Predicate::SUBREGION, r); }
+        Predicate operator!=( Gazetteer::Subregion r ) const { return !(*this == r); }
+    };
+
+    struct CurrencyAttr
+    {
+        Predicate operator==( const Currency &c ) const { return Predicate(Predicate::CURRENCY, short(c)); }
+        Predicate operator!=( const Currency &c ) const { return !(*this == c); }
+    };
+
+    struct CountryAttr
+    {
+        Predicate operator==( const Country &c ) const { return Predicate(Predicate::COUNTRY, short(c)); }
+        Predicate operator!=( const Country &c ) const { return !(*this == c); }
+    };
+
+    struct CityAttr
+    {
+        Predicate operator==( const City &c ) const { return Predicate(Predicate::CITY, short(c)); }
+        Predicate operator!=( const City &c ) const { return !(*this == c); }
+    };
+
+    struct CapitalAttr
+    {
+        operator Predicate( void ) const { return Predicate(Predicate::CAPITAL, 1); }
+    };
+
+    static constexpr RegionAttr    region{};
+    static constexpr SubregionAttr subregion{};
+    static constexpr CurrencyAttr  ccy{};
+    static constexpr CountryAttr   country{};
+    static constexpr CityAttr      city{};
+    static constexpr CapitalAttr   capital{};
+
+private:
+
+    Q( void )=delete;
+};
+
+inline Predicate
+operator!( const Q::CapitalAttr &c ) { return !Predicate(c); }
+
+
+template <typename T> struct QuerySet;
+template <> struct QuerySet<Country>  { typedef CountrySet Type; };
+template <> struct QuerySet<City>     { typedef CitySet Type; };
+template <> struct QuerySet<MarketId> { typedef MarketSet Type; };
+
+
+template <typename T>
+class Query
+{
+public:
+
+    typedef typename QuerySet<T>::Type Set;
+
+    static constexpr std::size_t MAXCACHE = 4096;
+
+    Query( void )=default;
+    ~Query( void )=default;
+
+    // the members of T satisfying p
+    Set
+    where( const Predicate &p ) const;
+
+    std::vector<T>
+    select( const Predicate &p ) const { return where(p).toVector(); }
+
+    int
+    count( const Predicate &p ) const { return where(p).count(); }
+
+    std::string
+    shape( const Predicate &p ) const { return p.shape(); }
+
+    // every member of T that has a country i.e. the complement of a query is taken with respect to this set
+    static const Set&
+    universe( void );
+
+    // number of distinct query shapes cached for T
+    static int
+    cacheSize( void );
+
+private:
+
+    template <typename> friend class Query;
+
+    static Set
+    compile( const Predicate &p );
+};
+
+
+#endif
+
+
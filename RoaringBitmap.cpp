@@ -0,0 +1,327 @@
+/* RoaringBitmap 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   RoaringBitmap.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __ROARINGBITMAP_H__
+#include "RoaringBitmap.h"
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+
+
+namespace
+{
+
+constexpr std::size_t WORDS = 65536 / 64;
+
+} // namespace
+
+
+//
+// containers
+//
+bool
+RoaringBitmap::Container::contains( std::uint16_t v ) const
+{
+    if (bitmap())
+        return (bits[v >> 6] >> (v & 63)) & 1;
+    return std::binary_search(array.begin(), array.end(), v);
+}
+
+void
+RoaringBitmap::Container::add( std::uint16_t v )
+{
+    if (bitmap())
+    {
+        std::uint64_t &w = bits[v >> 6];
+        const std::uint64_t b = std::uint64_t(1) << (v & 63);
+        cardinality += !(w & b);
+        w |= b;
+        return;
+    }
+
+    if (array.empty() || array.back() < v)
+        array.push_back(v);
+    else
+    {
+        auto iter = std::lower_bound(array.begin(), array.end(), v);
+        if (*iter == v)
+            return;
+        array.insert(iter, v);
+    }
+    ++cardinality;
+    normalise();
+}
+
+void
+RoaringBitmap::Container::normalise( void )
+{
+    if (!bitmap() && cardinality > MAXARRAY)
+    {
+        bits.assign(WORDS, 0);
+        for (std::uint16_t v : array)
+            bits[v >> 6] |= std::uint64_t(1) << (v & 63);
+        array = std::vector<std::uint16_t>();
+    }
+    else if (bitmap() && cardinality <= MAXARRAY)
+    {
+        array.clear();
+        array.reserve(cardinality);
+        for (std::size_t w = 0; w < WORDS; ++w)
+        {
+            for (std::uint64_t word = bits[w]; word; word &= word - 1)
+                array.push_back(std::uint16_t(w * 64 + std::countr_zero(word)));
+        }
+        bits = std::vector<std::uint64_t>();
+    }
+}
+
+RoaringBitmap::Container
+RoaringBitmap::intersect( const Container &a, const Container &b )
+{
+    Container retVal;
+    retVal.key = a.key;
+
+    if (a.bitmap() && b.bitmap())
+    {
+        retVal.bits.resize(WORDS);
+        for (std::size_t w = 0; w < WORDS; ++w)
+        {
+            retVal.bits[w] = a.bits[w] & b.bits[w];
+            retVal.cardinality += std::popcount(retVal.bits[w]);
+        }
+    }
+    else if (a.bitmap() || b.bitmap())
+    {
+        const Container &arr = (a.bitmap()) ? b : a;
+        const Container &bmp = (a.bitmap()) ? a : b;
+        for (std::uint16_t v : arr.array)
+        {
+            if (bmp.contains(v))
+                retVal.array.push_back(v);
+        }
+        retVal.cardinality = int(retVal.array.size());
+    }
+    else if (a.array.size() * 8 < b.array.size() || b.array.size() * 8 < a.array.size())
+    {
+        // a small set against a large one, e.g. a country against a function, search for each value of the small one
+        const Container &small = (a.array.size() < b.array.size()) ? a : b;
+        const Container &large = (a.array.size() < b.array.size()) ? b : a;
+        auto from = large.array.begin();
+        for (std::uint16_t v : small.array)
+        {
+            from = std::lower_bound(from, large.array.end(), v);
+            if (from == large.array.end())
+                break;
+            if (*from == v)
+                retVal.array.push_back(v);
+        }
+        retVal.cardinality = int(retVal.array.size());
+    }
+    else
+    {
+        std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(retVal.array));
+        retVal.cardinality = int(retVal.array.size());
+    }
+
+    retVal.normalise();
+    return retVal;
+}
+
+RoaringBitmap::Container
+RoaringBitmap::unite( const Container &a, const Container &b )
+{
+    Container retVal;
+    retVal.key = a.key;
+
+    if (a.bitmap() || b.bitmap())
+    {
+        retVal.bits.assign(WORDS, 0);
+        for (const Container *c : { &a, &b })
+        {
+            if (c->bitmap())
+            {
+                for (std::size_t w = 0; w < WORDS; ++w)
+                    retVal.bits[w] |= c->bits[w];
+            }
+            else
+            {
+                for (std::uint16_t v : c->array)
+                    retVal.bits[v >> 6] |= std::uint64_t(1) << (v & 63);
+            }
+        }
+        for (std::uint64_t w : retVal.bits)
+            retVal.cardinality += std::popcount(w);
+    }
+    else
+    {
+        std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(retVal.array));
+        retVal.cardinality = int(retVal.array.size());
+    }
+
+    retVal.normalise();
+    return retVal;
+}
+
+//
+// the bitmap
+//
+RoaringBitmap
+RoaringBitmap::range( std::uint32_t first, std::uint32_t last )
+{
+    RoaringBitmap retVal;
+    for (std::uint64_t v = first; v < last; )
+    {
+        // the part of [first, last) in the container holding v
+        Container c;
+        c.key = std::uint16_t(v >> 16);
+        const std::uint64_t end = std::min<std::uint64_t>(last, (std::uint64_t(c.key) + 1) << 16);
+        c.cardinality = int(end - v);
+
+        if (c.cardinality > MAXARRAY)
+        {
+            c.bits.assign(WORDS, 0);
+            for (std::uint64_t i = v; i < end; ++i)
+                c.bits[(i & 0xFFFF) >> 6] |= std::uint64_t(1) << (i & 63);
+        }
+        else
+        {
+            c.array.reserve(c.cardinality);
+            for (std::uint64_t i = v; i < end; ++i)
+                c.array.push_back(std::uint16_t(i));
+        }
+
+        retVal.m_containers.push_back(std::move(c));
+        v = end;
+    }
+    return retVal;
+}
+
+void
+RoaringBitmap::add( std::uint32_t v )
+{
+    const std::uint16_t key = std::uint16_t(v >> 16);
+
+    auto iter = m_containers.end();
+    if (m_containers.empty() || m_containers.back().key < key)
+        iter = m_containers.insert(iter, Container());
+    else if (m_containers.back().key != key)
+    {
+        iter = std::lower_bound(m_containers.begin(), m_containers.end(), key, []( const Container &c, std::uint16_t k ) { return c.key < k; });
+        if (iter->key != key)
+            iter = m_containers.insert(iter, Container());
+    }
+    else
+        --iter;
+
+    iter->key = key;
+    iter->add(std::uint16_t(v));
+}
+
+bool
+RoaringBitmap::contains( std::uint32_t v ) const
+{
+    const std::uint16_t key = std::uint16_t(v >> 16);
+    auto iter = std::lower_bound(m_containers.begin(), m_containers.end(), key, []( const Container &c, std::uint16_t k ) { return c.key < k; });
+    return iter != m_containers.end() && iter->key == key && iter->contains(std::uint16_t(v));
+}
+
+std::uint64_t
+RoaringBitmap::count( void ) const
+{
+    std::uint64_t retVal = 0;
+    for (const Container &c : m_containers)
+        retVal += c.cardinality;
+    return retVal;
+}
+
+RoaringBitmap
+RoaringBitmap::operator&( const RoaringBitmap &b ) const
+{
+    RoaringBitmap retVal;
+    auto i = m_containers.begin();
+    auto j = b.m_containers.begin();
+    while (i != m_containers.end() && j != b.m_containers.end())
+    {
+        if (i->key < j->key)
+            ++i;
+        else if (j->key < i->key)
+            ++j;
+        else
+        {
+            Container c = intersect(*i++, *j++);
+            if (c.cardinality)
+                retVal.m_containers.push_back(std::move(c));
+        }
+    }
+    return retVal;
+}
+
+RoaringBitmap
+RoaringBitmap::operator|( const RoaringBitmap &b ) const
+{
+    RoaringBitmap retVal;
+    auto i = m_containers.begin();
+    auto j = b.m_containers.begin();
+    while (i != m_containers.end() || j != b.m_containers.end())
+    {
+        if (j == b.m_containers.end() || (i != m_containers.end() && i->key < j->key))
+            retVal.m_containers.push_back(*i++);
+        else if (i == m_containers.end() || j->key < i->key)
+            retVal.m_containers.push_back(*j++);
+        else
+            retVal.m_containers.push_back(unite(*i++, *j++));
+    }
+    return retVal;
+}
+
+bool
+RoaringBitmap::operator==( const RoaringBitmap &b ) const
+{
+    // containers are normalised, so equal sets have equal containers
+    if (m_containers.size() != b.m_containers.size())
+        return false;
+
+    for (std::size_t i = 0; i < m_containers.size(); ++i)
+    {
+        const Container &x = m_containers[i];
+        const Container &y = b.m_containers[i];
+        if (x.key != y.key || x.cardinality != y.cardinality || x.array != y.array || x.bits != y.bits)
+            return false;
+    }
+    return true;
+}
+
+std::vector<std::uint32_t>
+RoaringBitmap::values( void ) const
+{
+    std::vector<std::uint32_t> retVal;
+    retVal.reserve(count());
+    forEach([&retVal]( std::uint32_t v ) { retVal.push_back(v); });
+    return retVal;
+}
+
+std::size_t
+RoaringBitmap::bytes( void ) const
+{
+    std::size_t retVal = m_containers.capacity() * sizeof(Container);
+    for (const Container &c : m_containers)
+        retVal += c.array.capacity() * sizeof(std::uint16_t) + c.bits.capacity() * sizeof(std::uint64_t);
+    return retVal;
+}
+
+//
+//
+//
+
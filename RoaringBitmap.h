@@ -0,0 +1,160 @@
+/* RoaringBitmap 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   RoaringBitmap.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A compressed set of 32 bit integers, after Roaring (Chambi, Lemire, Kaser and Godin, "Better bitmap performance with
+ Roaring bitmaps", 2016).
+
+ The values are split by their high 16 bits into containers, kept sorted by key. A container holding at most 4096 values
+ is a sorted array of their low 16 bits (2 bytes a value), a fuller one is a bitmap of 65536 bits (8KB), so a sparse set
+ costs little more than its values and a dense one one bit a value. Intersections and unions work container by container:
+ array with array by merging, array with bitmap by probing and bitmap with bitmap a word at a time, and the result is
+ converted back to an array when it falls to 4096 values. count() sums the container cardinalities, which are kept.
+
+ Example
+
+ RoaringBitmap a = RoaringBitmap::range(100, 200); // [100, 200)
+ RoaringBitmap b;
+ b.add(150);
+ b.add(70000);
+
+ RoaringBitmap c = a & b;                          // { 150 }
+ std::cout << (a | b).count() << " " << c.contains(150) << std::endl;
+
+ c.forEach([]( std::uint32_t v ) { std::cout << v << std::endl; });
+
+ */
+
+
+#ifndef __ROARINGBITMAP_H__
+#define __ROARINGBITMAP_H__
+
+#include <vector>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+
+
+class RoaringBitmap
+{
+public:
+
+    // the most values a container holds as an array
+    static constexpr int MAXARRAY = 4096;
+
+    RoaringBitmap( void )=default;
+    ~RoaringBitmap( void )=default;
+
+    // the values in [first, last)
+    static RoaringBitmap
+    range( std::uint32_t first, std::uint32_t last );
+
+    // in any order, adding values in increasing order is fastest
+    void
+    add( std::uint32_t v );
+
+    bool
+    contains( std::uint32_t v ) const;
+
+    // the number of values
+    std::uint64_t
+    count( void ) const;
+
+    bool
+    empty( void ) const { return m_containers.empty(); }
+
+    RoaringBitmap
+    operator&( const RoaringBitmap &b ) const;
+
+    RoaringBitmap
+    operator|( const RoaringBitmap &b ) const;
+
+    RoaringBitmap&
+    operator&=( const RoaringBitmap &b ) { return *this = *this & b; }
+
+    RoaringBitmap&
+    operator|=( const RoaringBitmap &b ) { return *this = *this | b; }
+
+    bool
+    operator==( const RoaringBitmap &b ) const;
+
+    // the values in increasing order
+    std::vector<std::uint32_t>
+    values( void ) const;
+
+    // f(std::uint32_t) for each value in increasing order
+    template <typename F>
+    void
+    forEach( F f ) const;
+
+    // the bytes held by the containers
+    std::size_t
+    bytes( void ) const;
+
+private:
+
+    struct Container
+    {
+        std::uint16_t              key         = 0;
+        int                        cardinality = 0;
+        std::vector<std::uint16_t> array;  // sorted, if bits is empty
+        std::vector<std::uint64_t> bits;   // 1024 words, if a bitmap
+
+        bool
+        bitmap( void ) const { return !bits.empty(); }
+
+        bool
+        contains( std::uint16_t v ) const;
+
+        void
+        add( std::uint16_t v );
+
+        // array to bitmap when over MAXARRAY values, bitmap to array when at or under
+        void
+        normalise( void );
+    };
+
+    static Container
+    intersect( const Container &a, const Container &b );
+
+    static Container
+    unite( const Container &a, const Container &b );
+
+    std::vector<Container> m_containers; // sorted by key
+};
+
+
+template <typename F>
+void
+RoaringBitmap::forEach( F f ) const
+{
+    for (const Container &c : m_containers)
+    {
+        const std::uint32_t high = std::uint32_t(c.key) << 16;
+        if (c.bitmap())
+        {
+            for (std::size_t w = 0; w < c.bits.size(); ++w)
+            {
+                for (std::uint64_t word = c.bits[w]; word; word &= word - 1)
+                    f(high | std::uint32_t(w * 64 + std::countr_zero(word)));
+            }
+        }
+        else
+        {
+            for (std::uint16_t low : c.array)
+                f(high | low);
+        }
+    }
+}
+
+
+#endif
+
+
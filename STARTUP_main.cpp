@@ -0,0 +1,154 @@
+/* Startup Benchmark 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   STARTUP_main.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Measures the time from exec to the first lookup, the cost paid by every short lived job that links the library.
+
+ Usage:  startup [-n runs]
+
+ Without -n the program does one typical lookup (a MIC to its city, country and currency, and a UN/LOCODE) and prints it.
+ With -n the program starts itself runs times. The parent takes the clock just before each posix_spawn and passes it
+ to the child, which takes the clock again after its first lookup, so the figure covers exec, dynamic loading, static
+ initialisation and the lookup itself but not exit. The minimum, median and mean over all runs are printed in microseconds.
+
+ The library has no dynamic initialisers (see Name and GeoCoord), so the time should be close to that of an empty program.
+
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+
+extern char **environ;
+
+
+static long long
+now( void )
+{
+    // steady_clock is CLOCK_MONOTONIC on Linux, which is shared by all processes
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string
+lookup( void )
+{
+    Gazetteer g;
+    const MarketId mic("XLON");
+    const City cty = g.city(mic);
+    const Locode loc("GBLON");
+
+    return mic.to4Code() + " " + cty.to3Code() + " " + g.country(mic).to3Code() + " " + g.ccy(mic).to3Code() + " " + loc.name();
+}
+
+// the time of one child from spawn to first lookup in nanoseconds, -1 on failure
+static long long
+spawn( const char *self )
+{
+    int fd[2];
+    if (pipe(fd) != 0)
+        return -1;
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fd[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, fd[0]);
+
+    const std::string start = std::to_string(now());
+    const char *args[] = { self, "-t", start.c_str(), nullptr };
+
+    pid_t pid;
+    const int err = posix_spawn(&pid, self, &actions, nullptr, const_cast<char* const*>(args), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fd[1]);
+
+    long long retVal = -1;
+    if (err == 0)
+    {
+        char buffer[64] = { 0 };
+        const ssize_t n = read(fd[0], buffer, sizeof(buffer) - 1);
+        if (n > 0)
+            retVal = std::atoll(buffer);
+
+        int status;
+        waitpid(pid, &status, 0);
+    }
+    close(fd[0]);
+
+    return retVal;
+}
+
+
+int
+main( int argc, const char *argv[] )
+{
+    // child: report the time since the parent spawned us
+    if (argc == 3 && !std::strcmp(argv[1], "-t"))
+    {
+        const long long start = std::atoll(argv[2]);
+        const std::string s = lookup();
+        const long long end = now();
+        std::printf("%lld %zu\n", end - start, s.size());
+        return EXIT_SUCCESS;
+    }
+
+    if (argc == 1)
+    {
+        std::cout << lookup() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const int runs = (argc == 3 && !std::strcmp(argv[1], "-n")) ? std::atoi(argv[2]) : 0;
+    if (runs <= 0)
+    {
+        std::cerr << "usage: " << argv[0] << " [-n runs]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<long long> times;
+    times.reserve(runs);
+    for (int i = 0; i < runs; ++i)
+    {
+        const long long t = spawn(argv[0]);
+        if (t < 0)
+        {
+            std::cerr << "cannot run " << argv[0] << std::endl;
+            return EXIT_FAILURE;
+        }
+        times.push_back(t);
+    }
+
+    std::sort(times.begin(), times.end());
+    long long sum = 0;
+    for (long long t : times)
+        sum += t;
+
+    std::printf("exec to first lookup over %d runs: min %.1fus, median %.1fus, mean %.1fus\n", runs,
+                times.front() / 1000.0, times[times.size() / 2] / 1000.0, sum / 1000.0 / runs);
+
+    return EXIT_SUCCESS;
+}
+
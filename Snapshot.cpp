@@ -0,0 +1,432 @@
+/* Snapshot 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Snapshot.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Both load() and fromCompiled() produce the four tables as records of strings, i.e. the contents of the CSV files,
+ and share build() to turn them into rows, so a saved snapshot always loads back to the same thing.
+
+ Reclamation is by Epoch: publish() swaps the pointer before it advances the epoch and a Reader takes its Epoch::Guard
+ before it loads the pointer, so a retired snapshot is freed once its epoch is <= Epoch::oldest().
+
+ */
+
+
+#ifndef __SNAPSHOT_H__
+#include "Snapshot.h"
+#endif
+
+#ifndef __GAZETTEER_H__
+#include "Gazetteer.h"
+#endif
+
+#ifndef __CSV_H__
+#include "Csv.h"
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+
+
+namespace
+{
+
+typedef std::vector<std::vector<std::string>> Records;
+
+enum Table { CURRENCIES = 0, COUNTRIES, CITIES, MARKETS, MAXTABLE };
+
+const char * const s_files[MAXTABLE] = { "currencies.csv", "countries.csv", "cities.csv", "markets.csv" };
+
+const char * const s_headers[MAXTABLE] = {
+    "code,iso,name",
+    "code2,code3,iso,name,ccy,capital,region,subregion",
+    "locode,code3,name,country,capital,lat,lon",
+    "mic,name,city"
+};
+
+const std::size_t s_fields[MAXTABLE] = { 3, 8, 7, 3 };
+
+//
+// CSV
+//
+std::string
+quote( const std::string &s )
+{
+    if (s.find_first_of(",\"") == std::string::npos)
+        return s;
+
+    std::string retVal = "\"";
+    for (char c : s)
+    {
+        if (c == '"')
+            retVal += '"';
+        retVal += c;
+    }
+    return retVal + '"';
+}
+
+bool
+readRecords( const std::string &path, std::size_t fields, Records &recs )
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+
+    std::string line;
+    if (!std::getline(in, line)) // header
+        return false;
+
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line == "\r")
+            continue;
+
+        recs.push_back(Csv::split(line));
+        if (recs.back().size() != fields)
+            return false;
+    }
+
+    return true;
+}
+
+bool
+writeRecords( const std::string &path, const char *header, const Records &recs )
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    out << header << '\n';
+    for (const std::vector<std::string> &r : recs)
+    {
+        for (std::size_t i = 0; i < r.size(); ++i)
+            out << ((i) ? "," : "") << quote(r[i]);
+        out << '\n';
+    }
+
+    return bool(out);
+}
+
+std::string
+toString( float x )
+{
+    // enough digits to read back the same float
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", x);
+    return buffer;
+}
+
+bool
+toInt( const std::string &s, long &x )
+{
+    if (s.empty())
+        return false;
+    char *end = nullptr;
+    x = std::strtol(s.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+bool
+toFloat( const std::string &s, float &x )
+{
+    if (s.empty())
+        return false;
+    char *end = nullptr;
+    x = std::strtof(s.c_str(), &end);
+    return *end == '\0';
+}
+
+//
+// publication state
+//
+constinit std::atomic<const Snapshot*>  s_current{nullptr};
+
+constinit std::mutex                    s_writer; // serialises publish() and reclaim()
+constinit std::uint64_t                 s_generation = 0;
+
+// snapshots waiting for their readers to finish, (epoch, snapshot), built on first use
+std::vector<std::pair<std::uint64_t, const Snapshot*>>&
+retired( void )
+{
+    static std::vector<std::pair<std::uint64_t, const Snapshot*>> r;
+    return r;
+}
+
+int
+reclaimLocked( void )
+{
+    const std::uint64_t oldest = Epoch::oldest();
+
+    std::vector<std::pair<std::uint64_t, const Snapshot*>> &r = retired();
+
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < r.size(); ++i)
+    {
+        if (r[i].first <= oldest)
+            delete r[i].second;
+        else r[j++] = r[i];
+    }
+    r.resize(j);
+
+    return int(j);
+}
+
+} // namespace
+
+
+//
+// construction
+//
+std::unique_ptr<Snapshot>
+Snapshot::fromCompiled( void )
+{
+    Gazetteer g;
+    Records recs[MAXTABLE];
+
+    // some historic currencies share an ISO number (e.g. CHC and CHW) and so appear twice in index() order
+    std::vector<bool> seen(Currency::MAXCURRENCY, false);
+    for (int i = 1; i < Currency::NUMCURRENCY; ++i)
+    {
+        const Currency c = Currency::index(i);
+        if (!seen[short(c)])
+            recs[CURRENCIES].push_back({ c.to3Code(), std::to_string(short(c)), c.name() });
+        seen[short(c)] = true;
+    }
+
+    for (int i = 1; i < Country::NUMCOUNTRY; ++i)
+    {
+        const Country c = Country::index(i);
+        const City cap = g.capital(c);
+        recs[COUNTRIES].push_back({ c.to2Code(), c.to3Code(), std::to_string(short(c)), c.name(),
+                                    g.ccy(c).valid() ? g.ccy(c).to3Code() : "",
+                                    cap.valid() ? cap.locode() : "",
+                                    std::to_string(int(g.region(c))), std::to_string(int(g.subregion(c))) });
+    }
+
+    for (int i = 1; i < City::NUMCITY; ++i)
+    {
+        const City c = City::index(i);
+        const Country cid = g.country(c);
+        recs[CITIES].push_back({ c.locode(), c.to3Code(), c.name(), cid.valid() ? cid.to3Code() : "",
+                                 c.capital() ? "1" : "0", toString(c.lat()), toString(c.lon()) });
+    }
+
+    for (int i = 1; i < MarketId::NUMMARKETID; ++i)
+    {
+        const MarketId m = MarketId::index(i);
+        const City c = g.city(m);
+        recs[MARKETS].push_back({ m.to4Code(), m.name(), c.valid() ? c.locode() : "" });
+    }
+
+    return build(recs);
+}
+
+std::unique_ptr<Snapshot>
+Snapshot::load( const std::string &dir )
+{
+    Records recs[MAXTABLE];
+
+    for (int t = 0; t < MAXTABLE; ++t)
+    {
+        if (!readRecords(dir + "/" + s_files[t], s_fields[t], recs[t]))
+            return nullptr;
+    }
+
+    return build(recs);
+}
+
+bool
+Snapshot::save( const std::string &dir ) const
+{
+    Records recs[MAXTABLE];
+
+    auto code = [](const auto *r, auto get) { return (r) ? std::string(get(*r)) : std::string(); };
+
+    for (const CurrencyRow &r : m_ccys)
+        recs[CURRENCIES].push_back({ r.code, std::to_string(r.iso), r.name });
+
+    for (const CountryRow &r : m_countries)
+        recs[COUNTRIES].push_back({ r.code2, r.code3, std::to_string(r.iso), r.name,
+                                    code(ccy(r), [](const CurrencyRow &x) { return x.code; }),
+                                    code(capital(r), [](const CityRow &x) { return x.locode; }),
+                                    std::to_string(int(r.region)), std::to_string(int(r.subregion)) });
+
+    for (const CityRow &r : m_cities)
+        recs[CITIES].push_back({ r.locode, r.code3, r.name, code(country(r), [](const CountryRow &x) { return x.code3; }),
+                                 r.capital ? "1" : "0", toString(r.lat), toString(r.lon) });
+
+    for (const MarketRow &r : m_markets)
+        recs[MARKETS].push_back({ r.mic, r.name, code(city(r), [](const CityRow &x) { return x.locode; }) });
+
+    for (int t = 0; t < MAXTABLE; ++t)
+    {
+        if (!writeRecords(dir + "/" + s_files[t], s_headers[t], recs[t]))
+            return false;
+    }
+
+    return true;
+}
+
+std::unique_ptr<Snapshot>
+Snapshot::build( const std::vector<std::vector<std::string>> *recs )
+{
+    std::unique_ptr<Snapshot> s(new Snapshot());
+    long x = 0;
+
+    for (const std::vector<std::string> &r : recs[CURRENCIES])
+    {
+        if (!toInt(r[1], x))
+            return nullptr;
+        s->m_ccys.push_back({ r[0], short(x), r[2] });
+    }
+
+    for (const std::vector<std::string> &r : recs[COUNTRIES])
+    {
+        long reg = 0, subreg = 0;
+        if (!toInt(r[2], x) || !toInt(r[6], reg) || !toInt(r[7], subreg))
+            return nullptr;
+        s->m_countries.push_back({ r[0], r[1], short(x), r[3], -1, -1, (unsigned char) reg, (unsigned char) subreg });
+    }
+
+    for (const std::vector<std::string> &r : recs[CITIES])
+    {
+        CityRow c{ r[0], r[1], r[2], -1, r[4] == "1", 0.0f, 0.0f };
+        if (!toFloat(r[5], c.lat) || !toFloat(r[6], c.lon))
+            return nullptr;
+        s->m_cities.push_back(c);
+    }
+
+    for (const std::vector<std::string> &r : recs[MARKETS])
+        s->m_markets.push_back({ r[0], r[1], -1 });
+
+    if (!s->buildIndexes())
+        return nullptr;
+
+    // relations, an empty field is no relation but an unknown code is an error
+    auto resolve = [](const Index &idx, const std::string &code, int &i) {
+        if (code.empty())
+            return true;
+        auto iter = idx.find(code);
+        if (iter == idx.end())
+            return false;
+        i = iter->second;
+        return true;
+    };
+
+    for (std::size_t i = 0; i < s->m_countries.size(); ++i)
+    {
+        if (!resolve(s->m_ccyIndex, recs[COUNTRIES][i][4], s->m_countries[i].ccy) ||
+            !resolve(s->m_cityIndex, recs[COUNTRIES][i][5], s->m_countries[i].capital))
+            return nullptr;
+    }
+
+    for (std::size_t i = 0; i < s->m_cities.size(); ++i)
+    {
+        if (!resolve(s->m_countryIndex, recs[CITIES][i][3], s->m_cities[i].country))
+            return nullptr;
+    }
+
+    for (std::size_t i = 0; i < s->m_markets.size(); ++i)
+    {
+        if (!resolve(s->m_cityIndex, recs[MARKETS][i][2], s->m_markets[i].city))
+            return nullptr;
+    }
+
+    return s;
+}
+
+bool
+Snapshot::buildIndexes( void )
+// the primary codes must be unique, the secondary codes (ISO 2 letter country codes, IATA city codes) need not be
+{
+    for (std::size_t i = 0; i < m_ccys.size(); ++i)
+    {
+        if (!m_ccyIndex.emplace(m_ccys[i].code, int(i)).second)
+            return false;
+    }
+
+    for (std::size_t i = 0; i < m_countries.size(); ++i)
+    {
+        if (!m_countryIndex.emplace(m_countries[i].code3, int(i)).second)
+            return false;
+    }
+    for (std::size_t i = 0; i < m_countries.size(); ++i)
+        m_countryIndex.emplace(m_countries[i].code2, int(i));
+
+    for (std::size_t i = 0; i < m_cities.size(); ++i)
+    {
+        if (!m_cityIndex.emplace(m_cities[i].locode, int(i)).second)
+            return false;
+    }
+    for (std::size_t i = 0; i < m_cities.size(); ++i)
+        m_cityIndex.emplace(m_cities[i].code3, int(i));
+
+    for (std::size_t i = 0; i < m_markets.size(); ++i)
+    {
+        if (!m_marketIndex.emplace(m_markets[i].mic, int(i)).second)
+            return false;
+    }
+
+    return true;
+}
+
+
+//
+// publication
+//
+void
+Snapshot::publish( std::unique_ptr<Snapshot> s )
+{
+    assert(s);
+
+    std::lock_guard<std::mutex> lock(s_writer);
+
+    s->m_generation = ++s_generation;
+    const Snapshot *old = s_current.exchange(s.release());
+    const std::uint64_t e = Epoch::advance();
+
+    if (old)
+        retired().emplace_back(e, old);
+
+    reclaimLocked();
+}
+
+int
+Snapshot::reclaim( void )
+{
+    std::lock_guard<std::mutex> lock(s_writer);
+    return reclaimLocked();
+}
+
+const Snapshot*
+Snapshot::current( void )
+{
+    const Snapshot *s = s_current.load();
+    if (s)
+        return s;
+
+    // the first reader publishes the compiled tables
+    static std::once_flag once;
+    std::call_once(once, []() {
+        if (!s_current.load())
+            publish(fromCompiled());
+    });
+
+    return s_current.load();
+}
+
+Snapshot::Reader::Reader( void ): m_guard(), m_snapshot(current())
+{
+}
+
+//
+//
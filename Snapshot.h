@@ -0,0 +1,267 @@
+/* Snapshot 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Snapshot.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A runtime loaded copy of the Country, Currency, MarketId and City tables together with the Gazetteer relations.
+
+ The compiled in classes are fixed when the program is built, but ISO 10383 is republished monthly. A Snapshot holds the
+ same reference data as plain rows loaded from a directory of CSV files, so a long running process can pick up a new
+ MIC list without being rebuilt or restarted. Rows refer to each other by row number; -1 means no relation.
+
+ Files (one header line, comma separated, fields containing commas are double quoted)
+
+ currencies.csv : code,iso,name
+ countries.csv  : code2,code3,iso,name,ccy,capital,region,subregion   - ccy is a currency code, capital a LOCODE
+ cities.csv     : locode,code3,name,country,capital,lat,lon            - country is an ISO 3 letter code
+ markets.csv    : mic,name,city                                        - city is a LOCODE
+
+ Snapshot::fromCompiled() builds a snapshot from the compiled tables and save() writes it out, which gives the starting point
+ for an update i.e. edit markets.csv, load() and publish().
+
+ Publication
+
+ There is a single current snapshot. Readers take a Snapshot::Reader, which pins the current snapshot for its lifetime,
+ and never lock or wait. publish() swaps the current pointer atomically; the old snapshot is retired and deleted once every
+ reader that could have seen it has finished. Reclamation is by Epoch (see Epoch.h), so a Reader holds an Epoch::Guard.
+ Writers are serialised by a mutex which readers never touch.
+
+ Keep Readers short lived (one request, one batch) as a Reader that is never released keeps every later snapshot alive.
+ Up to MAXREADER threads read through a slot of their own; threads beyond that read through a shared counter, which is
+ as safe but holds back all reclamation while any of them is reading.
+
+ Example
+
+ // writer, e.g. a monthly reload
+ std::unique_ptr<Snapshot> s = Snapshot::load("/data/refdata/2026-10");
+ if (s)
+     Snapshot::publish(std::move(s));
+
+ // readers, any thread
+ {
+     Snapshot::Reader r;
+     const Snapshot::MarketRow *m = r->market("XLON");
+     if (m)
+         std::cout << m->name << " " << r->city(*m)->name << " " << r->ccy(*m)->code << " generation " << r->generation() << std::endl;
+ }
+
+ */
+
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+
+#ifndef __EPOCH_H__
+#include "Epoch.h"
+#endif
+
+
+class Snapshot
+{
+public:
+
+    static constexpr int MAXREADER = Epoch::MAXREADER;
+
+    struct CurrencyRow
+    {
+        std::string code;     // e.g. "GBP"
+        short       iso;      // e.g. 826
+        std::string name;
+    };
+
+    struct CountryRow
+    {
+        std::string   code2;  // e.g. "GB"
+        std::string   code3;  // e.g. "GBR"
+        short         iso;
+        std::string   name;
+        int           ccy;    // row in currencies()
+        int           capital;// row in cities()
+        unsigned char region; // Gazetteer::Region
+        unsigned char subregion;
+    };
+
+    struct CityRow
+    {
+        std::string locode;   // e.g. "GBLON"
+        std::string code3;    // e.g. "LON"
+        std::string name;
+        int         country;  // row in countries()
+        bool        capital;
+        float       lat;
+        float       lon;
+    };
+
+    struct MarketRow
+    {
+        std::string mic;      // e.g. "XLON"
+        std::string name;
+        int         city;     // row in cities()
+    };
+
+    //
+    // construction
+    //
+    static std::unique_ptr<Snapshot>
+    fromCompiled( void );
+
+    // empty on failure i.e. a missing file, a malformed row or a dangling relation
+    static std::unique_ptr<Snapshot>
+    load( const std::string &dir );
+
+    bool
+    save( const std::string &dir ) const;
+
+    //
+    // publication
+    //
+    class Reader
+    {
+    public:
+
+        Reader( void );
+        ~Reader( void )=default;
+
+        Reader( const Reader& )=delete;
+        Reader&
+        operator=( const Reader& )=delete;
+
+        const Snapshot*
+        operator->( void ) const { return m_snapshot; }
+
+        const Snapshot&
+        operator*( void ) const { return *m_snapshot; }
+
+    private:
+
+        Epoch::Guard    m_guard;    // taken before the snapshot is loaded
+        const Snapshot *m_snapshot;
+    };
+
+    // make s the current snapshot; readers that already hold the old snapshot keep it until they finish
+    static void
+    publish( std::unique_ptr<Snapshot> s );
+
+    // free retired snapshots no longer visible to any reader, returns the number still waiting
+    static int
+    reclaim( void );
+
+    // increases by one with each publish(), the snapshot built from the compiled tables is generation 1
+    std::uint64_t
+    generation( void ) const { return m_generation; }
+
+    //
+    // lookups by code, null if unknown
+    //
+    const CurrencyRow*
+    ccy( std::string_view code ) const { return find(m_ccys, m_ccyIndex, code); }
+
+    const CountryRow* // ISO 2 or 3 letter code
+    country( std::string_view code ) const { return find(m_countries, m_countryIndex, code); }
+
+    const CityRow* // LOCODE or IATA 3 letter code
+    city( std::string_view code ) const { return find(m_cities, m_cityIndex, code); }
+
+    const MarketRow*
+    market( std::string_view mic ) const { return find(m_markets, m_marketIndex, mic); }
+
+    //
+    // relations, null if none
+    //
+    const CityRow*
+    city( const MarketRow &m ) const { return row(m_cities, m.city); }
+
+    const CountryRow*
+    country( const CityRow &c ) const { return row(m_countries, c.country); }
+
+    const CountryRow*
+    country( const MarketRow &m ) const { const CityRow *c = city(m); return (c) ? country(*c) : nullptr; }
+
+    const CurrencyRow*
+    ccy( const CountryRow &c ) const { return row(m_ccys, c.ccy); }
+
+    const CurrencyRow*
+    ccy( const MarketRow &m ) const { const CountryRow *c = country(m); return (c) ? ccy(*c) : nullptr; }
+
+    const CityRow*
+    capital( const CountryRow &c ) const { return row(m_cities, c.capital); }
+
+    //
+    // tables
+    //
+    const std::vector<CurrencyRow>&
+    currencies( void ) const { return m_ccys; }
+
+    const std::vector<CountryRow>&
+    countries( void ) const { return m_countries; }
+
+    const std::vector<CityRow>&
+    cities( void ) const { return m_cities; }
+
+    const std::vector<MarketRow>&
+    markets( void ) const { return m_markets; }
+
+private:
+
+    Snapshot( void ): m_generation(0) {}
+
+    struct Hash
+    {
+        using is_transparent = void;
+        std::size_t operator()( std::string_view s ) const { return std::hash<std::string_view>()(s); }
+    };
+
+    typedef std::unordered_map<std::string, int, Hash, std::equal_to<>> Index;
+
+    template <typename R>
+    static const R*
+    row( const std::vector<R> &v, int i ) { return (i >= 0 && i < int(v.size())) ? &v[i] : nullptr; }
+
+    template <typename R>
+    static const R*
+    find( const std::vector<R> &v, const Index &idx, std::string_view code )
+    {
+        auto iter = idx.find(code);
+        return (iter != idx.end()) ? &v[iter->second] : nullptr;
+    }
+
+    // from the contents of the four files, in the order currencies, countries, cities, markets
+    static std::unique_ptr<Snapshot>
+    build( const std::vector<std::vector<std::string>> *recs );
+
+    bool
+    buildIndexes( void );
+
+    static const Snapshot*
+    current( void );
+
+    std::uint64_t            m_generation;
+
+    std::vector<CurrencyRow> m_ccys;
+    std::vector<CountryRow>  m_countries;
+    std::vector<CityRow>     m_cities;
+    std::vector<MarketRow>   m_markets;
+
+    Index                    m_ccyIndex;
+    Index                    m_countryIndex;
+    Index                    m_cityIndex;
+    Index                    m_marketIndex;
+};
+
+
+#endif
+
+
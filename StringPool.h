@@ -0,0 +1,123 @@
+/* StringPool 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   StringPool.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A table of strings held as one block of characters and an array of 32 bit offsets into it.
+
+ The string tables (codes, names, subdivisions and time zones) used to be arrays of const char*. In a position independent
+ build every one of those pointers needs a relocation when the library is loaded, some 100k of them with the Locode
+ tables, and the loader writes each one, so the pages holding the tables become private to every process that maps them.
+ A StringPool has no pointers into the block other than its own two, so the tables stay in shared, read only pages and
+ load time does not depend on their size.
+
+ The block is built at compile time from the same list of literals the pointer arrays were initialised with:
+
+     constexpr const char * const s_names[N] = { "No City", "Aalborg", ... };      // never emitted
+     constexpr auto s_namesBlock = makeStringBlock<stringBlockSize(s_names)>(s_names);
+     constexpr StringPool City::m_fullNames(s_namesBlock);
+
+ Each string is NUL terminated in the block, so operator[] returns a const char* just as the array did and code indexing
+ the table is unchanged. A null entry in the list stays null.
+
+ */
+
+
+#ifndef __STRINGPOOL_H__
+#define __STRINGPOOL_H__
+
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+
+
+template <std::size_t C, std::size_t N>
+struct StringBlock
+{
+    char          chars[C];
+    std::uint32_t offsets[N + 1];
+};
+
+
+class StringPool
+{
+public:
+
+    // the offset of a null entry
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+
+    constexpr StringPool( void ): m_chars(""), m_offsets(nullptr) {}
+    constexpr StringPool( const char *chars, const std::uint32_t *offsets ): m_chars(chars), m_offsets(offsets) {}
+
+    template <std::size_t C, std::size_t N>
+    constexpr StringPool( const StringBlock<C, N> &b ): m_chars(b.chars), m_offsets(b.offsets) {}
+
+    constexpr const char*
+    operator[]( int i ) const { return (m_offsets[i] == NONE) ? nullptr : m_chars + m_offsets[i]; }
+
+    // without the NUL, empty for a null entry
+    constexpr std::string_view
+    view( int i ) const { return (m_offsets[i] == NONE) ? std::string_view() : std::string_view(m_chars + m_offsets[i]); }
+
+    constexpr const char*
+    chars( void ) const { return m_chars; }
+
+    constexpr const std::uint32_t*
+    offsets( void ) const { return m_offsets; }
+
+private:
+
+    const char          *m_chars;
+    const std::uint32_t *m_offsets;
+};
+
+
+// the number of characters in the block for a list of literals, including a NUL for each
+template <std::size_t N>
+consteval std::size_t
+stringBlockSize( const char * const (&s)[N] )
+{
+    std::size_t retVal = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (s[i])
+            retVal += std::string_view(s[i]).size() + 1;
+    }
+    return (retVal) ? retVal : 1;
+}
+
+template <std::size_t C, std::size_t N>
+consteval StringBlock<C, N>
+makeStringBlock( const char * const (&s)[N] )
+{
+    StringBlock<C, N> retVal{};
+
+    std::uint32_t k = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (!s[i])
+        {
+            retVal.offsets[i] = StringPool::NONE;
+            continue;
+        }
+
+        retVal.offsets[i] = k;
+        for (const char *p = s[i]; *p; ++p)
+            retVal.chars[k++] = *p;
+        retVal.chars[k++] = '\0';
+    }
+    retVal.offsets[N] = k;
+
+    return retVal;
+}
+
+
+#endif
+
+
@@ -0,0 +1,178 @@
+/* Subdivision 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Subdivision.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ */
+
+
+#ifndef __SUBDIVISION_H__
+#include "Subdivision.h"
+#endif
+
+#ifndef __CITY_H__
+#include "City.h"
+#endif
+
+#ifndef __LOCODE_H__
+#include "Locode.h"
+#endif
+
+#include <ostream>
+#include <map>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+
+
+Subdivision::Subdivision( const Country &c, std::string_view code ): m_id(NOSUBDIVISION)
+{
+    if (!c.valid() || code.empty() || code.size() > 3)
+        return;
+
+    // the entries are in the order of the ISO 3166-2 codes, which is the order of their keys
+    const std::uint64_t k = key(c.to2Code(), code);
+    const std::vector<Entry> &e = tables().entries;
+    auto iter = std::lower_bound(e.begin() + 1, e.end(), k, []( const Entry &x, std::uint64_t k ) { return x.key < k; });
+
+    if (iter != e.end() && iter->key == k)
+        m_id = int(iter - e.begin());
+}
+
+Subdivision::Subdivision( std::string_view s ): m_id(NOSUBDIVISION)
+{
+    if (s.size() > 3 && s[2] == '-')
+        *this = Subdivision(Country(std::string(s.substr(0, 2))), s.substr(3));
+}
+
+Country
+Subdivision::country( void ) const
+{
+    return Country::CountryCode(tables().entries[m_id].cid);
+}
+
+std::string
+Subdivision::code( void ) const
+{
+    return (m_id) ? tables().entries[m_id].code : "XXX";
+}
+
+std::string
+Subdivision::toString( void ) const
+{
+    return (m_id) ? country().to2Code() + "-" + code() : std::string();
+}
+
+int
+Subdivision::size( void )
+{
+    return int(tables().entries.size());
+}
+
+Subdivision
+Subdivision::index( int i )
+{
+    assert(i >= 0 && i < size());
+    Subdivision retVal;
+    retVal.m_id = i;
+    return retVal;
+}
+
+Subdivision
+Subdivision::of( const City &c )
+{
+    return index(tables().city[City::index(c)]);
+}
+
+Subdivision
+Subdivision::of( const Locode &l )
+{
+    return index(tables().locode[Locode::index(l)]);
+}
+
+std::uint64_t
+Subdivision::key( std::string_view country, std::string_view code )
+{
+    // the characters big endian and NUL padded, so keys order as the strings "GB-LND" do
+    assert(country.size() == 2 && code.size() <= 3);
+    std::uint64_t retVal = 0;
+    for (int i = 0; i < 5; ++i)
+    {
+        const char c = (i < 2) ? country[i] : (i - 2 < int(code.size())) ? code[i - 2] : 0;
+        retVal = (retVal << 8) | (unsigned char) c;
+    }
+    return retVal;
+}
+
+const Subdivision::Tables&
+Subdivision::tables( void )
+{
+    static const Tables t = []() {
+        Tables retVal;
+
+        // the key of each City and Locode, 0 for none; the country of both is that of its UN/LOCODE
+        std::vector<std::uint64_t> city(City::NUMCITY, 0), locode(LOCODE::NUMLOCODE, 0);
+        std::map<std::uint64_t, Entry> codes;
+
+        auto add = []( std::map<std::uint64_t, Entry> &codes, const std::string &cc, const std::string &sd ) {
+            const Country c(cc);
+            if (!c.valid() || sd == "XXX" || sd.empty() || sd.size() > 3)
+                return std::uint64_t(0);
+
+            Entry e{ key(cc, sd), short(c), { 0, 0, 0, 0 } };
+            std::memcpy(e.code, sd.data(), sd.size());
+            codes.emplace(e.key, e);
+            return e.key;
+        };
+
+        for (int i = 1; i < City::NUMCITY; ++i)
+        {
+            const City c = City::index(i);
+            city[i] = add(codes, c.locode().substr(0, 2), c.subdiv());
+        }
+
+        for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+        {
+            const Locode l = Locode::index(i);
+            locode[i] = add(codes, l.country(), l.subdiv());
+        }
+
+        // ids in the order of the codes
+        std::map<std::uint64_t, int> ids;
+        retVal.entries.push_back(Entry{ 0, Country::NOCOUNTRY, { 0, 0, 0, 0 } });
+        for (const auto &c : codes)
+        {
+            ids[c.first] = int(retVal.entries.size());
+            retVal.entries.push_back(c.second);
+        }
+
+        retVal.city.resize(City::NUMCITY, NOSUBDIVISION);
+        for (int i = 1; i < City::NUMCITY; ++i)
+            retVal.city[i] = (city[i]) ? ids[city[i]] : NOSUBDIVISION;
+
+        retVal.locode.resize(LOCODE::NUMLOCODE, NOSUBDIVISION);
+        for (int i = 1; i < LOCODE::NUMLOCODE; ++i)
+            retVal.locode[i] = (locode[i]) ? ids[locode[i]] : NOSUBDIVISION;
+
+        return retVal;
+    }();
+    return t;
+}
+
+
+std::ostream&
+operator<<( std::ostream &ostr, const Subdivision &s )
+{
+    ostr << s.toString();
+    return ostr;
+}
+
+//
+//
+//
+
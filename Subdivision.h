@@ -0,0 +1,151 @@
+/* Subdivision 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   Subdivision.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ An ISO 3166-2 country subdivision (a state, province, county, etc) as a dense id.
+
+ City and Locode carry the subdivision part of the ISO 3166-2 code as up to 3 characters, "XXX" if they have none, and the
+ code is only unique within its country ("CA" is California in the US and Cádiz in Spain). A Subdivision is a
+ (country, code) pair interned into an id in [1, size()), in the order of the ISO 3166-2 codes "AD-02" to "ZW-MW", with
+ 0 (NOSUBDIVISION) for none. The ids are dense, so a report grouping millions of rows by state or province can sum into
+ a std::vector indexed by Subdivision::index() rather than a map keyed by strings.
+
+ The subdivisions are those used by the compiled City and Locode tables, collected on first use together with the
+ subdivision of every City and Locode, so of() and City::subdivision() and Locode::subdivision() are array lookups.
+ Gazetteer::cities(), locodes() and markets() give the members of a subdivision.
+
+ Example
+
+ Subdivision ca(Country::US, "CA");
+ Subdivision on("CA-ON");
+
+ std::cout << ca << " " << ca.country().name() << " " << Subdivision::index(ca) << std::endl;
+ std::cout << City(City::YYZ).subdivision() << " " << (City(City::YYZ).subdivision() == on) << std::endl;
+
+ std::vector<double> exposure(Subdivision::size(), 0.0);
+ for (const Trade &t : trades)
+     exposure[Subdivision::index(t.city.subdivision())] += t.notional;
+
+ */
+
+
+#ifndef __SUBDIVISION_H__
+#define __SUBDIVISION_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <compare>
+#include <cstdint>
+#include <iosfwd>
+
+
+#ifndef __COUNTRY_H__
+#include "Country.h"
+#endif
+
+
+class City;
+class Locode;
+
+
+class Subdivision
+{
+public:
+
+    static constexpr int NOSUBDIVISION = 0;
+
+    Subdivision( void ): m_id(NOSUBDIVISION) {}
+    ~Subdivision( void )=default;
+
+    // e.g. (Country::US, "CA"), NOSUBDIVISION if the pair is not known
+    Subdivision( const Country &c, std::string_view code );
+
+    // the ISO 3166-2 code e.g. "US-CA"
+    explicit Subdivision( std::string_view s );
+
+    Country
+    country( void ) const;
+
+    // the subdivision part e.g. "CA", "XXX" for NOSUBDIVISION (as City and Locode)
+    std::string
+    code( void ) const;
+
+    // the ISO 3166-2 code e.g. "US-CA", "" for NOSUBDIVISION
+    std::string
+    toString( void ) const;
+
+    bool
+    valid( void ) const { return m_id != NOSUBDIVISION; }
+
+    bool
+    operator==( const Subdivision &s ) const { return m_id == s.m_id; }
+
+    // the order of the ISO 3166-2 codes
+    std::strong_ordering
+    operator<=>( const Subdivision &s ) const { return m_id <=> s.m_id; }
+
+    // ids are in [0, size())
+    static int
+    size( void );
+
+    static Subdivision
+    index( int i );
+
+    static int
+    index( const Subdivision &s ) { return s.m_id; }
+
+    static Subdivision
+    of( const City &c );
+
+    static Subdivision
+    of( const Locode &l );
+
+private:
+
+    struct Entry
+    {
+        std::uint64_t key;     // see key()
+        short         cid;     // ISO numeric
+        char          code[4]; // NUL terminated
+    };
+
+    struct Tables
+    {
+        std::vector<Entry> entries; // by id, entries[0] is NOSUBDIVISION
+        std::vector<int>   city;    // by City dense index
+        std::vector<int>   locode;  // by Locode id
+    };
+
+    static const Tables&
+    tables( void );
+
+    // e.g. ("GB", "LND"), keys compare as the ISO 3166-2 codes do
+    static std::uint64_t
+    key( std::string_view country, std::string_view code );
+
+    int m_id;
+};
+
+
+std::ostream&
+operator<<( std::ostream &ostr, const Subdivision &s );
+
+// hashed by the id
+template <>
+struct std::hash<Subdivision>
+{
+    std::size_t
+    operator()( const Subdivision &s ) const noexcept { return std::size_t(Subdivision::index(s)); }
+};
+
+
+#endif
+
+
@@ -0,0 +1,287 @@
+/* SymbolTable 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   SymbolTable.cpp - code   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ Symbols are held as the first 8 bytes of a uint64 in memory order, so a symbol is compared and copied with memcpy and
+ the strings to be coded must not contain NUL (which pads the symbols).
+
+ */
+
+
+#ifndef __SYMBOLTABLE_H__
+#include "SymbolTable.h"
+#endif
+
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+
+
+namespace
+{
+
+constexpr int ROUNDS = 5;
+
+// a string of at most 8 bytes (without NUL) as a uint64 in memory order
+std::uint64_t
+pack( const char *s, std::size_t n )
+{
+    std::uint64_t retVal = 0;
+    std::memcpy(&retVal, s, std::min<std::size_t>(n, 8));
+    return retVal;
+}
+
+int
+packedLength( std::uint64_t v )
+{
+    char b[8];
+    std::memcpy(b, &v, 8);
+    int n = 0;
+    while (n < 8 && b[n])
+        ++n;
+    return n;
+}
+
+} // namespace
+
+
+SymbolTable::SymbolTable( void ): m_symbol{}, m_length{}, m_count(0), m_first{}, m_byFirst{}
+{
+}
+
+void
+SymbolTable::index( void )
+{
+    // counting sort by first byte, longest first within a byte
+    int counts[256] = { 0 };
+    for (int k = 0; k < m_count; ++k)
+        ++counts[m_symbol[k] & 0xFF];
+
+    m_first[0] = 0;
+    for (int c = 0; c < 256; ++c)
+        m_first[c + 1] = (unsigned short) (m_first[c] + counts[c]);
+
+    unsigned short next[256];
+    std::memcpy(next, m_first, sizeof(next));
+    for (int len = 8; len >= 1; --len)
+    {
+        for (int k = 0; k < m_count; ++k)
+        {
+            if (m_length[k] == len)
+                m_byFirst[next[m_symbol[k] & 0xFF]++] = (unsigned char) k;
+        }
+    }
+}
+
+int
+SymbolTable::match( const char *s, std::size_t n ) const
+{
+    const unsigned char c = (unsigned char) s[0];
+    for (int j = m_first[c]; j < m_first[c + 1]; ++j)
+    {
+        const int k = m_byFirst[j];
+        if (m_length[k] <= n && !std::memcmp(&m_symbol[k], s, m_length[k]))
+            return k;
+    }
+    return -1;
+}
+
+SymbolTable
+SymbolTable::train( const std::vector<std::string> &sample )
+{
+    SymbolTable retVal;
+
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        // occurrences of each symbol used and of each pair of adjacent symbols that fits in 8 bytes
+        std::unordered_map<std::uint64_t, long> counts;
+        for (const std::string &s : sample)
+        {
+            std::uint64_t prev = 0;
+            int prevLength = 0;
+            for (std::size_t i = 0; i < s.size(); )
+            {
+                const int k = retVal.match(s.data() + i, s.size() - i);
+                const int length = (k >= 0) ? retVal.m_length[k] : 1;
+                const std::uint64_t sym = (k >= 0) ? retVal.m_symbol[k] : pack(s.data() + i, 1);
+
+                ++counts[sym];
+                if (length > 1)
+                    ++counts[pack(s.data() + i, 1)]; // keep the single bytes in play
+                if (prevLength && prevLength + length <= 8)
+                    ++counts[prev | (sym << (8 * prevLength))];
+
+                prev = sym;
+                prevLength = length;
+                i += length;
+            }
+        }
+
+        // the symbols that save the most bytes
+        std::vector<std::pair<long, std::uint64_t>> gains;
+        gains.reserve(counts.size());
+        for (const auto &c : counts)
+            gains.emplace_back(c.second * packedLength(c.first), c.first);
+
+        const std::size_t n = std::min<std::size_t>(gains.size(), MAXSYMBOL);
+        std::partial_sort(gains.begin(), gains.begin() + n, gains.end(), []( const auto &a, const auto &b ) {
+            return (a.first != b.first) ? a.first > b.first : a.second < b.second;
+        });
+
+        retVal.m_count = int(n);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            retVal.m_symbol[k] = gains[k].second;
+            retVal.m_length[k] = (unsigned char) packedLength(gains[k].second);
+        }
+        retVal.index();
+    }
+
+    return retVal;
+}
+
+bool
+SymbolTable::load( const void *data )
+{
+    const unsigned char *p = static_cast<const unsigned char*>(data);
+
+    SymbolTable t;
+    std::memcpy(t.m_symbol, p, sizeof(t.m_symbol));
+    std::memcpy(t.m_length, p + sizeof(t.m_symbol), sizeof(t.m_length));
+
+    // the used symbols come first and their lengths match their bytes
+    while (t.m_count < MAXSYMBOL && t.m_length[t.m_count])
+        ++t.m_count;
+    for (int k = 0; k < 256; ++k)
+    {
+        if (t.m_length[k] > 8 || (k < t.m_count && t.m_length[k] != packedLength(t.m_symbol[k])) || (k >= t.m_count && t.m_length[k]))
+            return false;
+    }
+
+    t.index();
+    *this = t;
+    return true;
+}
+
+std::string
+SymbolTable::data( void ) const
+{
+    std::string retVal(SIZE, '\0');
+    std::memcpy(retVal.data(), m_symbol, sizeof(m_symbol));
+    std::memcpy(retVal.data() + sizeof(m_symbol), m_length, sizeof(m_length));
+    return retVal;
+}
+
+std::string
+SymbolTable::encode( std::string_view s ) const
+{
+    std::string retVal;
+    retVal.reserve(s.size());
+    for (std::size_t i = 0; i < s.size(); )
+    {
+        const int k = match(s.data() + i, s.size() - i);
+        if (k >= 0)
+        {
+            retVal += char(k);
+            i += m_length[k];
+        }
+        else
+        {
+            retVal += char(ESCAPE);
+            retVal += s[i++];
+        }
+    }
+    return retVal;
+}
+
+std::size_t
+SymbolTable::decode( const char *code, std::size_t n, char *buf, std::size_t capacity ) const
+{
+    const unsigned char *p   = reinterpret_cast<const unsigned char*>(code);
+    const unsigned char *end = p + n;
+
+    std::size_t k = 0;
+    while (p < end)
+    {
+        const unsigned char c = *p++;
+        if (c == ESCAPE)
+        {
+            if (p == end || k == capacity)
+                break;
+            buf[k++] = char(*p++);
+        }
+        else if (k + 8 <= capacity)
+        {
+            // copy the whole padded symbol and advance by its length
+            std::memcpy(buf + k, &m_symbol[c], 8);
+            k += m_length[c];
+        }
+        else
+        {
+            const std::size_t len = std::min<std::size_t>(m_length[c], capacity - k);
+            std::memcpy(buf + k, &m_symbol[c], len);
+            k += len;
+            if (k == capacity)
+                break;
+        }
+    }
+    return k;
+}
+
+std::string
+SymbolTable::decode( const char *code, std::size_t n ) const
+{
+    // a code is at most 8 characters
+    std::string retVal(n * 8, '\0');
+    retVal.resize(decode(code, n, retVal.data(), retVal.size()));
+    return retVal;
+}
+
+bool
+SymbolTable::equal( const char *code, std::size_t n, std::string_view s ) const
+{
+    // the coding is deterministic, so compare the codes
+    const std::string c = encode(s);
+    return c.size() == n && !std::memcmp(c.data(), code, n);
+}
+
+bool
+SymbolTable::startsWith( const char *code, std::size_t n, std::string_view prefix ) const
+{
+    const unsigned char *p   = reinterpret_cast<const unsigned char*>(code);
+    const unsigned char *end = p + n;
+
+    std::size_t i = 0;
+    while (i < prefix.size())
+    {
+        if (p == end)
+            return false;
+
+        const unsigned char c = *p++;
+        if (c == ESCAPE)
+        {
+            if (p == end || char(*p++) != prefix[i++])
+                return false;
+        }
+        else
+        {
+            const std::size_t len = std::min<std::size_t>(m_length[c], prefix.size() - i);
+            if (std::memcmp(&m_symbol[c], prefix.data() + i, len))
+                return false;
+            i += len;
+        }
+    }
+    return true;
+}
+
+//
+//
+//
+
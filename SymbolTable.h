@@ -0,0 +1,122 @@
+/* SymbolTable 19/10/2026
+
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+ $   SymbolTable.h - header   $
+ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
+
+ by W.B. Yates
+ Copyright (c) W.B. Yates. All rights reserved.
+ History:
+
+ A static symbol table string compressor, after FSST (Boncz, Neumann and Leis, "FSST: Fast Random Access String
+ Compression", VLDB 2020).
+
+ Up to 255 symbols of 1 to 8 bytes are chosen from a sample of the strings, and each string is then coded on its own as a
+ sequence of one byte codes, a symbol number or ESCAPE followed by a literal byte. As every string is coded separately any
+ one can be decoded without the others, and decoding is a table lookup and an 8 byte copy per code. Place names compress
+ to about a third of their size as they share many short pieces ("SAN ", "ville", "-sur-", "berg").
+
+ The coder is deterministic, so two strings are equal exactly when their codes are, and equal() encodes the query and
+ compares codes. startsWith() compares symbol by symbol against the query and stops at the first difference, so neither
+ builds the decoded string.
+
+ train() selects the symbols in a few rounds: code the sample with the current table, count how often each symbol and
+ each pair of adjacent symbols occurs, and keep the 255 symbols (including pairs merged into one) that save the most bytes.
+
+ The table is 2.3KB: 256 symbols of 8 bytes, padded with zeros, and their lengths. data() and load() give it as flat bytes so
+ it can be stored next to the coded strings and used in place from a memory map.
+
+ Example
+
+ std::vector<std::string> names = ...;
+ SymbolTable t = SymbolTable::train(names);
+
+ std::string c = t.encode("Saint-Germain-en-Laye");
+ char buf[256];
+ std::size_t n = t.decode(c.data(), c.size(), buf, sizeof(buf)); // buf holds n characters
+ bool same = t.equal(c.data(), c.size(), "Saint-Germain-en-Laye");
+ bool pre  = t.startsWith(c.data(), c.size(), "Saint-G");
+
+ */
+
+
+#ifndef __SYMBOLTABLE_H__
+#define __SYMBOLTABLE_H__
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+
+class SymbolTable
+{
+public:
+
+    static constexpr int            MAXSYMBOL = 255;
+    static constexpr unsigned char  ESCAPE    = 255;
+
+    // the size of data()
+    static constexpr std::size_t    SIZE      = 256 * 8 + 256;
+
+    // no symbols, every byte is escaped
+    SymbolTable( void );
+    ~SymbolTable( void )=default;
+
+    static SymbolTable
+    train( const std::vector<std::string> &sample );
+
+    // a table from data(), false if it is not one
+    bool
+    load( const void *data );
+
+    // SIZE bytes: the symbols as uint64, then their lengths
+    std::string
+    data( void ) const;
+
+    int
+    size( void ) const { return m_count; }
+
+    //
+    // coding
+    //
+    std::string
+    encode( std::string_view s ) const;
+
+    // decode n code bytes into buf, returns the decoded length or, if it is more than capacity, capacity and buf holds the start
+    std::size_t
+    decode( const char *code, std::size_t n, char *buf, std::size_t capacity ) const;
+
+    std::string
+    decode( const char *code, std::size_t n ) const;
+
+    bool
+    equal( const char *code, std::size_t n, std::string_view s ) const;
+
+    bool
+    startsWith( const char *code, std::size_t n, std::string_view prefix ) const;
+
+private:
+
+    // the longest symbol that s starts with, -1 if none
+    int
+    match( const char *s, std::size_t n ) const;
+
+    void
+    index( void );
+
+    std::uint64_t  m_symbol[256];  // the bytes in memory order, unused bytes are zero
+    unsigned char  m_length[256];
+    int            m_count;
+
+    // symbols by first byte, longest first: m_byFirst[m_first[c]] to m_byFirst[m_first[c + 1]]
+    unsigned short m_first[257];
+    unsigned char  m_byFirst[256];
+};
+
+
+#endif
+
+